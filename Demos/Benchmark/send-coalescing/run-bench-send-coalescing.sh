@@ -0,0 +1,29 @@
+#!/bin/sh
+#Usage: ./run-bench-send-coalescing.sh <path/to/SilKitDemoBenchmark> [<path/to/result.csv>]
+
+EXE=$1
+CSVFILE=${2:-./result-send-coalescing.csv}
+SCRIPTDIR=$(dirname "$0")
+
+REPEAT=5
+SIMTIME=1
+NUMPART=4
+MSGCOUNT=1000
+MSGSIZE=16
+
+for configfile in "" "${SCRIPTDIR}/SilKitConfig_DemoBenchmark_SendCoalescing.yaml"
+do
+  CONFIGARG=""
+  if [ ! -z "${configfile}" ]; then
+      CONFIGARG="--configuration ${configfile}"
+  fi
+
+  echo "Run SilKitBenchmarkDemo with RUNS=${REPEAT}, T=${SIMTIME}s, PARTICIPANTS=${NUMPART}, MSGCOUNT=${MSGCOUNT}, MSGSIZE=${MSGSIZE}B, CONFIG=${configfile:-default}, CSV=${CSVFILE}"
+  $EXE --number-simulation-runs ${REPEAT} \
+       --simulation-duration ${SIMTIME} \
+       --number-participants ${NUMPART} \
+       --message-count ${MSGCOUNT} \
+       --message-size ${MSGSIZE} \
+       --write-csv ${CSVFILE} \
+       ${CONFIGARG} | grep "Message rate"
+done
@@ -0,0 +1,238 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "silkit/SilKit.hpp"
+#include "silkit/services/all.hpp"
+#include "silkit/vendor/CreateSilKitRegistry.hpp"
+
+using namespace SilKit::Services::Rpc;
+using namespace std::chrono_literals;
+
+void PrintUsage(const std::string& executableName)
+{
+    std::cout << "Usage:" << std::endl
+              << executableName << " [--call-count NUM] [--payload-size BYTES] [--window NUM]"
+              << " [--registry-uri URI] [--configuration FILE]" << std::endl
+              << "Runs a registry, an RpcServer and an RpcClient in this process and measures the calls per second."
+              << std::endl
+              << "\t--help\tshow this message." << std::endl
+              << "\t--call-count\tThe number of calls. Default: 100000" << std::endl
+              << "\t--payload-size\tThe size of the argument and result data in bytes. Default: 16" << std::endl
+              << "\t--window\tThe number of calls which are in flight at the same time. Default: 16" << std::endl
+              << "\t--registry-uri\tThe URI of the registry to start. Default: silkit://localhost:8500" << std::endl
+              << "\t--configuration\tPath and filename of the participant configuration YAML or JSON file. Default: empty"
+              << std::endl;
+}
+
+struct BenchmarkConfig
+{
+    uint32_t callCount = 100000;
+    uint32_t payloadSizeInBytes = 16;
+    uint32_t window = 16;
+    std::string registryUri = "silkit://localhost:8500";
+    std::string silKitConfigPath = "";
+};
+
+bool Parse(int argc, char** argv, BenchmarkConfig& config)
+{
+    std::vector<std::string> args;
+    std::copy((argv + 1), (argv + argc), std::back_inserter(args));
+
+    for (auto it = args.begin(); it != args.end(); ++it)
+    {
+        if (*it == "--help")
+        {
+            PrintUsage(argv[0]);
+            return false;
+        }
+        if (it + 1 == args.end())
+        {
+            std::cout << "Error: unknown argument or missing value \"" << *it << "\"" << std::endl;
+            PrintUsage(argv[0]);
+            return false;
+        }
+
+        const auto& option = *it;
+        const auto& value = *(++it);
+        try
+        {
+            if (option == "--call-count")
+                config.callCount = static_cast<uint32_t>(std::stoul(value));
+            else if (option == "--payload-size")
+                config.payloadSizeInBytes = static_cast<uint32_t>(std::stoul(value));
+            else if (option == "--window")
+                config.window = static_cast<uint32_t>(std::stoul(value));
+            else if (option == "--registry-uri")
+                config.registryUri = value;
+            else if (option == "--configuration")
+                config.silKitConfigPath = value;
+            else
+            {
+                std::cout << "Error: unknown argument \"" << option << "\"" << std::endl;
+                PrintUsage(argv[0]);
+                return false;
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            std::cout << "Error: cannot parse argument of \"" << option << "\": " << ex.what() << std::endl;
+            return false;
+        }
+    }
+
+    if (config.callCount < 1 || config.window < 1)
+    {
+        std::cout << "Invalid argument: The call count and the window must be at least 1." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkConfig benchmark;
+    if (!Parse(argc, argv, benchmark))
+    {
+        return -1;
+    }
+
+#ifndef NDEBUG
+    std::cout << "WARNING: The RPC benchmark demo is executed in a DEBUG build configuration." << std::endl
+              << "For more reliable timings, please use a RELEASE build configuration." << std::endl;
+#endif
+
+    try
+    {
+        std::shared_ptr<SilKit::Config::IParticipantConfiguration> config;
+        if (benchmark.silKitConfigPath == "")
+        {
+            config = SilKit::Config::ParticipantConfigurationFromString("{}");
+        }
+        else
+        {
+            config = SilKit::Config::ParticipantConfigurationFromFile(benchmark.silKitConfigPath);
+        }
+
+        auto registry = SilKit::Vendor::Vector::CreateSilKitRegistry(config);
+        registry->StartListening(benchmark.registryUri);
+
+        const RpcSpec rpcSpec{"Echo", "application/octet-stream"};
+
+        // The server returns the argument data
+        auto serverParticipant = SilKit::CreateParticipant(config, "Server", benchmark.registryUri);
+        serverParticipant->CreateRpcServer("ServerEcho", rpcSpec, [](IRpcServer* server, RpcCallEvent event) {
+            server->SubmitResult(event.callHandle, event.argumentData);
+        });
+
+        const std::vector<uint8_t> argumentData(benchmark.payloadSizeInBytes, '*');
+
+        std::atomic<bool> isDiscovered{false};
+        std::atomic<uint32_t> issuedCalls{0};
+        uint32_t returnedCalls{0};
+        uint32_t failedCalls{0};
+        std::promise<void> allReturnedPromise;
+
+        auto clientParticipant = SilKit::CreateParticipant(config, "Client", benchmark.registryUri);
+        auto* client = clientParticipant->CreateRpcClient("ClientEcho", rpcSpec, nullptr);
+
+        // The calls of the measurement are marked by their user context, the calls before are probing the server
+        auto* const benchmarkCall = reinterpret_cast<void*>(uintptr_t(1));
+
+        // Keep the window of calls in flight: every returned call issues the next one
+        client->SetCallResultHandler([&](IRpcClient* rpcClient, const RpcCallResultEvent& event) {
+            if (event.userContext != benchmarkCall)
+            {
+                isDiscovered = isDiscovered || (event.callStatus == RpcCallStatus::Success);
+                return;
+            }
+
+            if (event.callStatus != RpcCallStatus::Success)
+            {
+                ++failedCalls;
+            }
+            if (issuedCalls < benchmark.callCount)
+            {
+                ++issuedCalls;
+                rpcClient->Call(argumentData, benchmarkCall);
+            }
+            if (++returnedCalls == benchmark.callCount)
+            {
+                allReturnedPromise.set_value();
+            }
+        });
+
+        // Wait until the client has discovered the server
+        while (!isDiscovered)
+        {
+            client->Call(argumentData);
+            std::this_thread::sleep_for(10ms);
+        }
+
+        std::cout << "Running " << benchmark.callCount << " calls with " << benchmark.payloadSizeInBytes
+                  << " bytes and a window of " << benchmark.window << " calls..." << std::endl;
+
+        const auto startTimestamp = std::chrono::steady_clock::now();
+        const auto initialCalls = (std::min)(benchmark.window, benchmark.callCount);
+        issuedCalls = initialCalls;
+        for (uint32_t i = 0; i < initialCalls; ++i)
+        {
+            client->Call(argumentData, benchmarkCall);
+        }
+        allReturnedPromise.get_future().wait();
+        const auto duration = std::chrono::steady_clock::now() - startTimestamp;
+
+        const auto durationSeconds = std::chrono::duration<double>(duration).count();
+        const auto callsPerSecond = benchmark.callCount / durationSeconds;
+        const auto microsecondsPerCall = durationSeconds * 1e6 / benchmark.callCount;
+
+        std::cout << std::endl
+                  << "Result of the benchmark run:" << std::endl
+                  << std::left << std::setw(38) << "- Realtime duration: " << durationSeconds << " s" << std::endl
+                  << std::left << std::setw(38) << "- Calls per second: " << callsPerSecond << std::endl
+                  << std::left << std::setw(38) << "- Time per call: " << microsecondsPerCall << " us" << std::endl
+                  << std::left << std::setw(38) << "- Failed calls: " << failedCalls << std::endl
+                  << std::endl;
+    }
+    catch (const SilKit::ConfigurationError& error)
+    {
+        std::cerr << "Invalid configuration: " << error.what() << std::endl;
+        return -2;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "Something went wrong: " << error.what() << std::endl;
+        return -3;
+    }
+
+    return 0;
+}
@@ -92,6 +92,13 @@ extern "C"
         return globalCapi->SilKit_CanController_SendFrame(controller, frame, userContext);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_CanController_SendFrames(SilKit_CanController* controller,
+                                                                 const SilKit_CanFrame* frames, size_t numFrames,
+                                                                 void* userContext)
+    {
+        return globalCapi->SilKit_CanController_SendFrames(controller, frames, numFrames, userContext);
+    }
+
     SilKit_ReturnCode SilKitCALL SilKit_CanController_SetBaudRate(SilKit_CanController* controller, uint32_t rate,
                                                                   uint32_t fdRate, uint32_t xlRate)
     {
@@ -238,6 +245,13 @@ extern "C"
         return globalCapi->SilKit_EthernetController_SendFrame(controller, frame, userContext);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_EthernetController_SendFrames(SilKit_EthernetController* controller,
+                                                                      const SilKit_EthernetFrame* frames,
+                                                                      size_t numFrames, void* userContext)
+    {
+        return globalCapi->SilKit_EthernetController_SendFrames(controller, frames, numFrames, userContext);
+    }
+
     // FlexrayController
 
     SilKit_ReturnCode SilKitCALL SilKit_FlexrayController_Create(SilKit_FlexrayController** outController,
@@ -787,6 +801,12 @@ extern "C"
         return globalCapi->SilKit_DataPublisher_Publish(self, data);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_PublishBatch(SilKit_DataPublisher* self,
+                                                                   const SilKit_ByteVector* data, size_t numData)
+    {
+        return globalCapi->SilKit_DataPublisher_PublishBatch(self, data, numData);
+    }
+
     // DataSubscriber
 
     SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_Create(SilKit_DataSubscriber** outSubscriber,
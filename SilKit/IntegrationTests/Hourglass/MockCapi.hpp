@@ -61,6 +61,10 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_CanController_SendFrame,
                 (SilKit_CanController * controller, SilKit_CanFrame* frame, void* userContext));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_CanController_SendFrames,
+                (SilKit_CanController * controller, const SilKit_CanFrame* frames, size_t numFrames,
+                 void* userContext));
+
     MOCK_METHOD(SilKit_ReturnCode, SilKit_CanController_SetBaudRate,
                 (SilKit_CanController * controller, uint32_t rate, uint32_t fdRate, uint32_t xlRate));
 
@@ -133,6 +137,10 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_EthernetController_SendFrame,
                 (SilKit_EthernetController * controller, SilKit_EthernetFrame* frame, void* userContext));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_EthernetController_SendFrames,
+                (SilKit_EthernetController * controller, const SilKit_EthernetFrame* frames, size_t numFrames,
+                 void* userContext));
+
     // FlexrayController
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_FlexrayController_Create,
@@ -426,6 +434,9 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisher_Publish,
                 (SilKit_DataPublisher * self, const SilKit_ByteVector* data));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisher_PublishBatch,
+                (SilKit_DataPublisher * self, const SilKit_ByteVector* data, size_t numData));
+
     // DataSubscriber
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_DataSubscriber_Create,
@@ -175,6 +175,27 @@ TEST_F(HourglassCanTest, SilKit_CanController_SendFrame)
     canController.SendFrame(frame, userContext);
 }
 
+TEST_F(HourglassCanTest, SilKit_CanController_SendFrames)
+{
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::Can::CanController canController(
+        nullptr, "CanController1", "CanNetwork1");
+
+    std::vector<uint8_t> payload1{5};
+    std::vector<uint8_t> payload2{6, 7};
+    std::vector<SilKit::Services::Can::CanFrame> frames{
+        SilKit::Services::Can::CanFrame{456, SilKit_CanFrameFlag_ide, 1, 2, 3, 4, payload1},
+        SilKit::Services::Can::CanFrame{457, 0, 2, 2, 3, 4, payload2},
+    };
+    void* userContext = &frames;
+    EXPECT_CALL(capi, SilKit_CanController_SendFrames(mockCanController, testing::_, 2, userContext))
+        .WillOnce([&frames](SilKit_CanController*, const SilKit_CanFrame* cFrames, size_t, void*) {
+            EXPECT_TRUE(testing::Matches(CanFrameMatcher(frames[0]))(&cFrames[0]));
+            EXPECT_TRUE(testing::Matches(CanFrameMatcher(frames[1]))(&cFrames[1]));
+            return SilKit_ReturnCode_SUCCESS;
+        });
+    canController.SendFrames(frames, userContext);
+}
+
 TEST_F(HourglassCanTest, SilKit_CanController_SetBaudRate)
 {
     SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::Can::CanController canController(
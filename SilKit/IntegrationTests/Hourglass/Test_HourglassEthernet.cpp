@@ -205,4 +205,25 @@ TEST_F(HourglassCanTest, SilKit_EthernetController_SendFrame)
     ethernetController.SendFrame(frame, userContext);
 }
 
+TEST_F(HourglassCanTest, SilKit_EthernetController_SendFrames)
+{
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::Ethernet::EthernetController ethernetController(
+        nullptr, "EthernetController1", "EthernetNetwork1");
+
+    std::vector<uint8_t> payload1{5};
+    std::vector<uint8_t> payload2{6, 7};
+    std::vector<SilKit::Services::Ethernet::EthernetFrame> frames{
+        SilKit::Services::Ethernet::EthernetFrame{payload1},
+        SilKit::Services::Ethernet::EthernetFrame{payload2},
+    };
+    void* userContext = &frames;
+    EXPECT_CALL(capi, SilKit_EthernetController_SendFrames(mockEthernetController, testing::_, 2, userContext))
+        .WillOnce([&frames](SilKit_EthernetController*, const SilKit_EthernetFrame* cFrames, size_t, void*) {
+            EXPECT_TRUE(testing::Matches(EthernetFrameMatcher(frames[0]))(&cFrames[0]));
+            EXPECT_TRUE(testing::Matches(EthernetFrameMatcher(frames[1]))(&cFrames[1]));
+            return SilKit_ReturnCode_SUCCESS;
+        });
+    ethernetController.SendFrames(frames, userContext);
+}
+
 } //namespace
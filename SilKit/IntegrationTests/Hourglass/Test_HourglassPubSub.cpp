@@ -178,6 +178,27 @@ TEST_F(HourglassPubSubTest, SilKit_DataPublisher_Publish)
     publisher.Publish(byteSpan);
 }
 
+TEST_F(HourglassPubSubTest, SilKit_DataPublisher_PublishBatch)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataPublisher publisher{
+        participant, "DataPublisher1", PubSubSpec{"Topic1", "MediaType1"}, 0x42};
+
+    std::vector<uint8_t> bytes1{1, 2, 3};
+    std::vector<uint8_t> bytes2{4, 5, 6, 7};
+    const std::vector<Span<const uint8_t>> values{bytes1, bytes2};
+
+    EXPECT_CALL(capi, SilKit_DataPublisher_PublishBatch(mockDataPublisher, testing::_, 2))
+        .WillOnce([&bytes1, &bytes2](SilKit_DataPublisher*, const SilKit_ByteVector* data, size_t) {
+            EXPECT_TRUE(testing::Matches(ByteVectorMatcher(Span<uint8_t>{bytes1}))(&data[0]));
+            EXPECT_TRUE(testing::Matches(ByteVectorMatcher(Span<uint8_t>{bytes2}))(&data[1]));
+            return SilKit_ReturnCode_SUCCESS;
+        });
+
+    publisher.PublishBatch(values);
+}
+
 // DataSubscriber
 
 TEST_F(HourglassPubSubTest, SilKit_DataSubscriber_Create)
@@ -517,4 +517,45 @@ TEST_F(DashboardTestHarness, dashboard_netsim_coordinated)
     CheckTestResult(testResult, expected);
 }
 
+TEST_F(DashboardTestHarness, dashboard_can_many_controllers)
+{
+    const auto participantName = "CanWriter";
+    const auto networkName = "CAN1";
+    const size_t controllerCount = 200;
+    SetupFromParticipantLists({participantName}, {});
+    auto testResult = SilKit::Dashboard::RunDashboardTest(
+        ParticipantConfigurationFromStringImpl(_dashboardParticipantConfig), _registryUri, _dashboardUri,
+        [this, &participantName, &networkName, controllerCount]() {
+            _simTestHarness->CreateSystemController();
+            {
+                auto&& simParticipant = _simTestHarness->GetParticipant(participantName);
+                auto&& participant = simParticipant->Participant();
+                auto&& timeSyncService = simParticipant->GetOrCreateTimeSyncService();
+                for (size_t i = 0; i < controllerCount; ++i)
+                {
+                    participant->CreateCanController("CanController" + std::to_string(i), networkName);
+                }
+                timeSyncService->SetSimulationStepHandler(
+                    [simParticipant](auto, auto) {
+                        Log() << simParticipant->Name() << ": stopping";
+                        simParticipant->Stop();
+                    },
+                    10ms);
+            }
+            auto ok = _simTestHarness->Run(5s);
+            ASSERT_TRUE(ok) << "SimTestHarness should terminate without timeout";
+            _simTestHarness->ResetParticipants();
+        });
+    _simTestHarness->ResetRegistry();
+    Log() << "Dashboard: received " << testResult.eventCount << " events at " << testResult.eventsPerSecond
+          << " events/s";
+    ASSERT_EQ(testResult.errorStatus, -1) << "No error expected!";
+    ASSERT_TRUE(testResult.allSimulationsFinished) << "All simulations should be finished!";
+    ASSERT_EQ(testResult.dataBySimulation.size(), 1u) << "Unexpected simulation count!";
+    ASSERT_EQ(testResult.dataBySimulation[1].servicesByParticipant[participantName].size(), controllerCount)
+        << "Unexpected controller count!";
+    ASSERT_GE(testResult.eventCount, controllerCount) << "All controllers should be counted as events!";
+    ASSERT_GT(testResult.eventsPerSecond, 0.0) << "Event rate should be measured!";
+}
+
 } //end namespace
@@ -138,6 +138,38 @@ DataSubscribers:
     RunSyncTest(pubsubs);
 }
 
+// Publishers aggregating their messages per simulation step
+TEST_F(ITest_Internals_DataPubSub, test_1pub_1sub_sync_aggregated)
+{
+    const uint32_t numMsgToPublish = 10;
+    const uint32_t numMsgToReceive = numMsgToPublish;
+
+    const auto configStringPub = R"raw(
+DataPublishers:
+- Name: PubCtrl1
+  Aggregation:
+    Mode: SimulationStep
+- Name: PubCtrl2
+  Aggregation:
+    Mode: TimeWindow
+    TimeWindow: 5
+)raw";
+    auto configPub = SilKit::Config::ParticipantConfigurationFromStringImpl(configStringPub);
+
+    std::vector<PubSubParticipant> pubsubs;
+    pubsubs.push_back({"Pub1",
+                       {{"PubCtrl1", "TopicA", {"A"}, {}, 0, defaultMsgSize, numMsgToPublish},
+                        {"PubCtrl2", "TopicB", {"A"}, {}, 0, defaultMsgSize, numMsgToPublish}},
+                       {},
+                       configPub});
+    pubsubs.push_back({"Sub1",
+                       {},
+                       {{"SubCtrl1", "TopicA", {"A"}, {}, defaultMsgSize, numMsgToReceive, 1},
+                        {"SubCtrl2", "TopicB", {"A"}, {}, defaultMsgSize, numMsgToReceive, 1}}});
+
+    RunSyncTest(pubsubs);
+}
+
 // Large messages
 TEST_F(ITest_Internals_DataPubSub, test_1pub_1sub_sync_largemsg)
 {
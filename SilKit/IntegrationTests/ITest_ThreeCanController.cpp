@@ -134,6 +134,15 @@ protected:
         timeSyncService->SetSimulationStepHandler(
             [this, controller](auto, auto)
             {
+                if (sendAsBatch)
+                {
+                    if (numSent == 0)
+                    {
+                        SendAllAsBatch(controller);
+                    }
+                    return;
+                }
+
                 if (numSent < testMessages.size())
                 {
                     const auto& message = testMessages.at(numSent);
@@ -156,6 +165,27 @@ protected:
         }, 1ms);
     }
 
+    void SendAllAsBatch(ICanController* controller)
+    {
+        std::vector<std::vector<uint8_t>> payloads;
+        std::vector<CanFrame> frames;
+        for (const auto& message : testMessages)
+        {
+            payloads.emplace_back(message.expectedData.begin(), message.expectedData.end());
+        }
+        for (const auto& payload : payloads)
+        {
+            CanFrame msg{};
+            msg.canId = 1;
+            msg.dataField = payload;
+            msg.dlc = static_cast<uint16_t>(payload.size());
+            frames.push_back(msg);
+        }
+
+        controller->SendFrames(frames, MakeUserContext(controllerToId[controller], batchFrameCounter));
+        numSent = static_cast<unsigned>(frames.size());
+    }
+
     void SetupReader(SilKit::Tests::SimParticipant* reader)
     {
 
@@ -212,9 +242,17 @@ protected:
         auto* canReader2 = testHarness.GetParticipant("CanReader2");
         SetupReader(canReader2);
 
-        for (uint16_t index = 1u; index <= static_cast<uint16_t>(testMessages.size()); index++)
+        if (sendAsBatch)
+        {
+            EXPECT_CALL(callbacks, AckHandler(AnAckWithCanIdAndFrameCounter(1, batchFrameCounter)))
+                .Times(static_cast<int>(testMessages.size()));
+        }
+        else
         {
-            EXPECT_CALL(callbacks, AckHandler(AnAckWithCanIdAndFrameCounter(1, index))).Times(1);
+            for (uint16_t index = 1u; index <= static_cast<uint16_t>(testMessages.size()); index++)
+            {
+                EXPECT_CALL(callbacks, AckHandler(AnAckWithCanIdAndFrameCounter(1, index))).Times(1);
+            }
         }
         EXPECT_CALL(callbacks, AckHandler(AnAckWithCanIdAndFrameCounter(1, 0))).Times(0);
         EXPECT_CALL(callbacks, AckHandler(AnAckWithCanIdAndFrameCounter(1, 6))).Times(0);
@@ -251,6 +289,9 @@ protected:
         numReceived{0},
         numReceived2{0};
 
+    bool sendAsBatch{false};
+    const uint16_t batchFrameCounter{7};
+
     Callbacks callbacks;
 };
 
@@ -259,4 +300,10 @@ TEST_F(ITest_ThreeCanController, test_can_ack_callbacks)
     ExecuteTest();
 }
 
+TEST_F(ITest_ThreeCanController, test_can_send_frames_in_one_batch)
+{
+    sendAsBatch = true;
+    ExecuteTest();
+}
+
 } // anonymous namespace
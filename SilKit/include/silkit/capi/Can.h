@@ -276,6 +276,24 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_CanController_SendFrame(SilKit_Can
 typedef SilKit_ReturnCode (SilKitFPTR *SilKit_CanController_SendFrame_t)(SilKit_CanController* controller, SilKit_CanFrame* frame,
     void* userContext);
 
+/*! \brief Request the transmission of multiple CanFrames at once
+*
+* Behaves like calling SilKit_CanController_SendFrame for each frame in
+* order, but hands all frames to the network layer in a single operation.
+*
+* \param controller The CAN controller that should send the CAN frames.
+* \param frames Array of the CAN frames to transmit.
+* \param numFrames The number of frames in the array.
+* \param userContext A user provided context pointer, that is
+* reobtained in the SilKit_CanController_AddFrameTransmitHandler
+* handler of every frame.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_CanController_SendFrames(SilKit_CanController* controller,
+    const SilKit_CanFrame* frames, size_t numFrames, void* userContext);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_CanController_SendFrames_t)(SilKit_CanController* controller,
+    const SilKit_CanFrame* frames, size_t numFrames, void* userContext);
+
 /*! \brief Configure the baud rate of the controller
  *
  * \param controller The CAN controller for which the baud rate should be changed.
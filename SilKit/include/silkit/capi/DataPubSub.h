@@ -107,6 +107,21 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Publish(SilKit_DataP
 
 typedef SilKit_ReturnCode (SilKitFPTR *SilKit_DataPublisher_Publish_t)(SilKit_DataPublisher* self, const SilKit_ByteVector* data);
 
+/*! \brief Publish multiple data values at once through the provided DataPublisher
+*
+* Behaves like calling SilKit_DataPublisher_Publish for each value in order,
+* but hands all values to the network layer in a single operation.
+*
+* \param self The DataPublisher that should publish the data.
+* \param data Array of the data values that should be published.
+* \param numData The number of data values in the array.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_PublishBatch(SilKit_DataPublisher* self,
+                                                                       const SilKit_ByteVector* data, size_t numData);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_DataPublisher_PublishBatch_t)(SilKit_DataPublisher* self,
+                                                                          const SilKit_ByteVector* data, size_t numData);
+
 /*! \brief Sets / overwrites the default handler to be called on data reception.
 * \param self The DataSubscriber for which the handler should be set.
 * \param context A user provided context, that is reobtained on data reception in the dataHandler.
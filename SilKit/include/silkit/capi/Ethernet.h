@@ -368,6 +368,30 @@ typedef SilKit_ReturnCode(SilKitFPTR *SilKit_EthernetController_SendFrame_t)(
   SilKit_EthernetFrame* frame,
   void* userContext);
 
+/*! \brief Send multiple Ethernet frames at once
+ *
+ * Behaves like calling SilKit_EthernetController_SendFrame for each frame in
+ * order, but hands all frames to the network layer in a single operation.
+ *
+ * \param controller The Ethernet controller that should send the frames.
+ * \param frames Array of the Ethernet frames to be sent.
+ * \param numFrames The number of frames in the array.
+ * \param userContext The user provided context pointer, that is reobtained in
+ *                    the frame ack handler of every frame
+ * \result A return code identifying the success/failure of the call.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_EthernetController_SendFrames(
+  SilKit_EthernetController* controller,
+  const SilKit_EthernetFrame* frames,
+  size_t numFrames,
+  void* userContext);
+
+typedef SilKit_ReturnCode(SilKitFPTR *SilKit_EthernetController_SendFrames_t)(
+  SilKit_EthernetController* controller,
+  const SilKit_EthernetFrame* frames,
+  size_t numFrames,
+  void* userContext);
+
 SILKIT_END_DECLS
 
 #pragma pack(pop)
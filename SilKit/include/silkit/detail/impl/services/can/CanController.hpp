@@ -22,6 +22,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include "silkit/capi/Can.h"
 
@@ -54,6 +55,8 @@ public:
 
     inline void SendFrame(const SilKit::Services::Can::CanFrame &msg, void *userContext) override;
 
+    inline void SendFrames(Util::Span<const SilKit::Services::Can::CanFrame> msgs, void *userContext) override;
+
     inline auto AddFrameHandler(FrameHandler handler, SilKit::Services::DirectionMask directionMask)
         -> Util::HandlerId override;
 
@@ -171,6 +174,27 @@ void CanController::SendFrame(const SilKit::Services::Can::CanFrame &msg, void *
     ThrowOnError(returnCode);
 }
 
+void CanController::SendFrames(Util::Span<const SilKit::Services::Can::CanFrame> msgs, void *userContext)
+{
+    std::vector<SilKit_CanFrame> canFrames(msgs.size());
+    for (size_t i = 0; i < msgs.size(); ++i)
+    {
+        auto &canFrame = canFrames[i];
+        SilKit_Struct_Init(SilKit_CanFrame, canFrame);
+        canFrame.id = msgs[i].canId;
+        canFrame.flags = msgs[i].flags;
+        canFrame.dlc = msgs[i].dlc;
+        canFrame.sdt = msgs[i].sdt;
+        canFrame.vcid = msgs[i].vcid;
+        canFrame.af = msgs[i].af;
+        canFrame.data = ToSilKitByteVector(msgs[i].dataField);
+    }
+
+    const auto returnCode =
+        SilKit_CanController_SendFrames(_canController, canFrames.data(), canFrames.size(), userContext);
+    ThrowOnError(returnCode);
+}
+
 auto CanController::AddFrameHandler(FrameHandler handler, SilKit::Services::DirectionMask directionMask)
     -> Util::HandlerId
 {
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include "silkit/capi/Ethernet.h"
 
@@ -67,6 +68,9 @@ public:
 
     inline void SendFrame(SilKit::Services::Ethernet::EthernetFrame msg, void *userContext) override;
 
+    inline void SendFrames(Util::Span<const SilKit::Services::Ethernet::EthernetFrame> msgs,
+                           void *userContext) override;
+
 private:
     template <typename HandlerFunction>
     struct HandlerData
@@ -296,6 +300,21 @@ void EthernetController::SendFrame(SilKit::Services::Ethernet::EthernetFrame msg
     ThrowOnError(returnCode);
 }
 
+void EthernetController::SendFrames(Util::Span<const SilKit::Services::Ethernet::EthernetFrame> msgs,
+                                    void *userContext)
+{
+    std::vector<SilKit_EthernetFrame> ethernetFrames(msgs.size());
+    for (size_t i = 0; i < msgs.size(); ++i)
+    {
+        SilKit_Struct_Init(SilKit_EthernetFrame, ethernetFrames[i]);
+        ethernetFrames[i].raw = SilKit::Util::ToSilKitByteVector(msgs[i].raw);
+    }
+
+    const auto returnCode = SilKit_EthernetController_SendFrames(_ethernetController, ethernetFrames.data(),
+                                                                 ethernetFrames.size(), userContext);
+    ThrowOnError(returnCode);
+}
+
 } // namespace Ethernet
 } // namespace Services
 } // namespace Impl
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "silkit/capi/DataPubSub.h"
 
@@ -44,6 +45,8 @@ public:
 
     inline void Publish(Util::Span<const uint8_t> data) override;
 
+    inline void PublishBatch(Util::Span<const Util::Span<const uint8_t>> data) override;
+
 private:
     SilKit_DataPublisher* _dataPublisher{nullptr};
 };
@@ -93,6 +96,19 @@ void DataPublisher::Publish(Util::Span<const uint8_t> data)
     ThrowOnError(returnCode);
 }
 
+void DataPublisher::PublishBatch(Util::Span<const Util::Span<const uint8_t>> data)
+{
+    std::vector<SilKit_ByteVector> byteVectors;
+    byteVectors.reserve(data.size());
+    for (const auto& value : data)
+    {
+        byteVectors.push_back(ToSilKitByteVector(value));
+    }
+
+    const auto returnCode = SilKit_DataPublisher_PublishBatch(_dataPublisher, byteVectors.data(), byteVectors.size());
+    ThrowOnError(returnCode);
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace Impl
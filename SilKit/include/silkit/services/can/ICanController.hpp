@@ -123,6 +123,17 @@ public:
      */
     virtual void SendFrame(const CanFrame& msg, void* userContext = nullptr) = 0;
 
+    /*! \brief Request the transmission of multiple CanFrames at once
+     *
+     * Behaves like calling \ref SendFrame for each frame in order, but
+     * hands all frames to the network layer in a single operation.
+     *
+     * \param msgs The frames to transmit.
+     * \param userContext An optional user provided pointer that is
+     * reobtained in the \ref FrameTransmitHandler of every frame.
+     */
+    virtual void SendFrames(Util::Span<const CanFrame> msgs, void* userContext = nullptr) = 0;
+
     /*! \brief Register a callback for CAN message reception
      *
      * The registered handler is called when the controller receives a
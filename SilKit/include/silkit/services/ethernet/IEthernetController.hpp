@@ -165,6 +165,17 @@ public:
      * reobtained in the \ref FrameTransmitHandler.
      */
     virtual void SendFrame(EthernetFrame msg, void* userContext = nullptr) = 0;
+
+    /*! \brief Send multiple Ethernet frames at once
+     *
+     * Behaves like calling \ref SendFrame for each frame in order, but
+     * hands all frames to the network layer in a single operation.
+     *
+     * \param msgs The Ethernet frames to send.
+     * \param userContext Optional user provided pointer that is
+     * reobtained in the \ref FrameTransmitHandler of every frame.
+     */
+    virtual void SendFrames(Util::Span<const EthernetFrame> msgs, void* userContext = nullptr) = 0;
 };
 
 } // namespace Ethernet
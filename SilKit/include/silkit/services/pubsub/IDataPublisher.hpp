@@ -44,6 +44,15 @@ public:
      * \param data A non-owning reference to an opaque block of raw data
      */
     virtual void Publish(Util::Span<const uint8_t> data) = 0;
+
+    /*! \brief Publish multiple values at once
+     *
+     * Behaves like calling \ref Publish for each value in order, but
+     * hands all values to the network layer in a single operation.
+     *
+     * \param data Non-owning references to the opaque blocks of raw data
+     */
+    virtual void PublishBatch(Util::Span<const Util::Span<const uint8_t>> data) = 0;
 };
 
 } // namespace PubSub
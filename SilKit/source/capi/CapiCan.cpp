@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <map>
 #include <mutex>
 #include <cstring>
+#include <vector>
 #include <sstream>
 
 #include "silkit/capi/SilKit.h"
@@ -244,6 +245,38 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_CanController_SendFrames(SilKit_CanController* controller,
+                                                             const SilKit_CanFrame* frames, size_t numFrames,
+                                                             void* transmitContext)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(controller);
+    ASSERT_VALID_POINTER_PARAMETER(frames);
+
+    auto canController = reinterpret_cast<SilKit::Services::Can::ICanController*>(controller);
+
+    std::vector<SilKit::Services::Can::CanFrame> cppFrames(numFrames);
+    for (size_t i = 0; i < numFrames; ++i)
+    {
+        const auto* message = &frames[i];
+        ASSERT_VALID_STRUCT_HEADER(message);
+
+        auto& frame = cppFrames[i];
+        frame.canId = message->id;
+        frame.flags = message->flags;
+        frame.dlc = message->dlc;
+        frame.sdt = message->sdt;
+        frame.vcid = message->vcid;
+        frame.af = message->af;
+        frame.dataField = SilKit::Util::ToSpan(message->data);
+    }
+
+    canController->SendFrames(cppFrames, transmitContext);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_CanController_Start(SilKit_CanController* controller)
 try
 {
@@ -31,6 +31,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <map>
 #include <mutex>
 #include <cstring>
+#include <vector>
 
 
 SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Create(SilKit_DataPublisher** outPublisher, SilKit_Participant* participant,
@@ -68,6 +69,26 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_PublishBatch(SilKit_DataPublisher* self,
+                                                               const SilKit_ByteVector* data, size_t numData)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    ASSERT_VALID_POINTER_PARAMETER(data);
+
+    auto cppPublisher = reinterpret_cast<SilKit::Services::PubSub::IDataPublisher*>(self);
+
+    std::vector<SilKit::Util::Span<const uint8_t>> values(numData);
+    for (size_t i = 0; i < numData; ++i)
+    {
+        values[i] = SilKit::Util::ToSpan(data[i]);
+    }
+    cppPublisher->PublishBatch(values);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_Create(SilKit_DataSubscriber** outSubscriber, SilKit_Participant* participant,
                                                const char* controllerName, SilKit_DataSpec* dataSpec,
                                                void* defaultDataHandlerContext,
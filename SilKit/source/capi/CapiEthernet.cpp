@@ -26,6 +26,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/services/ethernet/all.hpp"
 
 #include <cstring>
+#include <vector>
 #include "CapiImpl.hpp"
 
 
@@ -258,3 +259,25 @@ try
     return SilKit_ReturnCode_SUCCESS;
 }
 CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_EthernetController_SendFrames(SilKit_EthernetController* controller,
+                                                                  const SilKit_EthernetFrame* frames,
+                                                                  size_t numFrames, void* userContext)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(controller);
+    ASSERT_VALID_POINTER_PARAMETER(frames);
+
+    auto cppController = reinterpret_cast<SilKit::Services::Ethernet::IEthernetController*>(controller);
+
+    std::vector<SilKit::Services::Ethernet::EthernetFrame> cppFrames(numFrames);
+    for (size_t i = 0; i < numFrames; ++i)
+    {
+        cppFrames[i].raw = SilKit::Util::Span<const uint8_t>{frames[i].raw.data, frames[i].raw.size};
+    }
+    cppController->SendFrames(cppFrames, userContext);
+
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
@@ -87,6 +87,7 @@ namespace {
         MOCK_METHOD(void, Stop, (), (override));
         MOCK_METHOD(void, Sleep, (), (override));
         MOCK_METHOD(void, SendFrame, (const CanFrame&, void*), (override));
+        MOCK_METHOD(void, SendFrames, (SilKit::Util::Span<const CanFrame>, void*), (override));
         MOCK_METHOD(SilKit::Services::HandlerId, AddFrameHandler, (FrameHandler, SilKit::Services::DirectionMask), (override));
         MOCK_METHOD(void, RemoveFrameHandler, (SilKit::Services::HandlerId), (override));
         MOCK_METHOD(SilKit::Services::HandlerId, AddStateChangeHandler, (StateChangeHandler), (override));
@@ -253,6 +254,38 @@ namespace {
         EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
     }
 
+    TEST_F(CapiCanTest, can_controller_send_frames)
+    {
+        SilKit_ReturnCode returnCode;
+
+        uint8_t buffer[2] = {1, 2};
+        SilKit_CanFrame cfs[2];
+        SilKit_Struct_Init(SilKit_CanFrame, cfs[0]);
+        cfs[0].id = 1;
+        cfs[0].data = {&buffer[0], 1};
+        cfs[0].dlc = 1;
+        SilKit_Struct_Init(SilKit_CanFrame, cfs[1]);
+        cfs[1].id = 2;
+        cfs[1].data = {&buffer[0], 2};
+        cfs[1].dlc = 2;
+
+        const auto userContext = reinterpret_cast<void*>(0x12345);
+        EXPECT_CALL(mockController, SendFrames(testing::_, userContext))
+            .WillOnce([&cfs](SilKit::Util::Span<const CanFrame> frames, void*) {
+                ASSERT_EQ(frames.size(), 2u);
+                EXPECT_THAT(frames[0], CanFrameMatcher(cfs[0]));
+                EXPECT_THAT(frames[1], CanFrameMatcher(cfs[1]));
+            });
+        returnCode = SilKit_CanController_SendFrames((SilKit_CanController*)&mockController, cfs, 2, userContext);
+        EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+        // a frame without a valid struct header rejects the whole batch
+        cfs[1].structHeader = {};
+        EXPECT_CALL(mockController, SendFrames(testing::_, testing::_)).Times(0);
+        returnCode = SilKit_CanController_SendFrames((SilKit_CanController*)&mockController, cfs, 2, userContext);
+        EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+    }
+
 
     TEST_F(CapiCanTest, can_controller_nullpointer_params)
     {
@@ -278,6 +311,10 @@ namespace {
         EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
         returnCode = SilKit_CanController_SendFrame((SilKit_CanController*)&mockController, nullptr, NULL);
         EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+        returnCode = SilKit_CanController_SendFrames(nullptr, &cf, 1, NULL);
+        EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+        returnCode = SilKit_CanController_SendFrames((SilKit_CanController*)&mockController, nullptr, 1, NULL);
+        EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
 
 
         returnCode =
@@ -55,6 +55,7 @@ class MockDataPublisher : public SilKit::Services::PubSub::IDataPublisher
 {
 public:
     MOCK_METHOD(void, Publish, (SilKit::Util::Span<const uint8_t> data), (override));
+    MOCK_METHOD(void, PublishBatch, (SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data), (override));
 };
 
 class MockDataSubscriber : public SilKit::Services::PubSub::IDataSubscriber
@@ -225,6 +226,12 @@ TEST_F(CapiDataTest, data_publisher_bad_parameters)
 
     returnCode = SilKit_DataPublisher_Publish((SilKit_DataPublisher*)&mockDataPublisher, nullptr);
     EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataPublisher_PublishBatch(nullptr, &data, 1);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataPublisher_PublishBatch((SilKit_DataPublisher*)&mockDataPublisher, nullptr, 1);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
 }
 
 TEST_F(CapiDataTest, data_subscriber_bad_parameters)
@@ -280,4 +287,22 @@ TEST_F(CapiDataTest, data_publisher_publish)
     EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
 }
 
+TEST_F(CapiDataTest, data_publisher_publish_batch)
+{
+    SilKit_ReturnCode returnCode = 0;
+    uint8_t buffer[4] = {1, 2, 3, 4};
+    SilKit_ByteVector data[2] = {{&buffer[0], 2}, {&buffer[2], 2}};
+
+    std::vector<uint8_t> refData1{1, 2};
+    std::vector<uint8_t> refData2{3, 4};
+    EXPECT_CALL(mockDataPublisher, PublishBatch(testing::_))
+        .WillOnce([&refData1, &refData2](SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> values) {
+            ASSERT_EQ(values.size(), 2u);
+            EXPECT_THAT(values[0], PayloadMatcher(refData1));
+            EXPECT_THAT(values[1], PayloadMatcher(refData2));
+        });
+    returnCode = SilKit_DataPublisher_PublishBatch((SilKit_DataPublisher*)&mockDataPublisher, data, 2);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+}
+
 } // namespace
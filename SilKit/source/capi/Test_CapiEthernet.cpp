@@ -64,6 +64,7 @@ public:
     MOCK_METHOD(SilKit::Services::HandlerId, AddBitrateChangeHandler, (BitrateChangeHandler), (override));
     MOCK_METHOD(void, RemoveBitrateChangeHandler, (SilKit::Services::HandlerId), (override));
     MOCK_METHOD(void, SendFrame, (EthernetFrame, void*), (override));
+    MOCK_METHOD(void, SendFrames, (SilKit::Util::Span<const EthernetFrame>, void*), (override));
 };
 
 class CapiEthernetTest : public testing::Test
@@ -314,6 +315,12 @@ TEST_F(CapiEthernetTest, ethernet_controller_nullptr_params)
 
     returnCode = SilKit_EthernetController_SendFrame(nullptr, &ef, testUserContext);
     EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_EthernetController_SendFrames((SilKit_EthernetController*)&mockController, nullptr, 1, nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_EthernetController_SendFrames(nullptr, &ef, 1, testUserContext);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
 }
 
 TEST_F(CapiEthernetTest, ethernet_controller_send_frame)
@@ -357,6 +364,32 @@ TEST_F(CapiEthernetTest, ethernet_controller_send_frame)
 
 }
 
+TEST_F(CapiEthernetTest, ethernet_controller_send_frames)
+{
+    SilKit_ReturnCode returnCode = 0;
+    uint8_t buffer[64] = {0xF6, 0x04, 0x68, 0x71, 0xAA, 0xC1, 0xF6, 0x04, 0x68, 0x71, 0xAA, 0xC2, 0x00, 0x08};
+
+    SilKit_EthernetFrame efs[2];
+    SilKit_Struct_Init(SilKit_EthernetFrame, efs[0]);
+    efs[0].raw = {(const uint8_t*)buffer, 60};
+    SilKit_Struct_Init(SilKit_EthernetFrame, efs[1]);
+    efs[1].raw = {(const uint8_t*)buffer, 64};
+
+    const auto testUserContext = reinterpret_cast<void *>(0x12345);
+
+    EthernetFrame refFrame1{SilKit::Util::Span<const uint8_t>{buffer, 60}};
+    EthernetFrame refFrame2{SilKit::Util::Span<const uint8_t>{buffer, 64}};
+    EXPECT_CALL(mockController, SendFrames(testing::_, testUserContext))
+        .WillOnce([&refFrame1, &refFrame2](SilKit::Util::Span<const EthernetFrame> frames, void*) {
+            ASSERT_EQ(frames.size(), 2u);
+            EXPECT_THAT(frames[0], EthFrameMatcher(refFrame1));
+            EXPECT_THAT(frames[1], EthFrameMatcher(refFrame2));
+        });
+    returnCode =
+        SilKit_EthernetController_SendFrames((SilKit_EthernetController*)&mockController, efs, 2, testUserContext);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+}
+
 TEST_F(CapiEthernetTest, ethernet_controller_send_short_frame)
 {
     std::vector<uint8_t> buffer;
@@ -39,6 +39,7 @@ SilKit_HandlerId id;
 (void) SilKit_CanController_Reset(nullptr);
 (void) SilKit_CanController_Sleep(nullptr);
 (void) SilKit_CanController_SendFrame(nullptr, nullptr, nullptr);
+(void) SilKit_CanController_SendFrames(nullptr, nullptr, 0, nullptr);
 (void) SilKit_CanController_SetBaudRate(nullptr, 0,0,0);
 (void) SilKit_CanController_AddFrameTransmitHandler(nullptr, nullptr, nullptr,0,&id);
 (void) SilKit_CanController_RemoveFrameTransmitHandler(nullptr,0);
@@ -51,6 +52,7 @@ SilKit_HandlerId id;
 (void) SilKit_DataPublisher_Create(nullptr, nullptr,"",nullptr,0);
 (void) SilKit_DataSubscriber_Create(nullptr, nullptr, "", nullptr, nullptr, nullptr);
 (void) SilKit_DataPublisher_Publish(nullptr, nullptr);
+(void) SilKit_DataPublisher_PublishBatch(nullptr, nullptr, 0);
 (void) SilKit_DataSubscriber_SetDataMessageHandler(nullptr, nullptr, nullptr);
 (void) SilKit_EthernetController_Create(nullptr, nullptr, "", "");
 (void) SilKit_EthernetController_Activate(nullptr);
@@ -64,6 +66,7 @@ SilKit_HandlerId id;
 (void)
 (void) SilKit_EthernetController_RemoveBitrateChangeHandler(nullptr, id);
 (void) SilKit_EthernetController_SendFrame(nullptr, nullptr, nullptr);
+(void) SilKit_EthernetController_SendFrames(nullptr, nullptr, 0, nullptr);
 (void) SilKit_FlexrayController_Create(nullptr,nullptr, nullptr, nullptr);
 (void) SilKit_FlexrayController_Configure(nullptr, nullptr);
 (void) SilKit_FlexrayController_ReconfigureTxBuffer(nullptr, 0, nullptr);
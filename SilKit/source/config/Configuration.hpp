@@ -22,6 +22,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -59,6 +61,19 @@ inline auto to_string(NetworkType networkType) -> std::string;
 //  Logging service
 // ================================================================================
 
+//! \brief Batching of the log messages sent by a Remote sink
+struct RemoteLogBatching
+{
+    //! Send LogMsgBatch messages instead of one LogMsg per log entry
+    bool enabled{ false };
+    //! A batch is sent as soon as it holds this many entries
+    uint32_t maxBatchSize{ 64 };
+    //! A non-empty batch is sent at least this often
+    std::chrono::milliseconds flushInterval{ 100 };
+    //! Log entries exceeding this rate are dropped and counted; 0 means unlimited
+    uint32_t maxMessagesPerSecond{ 0 };
+};
+
 struct Sink
 {
     enum class Type : uint8_t
@@ -71,6 +86,7 @@ struct Sink
     Type type{ Type::Remote };
     Services::Logging::Level level{ Services::Logging::Level::Info };
     std::string logName;
+    RemoteLogBatching batching;
 };
 
 //! \brief Logger service
@@ -78,6 +94,8 @@ struct Logging
 {
     bool logFromRemotes{ false };
     Services::Logging::Level flushLevel{ Services::Logging::Level::Off };
+    //! Write the Stdout and File sinks from a background thread
+    bool async{ false };
     std::vector<Sink> sinks;
 };
 
@@ -95,9 +113,17 @@ struct TraceSink
         Mdf4File
     };
 
+    //! What happens to trace messages if the sink cannot write them as fast as they are traced
+    enum class OverflowPolicy
+    {
+        Block, //!< the traced message waits until the sink has room for it
+        Drop //!< the traced message is dropped
+    };
+
     Type type{ Type::Undefined };
     std::string name;
     std::string outputPath;
+    OverflowPolicy overflowPolicy{ OverflowPolicy::Block };
 };
 
 struct TraceSource
@@ -155,6 +181,7 @@ struct SimulatedNetwork
     Replay replay;
 };
 
+inline bool operator==(const RemoteLogBatching& lhs, const RemoteLogBatching& rhs);
 inline bool operator==(const Sink& lhs, const Sink& rhs);
 inline bool operator==(const Logging& lhs, const Logging& rhs);
 inline bool operator==(const TraceSink& lhs, const TraceSink& rhs);
@@ -201,17 +228,27 @@ auto to_string(NetworkType networkType) -> std::string
     }
 }
 
+bool operator==(const RemoteLogBatching& lhs, const RemoteLogBatching& rhs)
+{
+    return lhs.enabled == rhs.enabled
+        && lhs.maxBatchSize == rhs.maxBatchSize
+        && lhs.flushInterval == rhs.flushInterval
+        && lhs.maxMessagesPerSecond == rhs.maxMessagesPerSecond;
+}
+
 bool operator==(const Sink& lhs, const Sink& rhs)
 {
     return lhs.type == rhs.type
         && lhs.level == rhs.level
-        && lhs.logName == rhs.logName;
+        && lhs.logName == rhs.logName
+        && lhs.batching == rhs.batching;
 }
 
 bool operator==(const Logging& lhs, const Logging& rhs)
 {
     return lhs.logFromRemotes == rhs.logFromRemotes
         && lhs.flushLevel == rhs.flushLevel
+        && lhs.async == rhs.async
         && lhs.sinks == rhs.sinks;
 }
 
@@ -219,7 +256,8 @@ bool operator==(const TraceSink& lhs, const TraceSink& rhs)
 {
     return lhs.name == rhs.name
         && lhs.outputPath == rhs.outputPath
-        && lhs.type == rhs.type;
+        && lhs.type == rhs.type
+        && lhs.overflowPolicy == rhs.overflowPolicy;
 }
 
 bool operator==(const TraceSource& lhs, const TraceSource& rhs)
@@ -57,6 +57,13 @@ struct InternalController
 //  CAN controller service
 // ================================================================================
 
+//! \brief Acceptance filter rule of a CAN controller: a frame is accepted if (canId & mask) == (id & mask)
+struct CanAcceptanceFilter
+{
+    uint32_t id{0};
+    uint32_t mask{0};
+};
+
 //! \brief CAN controller service
 struct CanController
 {
@@ -67,6 +74,9 @@ struct CanController
 
     std::vector<std::string> useTraceSinks;
     Replay replay;
+
+    //! \brief Senders may skip frames matching none of the filters; empty accepts all frames
+    std::vector<CanAcceptanceFilter> acceptanceFilters;
 };
 
 // ================================================================================
@@ -83,6 +93,9 @@ struct LinController
 
     std::vector<std::string> useTraceSinks;
     Replay replay;
+
+    //! \brief Senders may skip transmissions of other LIN IDs; empty accepts all IDs
+    std::vector<uint8_t> acceptedIds;
 };
 
 // ================================================================================
@@ -99,6 +112,10 @@ struct EthernetController
 
     std::vector<std::string> useTraceSinks;
     Replay replay;
+
+    //! \brief Senders may skip unicast frames to other destination MACs ("xx:xx:xx:xx:xx:xx"); empty accepts all
+    //!        frames. Broadcast and multicast frames are always accepted.
+    std::vector<std::string> acceptedDestinationMacs;
 };
 
 // ================================================================================
@@ -125,6 +142,23 @@ struct FlexrayController
 //  Data Publisher/Subscriber service
 // ================================================================================
 
+//! \brief Aggregation of the messages published by a DataPublisher
+struct DataPublisherAggregation
+{
+    enum class Mode : uint8_t
+    {
+        Off, //!< every Publish call is sent as its own message
+        SimulationStep, //!< messages published during a simulation step are sent together at its end
+        TimeWindow //!< messages are sent together once the time window after the first one has passed
+    };
+
+    Mode mode{ Mode::Off };
+    //! Length of the aggregation window in TimeWindow mode
+    std::chrono::milliseconds timeWindow{ 1 };
+    //! A batch is sent as soon as it holds this many messages
+    uint32_t maxBatchSize{ 256 };
+};
+
 //! \brief Publisher configuration for the Data communication service
 struct DataPublisher
 {
@@ -136,6 +170,9 @@ struct DataPublisher
     //! \brief History length of a DataPublisher.
     SilKit::Util::Optional<size_t> history{ 0 };
 
+    //! \brief Sending several published messages in one network message.
+    DataPublisherAggregation aggregation;
+
     std::vector<std::string> useTraceSinks;
     Replay replay;
 };
@@ -229,6 +266,15 @@ struct Middleware
     std::vector<std::string> acceptorUris{}; //!< Explicit list of endpoints this participant will accept connections on.
     //! By default, communication with other participants using the registry as a proxy is enabled.
     bool registryAsFallbackProxy{ true };
+    //! Drain the sending queue of a peer into a single gather-write instead of writing each message separately.
+    bool enableSendCoalescing{ false };
+    int sendCoalescingMaxMessages{ 1024 }; //!< Upper bound of messages per gather-write. Values <= 0 disable the limit.
+    int sendCoalescingMaxBytes{ 1024 * 1024 }; //!< Upper bound of bytes per gather-write. Values <= 0 disable the limit.
+    //! Exchange messages with participants on the same host via shared memory (requires local-domain sockets).
+    bool enableSharedMemory{ false };
+    int sharedMemoryBufferSize{ 1024 * 1024 }; //!< Size of the shared-memory ring buffer per direction in bytes.
+    //! Number of threads which run the network I/O. With more than one thread, the peers are served concurrently.
+    int ioWorkerThreads{ 1 };
 };
 
 // ================================================================================
@@ -272,10 +318,12 @@ struct ParticipantConfiguration
     Middleware middleware;
 };
 
+bool operator==(const CanAcceptanceFilter& lhs, const CanAcceptanceFilter& rhs);
 bool operator==(const CanController& lhs, const CanController& rhs);
 bool operator==(const LinController& lhs, const LinController& rhs);
 bool operator==(const EthernetController& lhs, const EthernetController& rhs);
 bool operator==(const FlexrayController& lhs, const FlexrayController& rhs);
+bool operator==(const DataPublisherAggregation& lhs, const DataPublisherAggregation& rhs);
 bool operator==(const DataPublisher& lhs, const DataPublisher& rhs);
 bool operator==(const DataSubscriber& lhs, const DataSubscriber& rhs);
 bool operator==(const RpcServer& lhs, const RpcServer& rhs);
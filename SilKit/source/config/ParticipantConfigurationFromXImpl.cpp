@@ -77,21 +77,26 @@ auto Parse(const std::string& text) -> SilKit::Config::ParticipantConfiguration
 // ================================================================================
 //  Implementation data types
 // ================================================================================
+bool operator==(const CanAcceptanceFilter& lhs, const CanAcceptanceFilter& rhs)
+{
+    return lhs.id == rhs.id && lhs.mask == rhs.mask;
+}
+
 bool operator==(const CanController& lhs, const CanController& rhs)
 {
-    return lhs.name == rhs.name && lhs.network == rhs.network;
+    return lhs.name == rhs.name && lhs.network == rhs.network && lhs.acceptanceFilters == rhs.acceptanceFilters;
 }
 
 bool operator==(const LinController& lhs, const LinController& rhs)
 {
     return lhs.name == rhs.name && lhs.network == rhs.network && lhs.useTraceSinks == rhs.useTraceSinks
-           && lhs.replay == rhs.replay;
+           && lhs.replay == rhs.replay && lhs.acceptedIds == rhs.acceptedIds;
 }
 
 bool operator==(const EthernetController& lhs, const EthernetController& rhs)
 {
     return lhs.name == rhs.name && lhs.network == rhs.network && lhs.useTraceSinks == rhs.useTraceSinks
-           && lhs.replay == rhs.replay;
+           && lhs.replay == rhs.replay && lhs.acceptedDestinationMacs == rhs.acceptedDestinationMacs;
 }
 
 bool operator==(const FlexrayController& lhs, const FlexrayController& rhs)
@@ -101,9 +106,15 @@ bool operator==(const FlexrayController& lhs, const FlexrayController& rhs)
            && lhs.replay == rhs.replay;
 }
 
+bool operator==(const DataPublisherAggregation& lhs, const DataPublisherAggregation& rhs)
+{
+    return lhs.mode == rhs.mode && lhs.timeWindow == rhs.timeWindow && lhs.maxBatchSize == rhs.maxBatchSize;
+}
+
 bool operator==(const DataPublisher& lhs, const DataPublisher& rhs)
 {
-    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay;
+    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay
+           && lhs.aggregation == rhs.aggregation;
 }
 
 bool operator==(const DataSubscriber& lhs, const DataSubscriber& rhs)
@@ -142,7 +153,13 @@ bool operator==(const Middleware& lhs, const Middleware& rhs)
     return lhs.registryUri == rhs.registryUri && lhs.connectAttempts == rhs.connectAttempts
            && lhs.enableDomainSockets == rhs.enableDomainSockets && lhs.tcpNoDelay == rhs.tcpNoDelay
            && lhs.tcpQuickAck == rhs.tcpQuickAck && lhs.tcpReceiveBufferSize == rhs.tcpReceiveBufferSize
-           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris;
+           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris
+           && lhs.enableSendCoalescing == rhs.enableSendCoalescing
+           && lhs.sendCoalescingMaxMessages == rhs.sendCoalescingMaxMessages
+           && lhs.sendCoalescingMaxBytes == rhs.sendCoalescingMaxBytes
+           && lhs.enableSharedMemory == rhs.enableSharedMemory
+           && lhs.sharedMemoryBufferSize == rhs.sharedMemoryBufferSize
+           && lhs.ioWorkerThreads == rhs.ioWorkerThreads;
 }
 
 bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfiguration& rhs)
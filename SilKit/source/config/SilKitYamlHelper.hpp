@@ -70,6 +70,7 @@ struct Converter
 // Other types used for parsing, required in ConversionError for helpful error messages
 DEFINE_SILKIT_PARSE_TYPE_NAME(int16_t);
 DEFINE_SILKIT_PARSE_TYPE_NAME(uint16_t);
+DEFINE_SILKIT_PARSE_TYPE_NAME(uint32_t);
 DEFINE_SILKIT_PARSE_TYPE_NAME(uint64_t);
 DEFINE_SILKIT_PARSE_TYPE_NAME(int64_t);
 DEFINE_SILKIT_PARSE_TYPE_NAME(int8_t);
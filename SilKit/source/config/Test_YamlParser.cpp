@@ -181,6 +181,7 @@ Logging:
     Level: Critical
     LogName: MyLog1
   FlushLevel: Critical
+  Async: true
   LogFromRemotes: false
 HealthCheck:
   SoftResponseTimeout: 500
@@ -242,6 +243,7 @@ TEST_F(YamlParserTest, yaml_complete_configuration)
     EXPECT_TRUE(config.logging.sinks.at(0).type == Sink::Type::File);
     EXPECT_TRUE(config.logging.sinks.at(0).level == SilKit::Services::Logging::Level::Critical);
     EXPECT_TRUE(config.logging.sinks.at(0).logName == "MyLog1");
+    EXPECT_TRUE(config.logging.async);
 
     EXPECT_TRUE(config.healthCheck.softResponseTimeout.value() == 500ms);
     EXPECT_TRUE(config.healthCheck.hardResponseTimeout.value() == 5000ms);
@@ -362,7 +364,13 @@ TEST_F(YamlParserTest, middleware_convert)
             "TcpSendBufferSize": 3456,
             "TcpReceiveBufferSize": 3456,
             "EnableDomainSockets": false,
-            "RegistryAsFallbackProxy": false
+            "RegistryAsFallbackProxy": false,
+            "EnableSendCoalescing": true,
+            "SendCoalescingMaxMessages": 512,
+            "SendCoalescingMaxBytes": 65536,
+            "EnableSharedMemory": true,
+            "SharedMemoryBufferSize": 262144,
+            "IoWorkerThreads": 4
         }
     )");
     auto config = node.as<Middleware>();
@@ -375,6 +383,138 @@ TEST_F(YamlParserTest, middleware_convert)
     EXPECT_EQ(config.tcpSendBufferSize, 3456);
     EXPECT_EQ(config.tcpReceiveBufferSize, 3456);
     EXPECT_EQ(config.registryAsFallbackProxy, false);
+    EXPECT_EQ(config.enableSendCoalescing, true);
+    EXPECT_EQ(config.sendCoalescingMaxMessages, 512);
+    EXPECT_EQ(config.sendCoalescingMaxBytes, 65536);
+    EXPECT_EQ(config.enableSharedMemory, true);
+    EXPECT_EQ(config.sharedMemoryBufferSize, 262144);
+    EXPECT_EQ(config.ioWorkerThreads, 4);
+}
+
+TEST_F(YamlParserTest, controller_acceptance_filters_convert)
+{
+    auto node = YAML::Load(R"(
+        {
+            "CanControllers": [
+                {"Name": "CAN1", "AcceptanceFilters": [{"Id": 256, "Mask": 2032}, {"Id": 1, "Mask": 2047}]}
+            ],
+            "LinControllers": [
+                {"Name": "LIN1", "AcceptedIds": [16, 63]}
+            ],
+            "EthernetControllers": [
+                {"Name": "ETH1", "AcceptedDestinationMacs": ["02:00:00:00:00:01"]}
+            ]
+        }
+    )");
+    auto config = node.as<ParticipantConfiguration>();
+    ASSERT_EQ(config.canControllers.size(), 1u);
+    ASSERT_EQ(config.canControllers.at(0).acceptanceFilters.size(), 2u);
+    EXPECT_EQ(config.canControllers.at(0).acceptanceFilters.at(0).id, 256u);
+    EXPECT_EQ(config.canControllers.at(0).acceptanceFilters.at(0).mask, 2032u);
+    ASSERT_EQ(config.linControllers.size(), 1u);
+    EXPECT_EQ(config.linControllers.at(0).acceptedIds, (std::vector<uint8_t>{16, 63}));
+    ASSERT_EQ(config.ethernetControllers.size(), 1u);
+    EXPECT_EQ(config.ethernetControllers.at(0).acceptedDestinationMacs,
+              std::vector<std::string>{"02:00:00:00:00:01"});
+
+    // roundtrip
+    auto config2 = to_yaml(config).as<ParticipantConfiguration>();
+    EXPECT_EQ(config, config2);
+
+    auto invalidLinId = YAML::Load(R"({"Name": "LIN1", "AcceptedIds": [64]})");
+    EXPECT_THROW(invalidLinId.as<LinController>(), YAML::BadConversion);
+}
+
+TEST_F(YamlParserTest, trace_sink_overflow_policy_convert)
+{
+    auto node = YAML::Load(R"(
+        {
+            "Tracing": {
+                "TraceSinks": [
+                    {"Name": "Sink1", "Type": "PcapFile", "OutputPath": "out1.pcap"},
+                    {"Name": "Sink2", "Type": "PcapFile", "OutputPath": "out2.pcap", "OverflowPolicy": "Drop"}
+                ]
+            }
+        }
+    )");
+    auto config = node.as<ParticipantConfiguration>();
+    ASSERT_EQ(config.tracing.traceSinks.size(), 2u);
+    EXPECT_EQ(config.tracing.traceSinks.at(0).overflowPolicy, TraceSink::OverflowPolicy::Block);
+    EXPECT_EQ(config.tracing.traceSinks.at(1).overflowPolicy, TraceSink::OverflowPolicy::Drop);
+
+    // roundtrip
+    for (const auto& sink : config.tracing.traceSinks)
+    {
+        EXPECT_EQ(to_yaml(sink).as<TraceSink>(), sink);
+    }
+
+    auto invalidPolicy = YAML::Load(R"({"Name": "Sink1", "Type": "PcapFile", "OutputPath": "out.pcap", "OverflowPolicy": "Wait"})");
+    EXPECT_THROW(invalidPolicy.as<TraceSink>(), YAML::BadConversion);
+}
+
+TEST_F(YamlParserTest, remote_sink_batching_convert)
+{
+    auto node = YAML::Load(R"(
+        {
+            "Logging": {
+                "Sinks": [
+                    {"Type": "Remote"},
+                    {"Type": "Remote", "Batching": {"Enabled": true, "MaxBatchSize": 16, "FlushInterval": 50, "MaxMessagesPerSecond": 200}}
+                ]
+            }
+        }
+    )");
+    auto config = node.as<ParticipantConfiguration>();
+    ASSERT_EQ(config.logging.sinks.size(), 2u);
+    EXPECT_EQ(config.logging.sinks.at(0).batching, RemoteLogBatching{});
+    const auto& batching = config.logging.sinks.at(1).batching;
+    EXPECT_TRUE(batching.enabled);
+    EXPECT_EQ(batching.maxBatchSize, 16u);
+    EXPECT_EQ(batching.flushInterval, 50ms);
+    EXPECT_EQ(batching.maxMessagesPerSecond, 200u);
+
+    // roundtrip
+    for (const auto& sink : config.logging.sinks)
+    {
+        EXPECT_EQ(to_yaml(sink).as<Sink>(), sink);
+    }
+
+    auto batchingOnFileSink = YAML::Load(R"({"Type": "File", "LogName": "log", "Batching": {"Enabled": true}})");
+    EXPECT_THROW(batchingOnFileSink.as<Sink>(), YAML::BadConversion);
+    auto emptyBatches = YAML::Load(R"({"Type": "Remote", "Batching": {"Enabled": true, "MaxBatchSize": 0}})");
+    EXPECT_THROW(emptyBatches.as<Sink>(), YAML::BadConversion);
+}
+
+TEST_F(YamlParserTest, data_publisher_aggregation)
+{
+    auto node = YAML::Load(R"(
+        {
+            "DataPublishers": [
+                {"Name": "Plain"},
+                {"Name": "PerStep", "Aggregation": {"Mode": "SimulationStep"}},
+                {"Name": "Windowed", "Aggregation": {"Mode": "TimeWindow", "TimeWindow": 5, "MaxBatchSize": 32}}
+            ]
+        }
+    )");
+    auto config = node.as<ParticipantConfiguration>();
+    ASSERT_EQ(config.dataPublishers.size(), 3u);
+    EXPECT_EQ(config.dataPublishers.at(0).aggregation, DataPublisherAggregation{});
+    EXPECT_EQ(config.dataPublishers.at(1).aggregation.mode, DataPublisherAggregation::Mode::SimulationStep);
+    const auto& windowed = config.dataPublishers.at(2).aggregation;
+    EXPECT_EQ(windowed.mode, DataPublisherAggregation::Mode::TimeWindow);
+    EXPECT_EQ(windowed.timeWindow, 5ms);
+    EXPECT_EQ(windowed.maxBatchSize, 32u);
+
+    // roundtrip
+    for (const auto& publisher : config.dataPublishers)
+    {
+        EXPECT_EQ(to_yaml(publisher).as<DataPublisher>().aggregation, publisher.aggregation);
+    }
+
+    auto unknownMode = YAML::Load(R"({"Name": "P", "Aggregation": {"Mode": "Sometimes"}})");
+    EXPECT_THROW(unknownMode.as<DataPublisher>(), YAML::BadConversion);
+    auto emptyBatches = YAML::Load(R"({"Name": "P", "Aggregation": {"Mode": "TimeWindow", "MaxBatchSize": 0}})");
+    EXPECT_THROW(emptyBatches.as<DataPublisher>(), YAML::BadConversion);
 }
 
 TEST_F(YamlParserTest, map_serdes)
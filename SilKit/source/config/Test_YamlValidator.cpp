@@ -67,6 +67,25 @@ TEST_F(YamlValidatorTest, validate_without_warnings)
     cfg.middleware.tcpQuickAck = true;
     cfg.middleware.tcpReceiveBufferSize = 1234;
     cfg.middleware.tcpSendBufferSize = 1234;
+    cfg.middleware.enableSendCoalescing = true;
+    cfg.middleware.sendCoalescingMaxMessages = 1234;
+    cfg.middleware.sendCoalescingMaxBytes = 1234;
+    cfg.middleware.enableSharedMemory = true;
+    cfg.middleware.sharedMemoryBufferSize = 1234;
+    cfg.middleware.ioWorkerThreads = 4;
+
+    CanController canController;
+    canController.name = "CAN1";
+    canController.acceptanceFilters.push_back(CanAcceptanceFilter{0x100, 0x7F0});
+    cfg.canControllers.push_back(canController);
+    LinController linController;
+    linController.name = "LIN1";
+    linController.acceptedIds = {16, 63};
+    cfg.linControllers.push_back(linController);
+    EthernetController ethernetController;
+    ethernetController.name = "ETH1";
+    ethernetController.acceptedDestinationMacs = {"02:00:00:00:00:01"};
+    cfg.ethernetControllers.push_back(ethernetController);
 
     std::stringstream stream;
     auto jsonString = yaml_to_json(to_yaml(cfg));
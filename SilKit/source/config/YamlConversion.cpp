@@ -82,6 +82,7 @@ Node Converter::encode(const Logging& obj)
 
     non_default_encode(obj.logFromRemotes, node, "LogFromRemotes", defaultLogger.logFromRemotes);
     non_default_encode(obj.flushLevel, node, "FlushLevel", defaultLogger.flushLevel);
+    non_default_encode(obj.async, node, "Async", defaultLogger.async);
     // ParticipantConfiguration.schema.json: this is a required property:
     node["Sinks"] = obj.sinks;
 
@@ -92,6 +93,7 @@ bool Converter::decode(const Node& node, Logging& obj)
 {
     optional_decode(obj.logFromRemotes, node, "LogFromRemotes");
     optional_decode(obj.flushLevel, node, "FlushLevel");
+    optional_decode(obj.async, node, "Async");
     optional_decode(obj.sinks, node, "Sinks");
     return true;
 }
@@ -105,6 +107,7 @@ Node Converter::encode(const Sink& obj)
     node["Type"] = obj.type;
     non_default_encode(obj.level, node, "Level", defaultSink.level);
     non_default_encode(obj.logName, node, "LogName", defaultSink.logName);
+    non_default_encode(obj.batching, node, "Batching", defaultSink.batching);
     return node;
 }
 template<>
@@ -121,6 +124,43 @@ bool Converter::decode(const Node& node, Sink& obj)
         }
         obj.logName = parse_as<std::string>(node["LogName"]);
     }
+    if (node["Batching"])
+    {
+        if (obj.type != Sink::Type::Remote)
+        {
+            throw ConversionError(node, "Batching is only supported by sinks of type Sink::Type::Remote");
+        }
+        obj.batching = parse_as<RemoteLogBatching>(node["Batching"]);
+    }
+    return true;
+}
+
+template<>
+Node Converter::encode(const RemoteLogBatching& obj)
+{
+    static const RemoteLogBatching defaultObj{};
+    Node node;
+    node["Enabled"] = obj.enabled;
+    non_default_encode(obj.maxBatchSize, node, "MaxBatchSize", defaultObj.maxBatchSize);
+    non_default_encode(obj.flushInterval, node, "FlushInterval", defaultObj.flushInterval);
+    non_default_encode(obj.maxMessagesPerSecond, node, "MaxMessagesPerSecond", defaultObj.maxMessagesPerSecond);
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, RemoteLogBatching& obj)
+{
+    optional_decode(obj.enabled, node, "Enabled");
+    optional_decode(obj.maxBatchSize, node, "MaxBatchSize");
+    optional_decode(obj.flushInterval, node, "FlushInterval");
+    optional_decode(obj.maxMessagesPerSecond, node, "MaxMessagesPerSecond");
+    if (obj.maxBatchSize == 0)
+    {
+        throw ConversionError(node, "RemoteLogBatching requires a MaxBatchSize greater than zero");
+    }
+    if (obj.flushInterval.count() <= 0)
+    {
+        throw ConversionError(node, "RemoteLogBatching requires a FlushInterval greater than zero");
+    }
     return true;
 }
 
@@ -318,6 +358,22 @@ bool Converter::decode(const Node& node, Replay::Direction& obj)
     return true;
 }
 
+template<>
+Node Converter::encode(const CanAcceptanceFilter& obj)
+{
+    Node node;
+    node["Id"] = obj.id;
+    node["Mask"] = obj.mask;
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, CanAcceptanceFilter& obj)
+{
+    obj.id = parse_as<uint32_t>(node["Id"]);
+    obj.mask = parse_as<uint32_t>(node["Mask"]);
+    return true;
+}
+
 template<>
 Node Converter::encode(const CanController& obj)
 {
@@ -327,6 +383,7 @@ Node Converter::encode(const CanController& obj)
     optional_encode(obj.network, node, "Network");
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
+    optional_encode(obj.acceptanceFilters, node, "AcceptanceFilters");
     return node;
 }
 template<>
@@ -336,6 +393,7 @@ bool Converter::decode(const Node& node, CanController& obj)
     optional_decode(obj.network, node, "Network");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
+    optional_decode(obj.acceptanceFilters, node, "AcceptanceFilters");
     return true;
 }
 
@@ -348,6 +406,11 @@ Node Converter::encode(const LinController& obj)
     optional_encode(obj.network, node, "Network");
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
+    // Encode IDs as int values; uint8_t would be interpreted as a character
+    for (auto&& id : obj.acceptedIds)
+    {
+        node["AcceptedIds"].push_back(static_cast<int>(id));
+    }
     return node;
 }
 template<>
@@ -357,6 +420,18 @@ bool Converter::decode(const Node& node, LinController& obj)
     optional_decode(obj.network, node, "Network");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
+    if (node["AcceptedIds"])
+    {
+        for (auto&& idNode : node["AcceptedIds"])
+        {
+            const auto id = parse_as<int>(idNode);
+            if (id < 0 || id > 63)
+            {
+                throw ConversionError(idNode, "LIN ID " + std::to_string(id) + " is out of range [0, 63].");
+            }
+            obj.acceptedIds.push_back(static_cast<uint8_t>(id));
+        }
+    }
     return true;
 }
 
@@ -369,6 +444,7 @@ Node Converter::encode(const EthernetController& obj)
     optional_encode(obj.network, node, "Network");
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
+    optional_encode(obj.acceptedDestinationMacs, node, "AcceptedDestinationMacs");
 
     return node;
 }
@@ -379,6 +455,7 @@ bool Converter::decode(const Node& node, EthernetController& obj)
     optional_decode(obj.network, node, "Network");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
+    optional_decode(obj.acceptedDestinationMacs, node, "AcceptedDestinationMacs");
     return true;
 }
 
@@ -674,6 +751,70 @@ bool Converter::decode(const Node& node, FlexrayController& obj)
     return true;
 }
 
+template <>
+Node Converter::encode(const DataPublisherAggregation::Mode& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case DataPublisherAggregation::Mode::Off:
+        node = "Off";
+        break;
+    case DataPublisherAggregation::Mode::SimulationStep:
+        node = "SimulationStep";
+        break;
+    case DataPublisherAggregation::Mode::TimeWindow:
+        node = "TimeWindow";
+        break;
+    default:
+        throw ConfigurationError{"Unknown DataPublisherAggregation Mode"};
+    }
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, DataPublisherAggregation::Mode& obj)
+{
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Off")
+        obj = DataPublisherAggregation::Mode::Off;
+    else if (str == "SimulationStep")
+        obj = DataPublisherAggregation::Mode::SimulationStep;
+    else if (str == "TimeWindow")
+        obj = DataPublisherAggregation::Mode::TimeWindow;
+    else
+    {
+        throw ConversionError(node, "Unknown DataPublisherAggregation::Mode: " + str + ".");
+    }
+    return true;
+}
+
+template <>
+Node Converter::encode(const DataPublisherAggregation& obj)
+{
+    static const DataPublisherAggregation defaultObj{};
+    Node node;
+    node["Mode"] = obj.mode;
+    non_default_encode(obj.timeWindow, node, "TimeWindow", defaultObj.timeWindow);
+    non_default_encode(obj.maxBatchSize, node, "MaxBatchSize", defaultObj.maxBatchSize);
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, DataPublisherAggregation& obj)
+{
+    optional_decode(obj.mode, node, "Mode");
+    optional_decode(obj.timeWindow, node, "TimeWindow");
+    optional_decode(obj.maxBatchSize, node, "MaxBatchSize");
+    if (obj.maxBatchSize == 0)
+    {
+        throw ConversionError(node, "DataPublisher Aggregation requires a MaxBatchSize greater than zero");
+    }
+    if (obj.timeWindow.count() <= 0)
+    {
+        throw ConversionError(node, "DataPublisher Aggregation requires a TimeWindow greater than zero");
+    }
+    return true;
+}
+
 template <>
 Node Converter::encode(const DataPublisher& obj)
 {
@@ -682,6 +823,7 @@ Node Converter::encode(const DataPublisher& obj)
     node["Name"] = obj.name;
     optional_encode(obj.topic, node, "Topic");
     //optional_encode(obj.history, node, "History");
+    non_default_encode(obj.aggregation, node, "Aggregation", defaultObj.aggregation);
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
     return node;
@@ -692,6 +834,7 @@ bool Converter::decode(const Node& node, DataPublisher& obj)
     obj.name = parse_as<std::string>(node["Name"]);
     optional_decode(obj.topic, node, "Topic");
     //optional_decode(obj.history, node, "Replay");
+    optional_decode(obj.aggregation, node, "Aggregation");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
     return true;
@@ -800,6 +943,10 @@ Node Converter::encode(const TraceSink& obj)
     node["Name"] = obj.name;
     node["Type"] = obj.type;
     node["OutputPath"] = obj.outputPath;
+    if (obj.overflowPolicy != TraceSink::OverflowPolicy::Block)
+    {
+        node["OverflowPolicy"] = obj.overflowPolicy;
+    }
     // Only serialize if disabled
     //if (!obj.enabled)
     //{
@@ -814,6 +961,7 @@ bool Converter::decode(const Node& node, TraceSink& obj)
     obj.name = parse_as<std::string>(node["Name"]);
     obj.type = parse_as<decltype(obj.type)>(node["Type"]);
     obj.outputPath = parse_as<decltype(obj.outputPath)>(node["OutputPath"]);
+    optional_decode(obj.overflowPolicy, node, "OverflowPolicy");
     //if (node["Enabled"])
     //{
     //    obj.enabled = parse_as<decltype(obj.enabled)>(node["Enabled"]);
@@ -863,6 +1011,38 @@ bool Converter::decode(const Node& node, TraceSink::Type& obj)
     return true;
 }
 
+template<>
+Node Converter::encode(const TraceSink::OverflowPolicy& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case TraceSink::OverflowPolicy::Block:
+        node = "Block";
+        break;
+    case TraceSink::OverflowPolicy::Drop:
+        node = "Drop";
+        break;
+    default:
+        throw ConfigurationError{ "Unknown TraceSink OverflowPolicy" };
+    }
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, TraceSink::OverflowPolicy& obj)
+{
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Block")
+        obj = TraceSink::OverflowPolicy::Block;
+    else if (str == "Drop")
+        obj = TraceSink::OverflowPolicy::Drop;
+    else
+    {
+        throw ConversionError(node, "Unknown TraceSink::OverflowPolicy: " + str + ".");
+    }
+    return true;
+}
+
 template<>
 Node Converter::encode(const TraceSource& obj)
 {
@@ -957,6 +1137,13 @@ Node Converter::encode(const Middleware& obj)
     non_default_encode(obj.enableDomainSockets, node, "EnableDomainSockets", defaultObj.enableDomainSockets);
     non_default_encode(obj.acceptorUris, node, "acceptorUris", defaultObj.acceptorUris);
     non_default_encode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy", defaultObj.registryAsFallbackProxy);
+    non_default_encode(obj.enableSendCoalescing, node, "EnableSendCoalescing", defaultObj.enableSendCoalescing);
+    non_default_encode(obj.sendCoalescingMaxMessages, node, "SendCoalescingMaxMessages",
+                       defaultObj.sendCoalescingMaxMessages);
+    non_default_encode(obj.sendCoalescingMaxBytes, node, "SendCoalescingMaxBytes", defaultObj.sendCoalescingMaxBytes);
+    non_default_encode(obj.enableSharedMemory, node, "EnableSharedMemory", defaultObj.enableSharedMemory);
+    non_default_encode(obj.sharedMemoryBufferSize, node, "SharedMemoryBufferSize", defaultObj.sharedMemoryBufferSize);
+    non_default_encode(obj.ioWorkerThreads, node, "IoWorkerThreads", defaultObj.ioWorkerThreads);
     return node;
 }
 template<>
@@ -971,6 +1158,12 @@ bool Converter::decode(const Node& node, Middleware& obj)
     optional_decode(obj.enableDomainSockets, node, "EnableDomainSockets");
     optional_decode(obj.acceptorUris, node, "AcceptorUris");
     optional_decode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy");
+    optional_decode(obj.enableSendCoalescing, node, "EnableSendCoalescing");
+    optional_decode(obj.sendCoalescingMaxMessages, node, "SendCoalescingMaxMessages");
+    optional_decode(obj.sendCoalescingMaxBytes, node, "SendCoalescingMaxBytes");
+    optional_decode(obj.enableSharedMemory, node, "EnableSharedMemory");
+    optional_decode(obj.sharedMemoryBufferSize, node, "SharedMemoryBufferSize");
+    optional_decode(obj.ioWorkerThreads, node, "IoWorkerThreads");
     return true;
 }
 
@@ -40,6 +40,7 @@ DEFINE_SILKIT_CONVERT(std::chrono::nanoseconds);
 
 DEFINE_SILKIT_CONVERT(Logging);
 DEFINE_SILKIT_CONVERT(Sink);
+DEFINE_SILKIT_CONVERT(RemoteLogBatching);
 DEFINE_SILKIT_CONVERT(Sink::Type);
 DEFINE_SILKIT_CONVERT(SilKit::Services::Logging::Level);
 
@@ -47,6 +48,7 @@ DEFINE_SILKIT_CONVERT(MdfChannel);
 DEFINE_SILKIT_CONVERT(Replay);
 DEFINE_SILKIT_CONVERT(Replay::Direction);
 
+DEFINE_SILKIT_CONVERT(CanAcceptanceFilter);
 DEFINE_SILKIT_CONVERT(CanController);
 
 DEFINE_SILKIT_CONVERT(LinController);
@@ -63,6 +65,8 @@ DEFINE_SILKIT_CONVERT(FlexrayController);
 
 DEFINE_SILKIT_CONVERT(SilKit::Services::MatchingLabel::Kind);
 DEFINE_SILKIT_CONVERT(SilKit::Services::MatchingLabel);
+DEFINE_SILKIT_CONVERT(DataPublisherAggregation);
+DEFINE_SILKIT_CONVERT(DataPublisherAggregation::Mode);
 DEFINE_SILKIT_CONVERT(DataPublisher);
 DEFINE_SILKIT_CONVERT(DataSubscriber);
 DEFINE_SILKIT_CONVERT(RpcServer);
@@ -73,6 +77,7 @@ DEFINE_SILKIT_CONVERT(HealthCheck);
 DEFINE_SILKIT_CONVERT(Tracing);
 DEFINE_SILKIT_CONVERT(TraceSink);
 DEFINE_SILKIT_CONVERT(TraceSink::Type);
+DEFINE_SILKIT_CONVERT(TraceSink::OverflowPolicy);
 DEFINE_SILKIT_CONVERT(TraceSource);
 DEFINE_SILKIT_CONVERT(TraceSource::Type);
 
@@ -46,6 +46,7 @@ auto MakeYamlSchema() -> YamlSchemaElem
             {"Name"},
             {"OutputPath"},
             {"Type"},
+            {"OverflowPolicy"},
         }
     );
     YamlSchemaElem traceSources("TraceSources",
@@ -59,10 +60,18 @@ auto MakeYamlSchema() -> YamlSchemaElem
         {
             {"LogFromRemotes"},
             {"FlushLevel"},
+            {"Async"},
             {"Sinks", {
                     {"Type"},
                     {"Level"},
                     {"LogName"},
+                    {"Batching", {
+                            {"Enabled"},
+                            {"MaxBatchSize"},
+                            {"FlushInterval"},
+                            {"MaxMessagesPerSecond"},
+                        },
+                    },
                 },
             },
 
@@ -146,6 +155,7 @@ auto MakeYamlSchema() -> YamlSchemaElem
             {"Network"},
             {"UseTraceSinks"},
             replay,
+            {"AcceptedDestinationMacs"},
         }
     );
 
@@ -160,14 +170,20 @@ auto MakeYamlSchema() -> YamlSchemaElem
                 {"Name"},
                 {"Network"},
                 {"UseTraceSinks"},
-                replay
+                replay,
+                {"AcceptanceFilters", {
+                        {"Id"},
+                        {"Mask"},
+                    }
+                },
             }
         },
         {"LinControllers", {
                 {"Name"},
                 {"Network"},
                 {"UseTraceSinks"},
-                replay
+                replay,
+                {"AcceptedIds"},
             }
         },
         {"FlexrayControllers", flexrayControllerElements},
@@ -176,6 +192,12 @@ auto MakeYamlSchema() -> YamlSchemaElem
         {"DataPublishers", {
                 {"Name"},
                 {"Topic"},
+                {"Aggregation", {
+                        {"Mode"},
+                        {"TimeWindow"},
+                        {"MaxBatchSize"},
+                    },
+                },
                 {"UseTraceSinks"},
                 replay,
             }
@@ -224,7 +246,13 @@ auto MakeYamlSchema() -> YamlSchemaElem
                 {"TcpReceiveBufferSize"},
                 {"TcpSendBufferSize"},
                 {"EnableDomainSockets"},
-                {"AcceptorUris"}
+                {"AcceptorUris"},
+                {"EnableSendCoalescing"},
+                {"SendCoalescingMaxMessages"},
+                {"SendCoalescingMaxBytes"},
+                {"EnableSharedMemory"},
+                {"SharedMemoryBufferSize"},
+                {"IoWorkerThreads"}
             }
         }
     };
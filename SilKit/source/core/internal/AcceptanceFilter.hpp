@@ -0,0 +1,158 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#include "TypeUtils.hpp"
+
+namespace SilKit {
+namespace Core {
+
+/*! \brief A single rule of an AcceptanceFilter
+ *
+ *  A key is accepted if (key & mask) == (id & mask).
+ */
+struct AcceptanceRule
+{
+    uint64_t id{0};
+    uint64_t mask{0};
+};
+
+/*! \brief Set of rules a receiver announces to its senders
+ *
+ *  Senders skip receivers which do not accept the key of a message, e.g., the CAN ID of a frame.
+ *  An empty rule set accepts all keys.
+ */
+struct AcceptanceFilter
+{
+    std::vector<AcceptanceRule> rules;
+
+    auto AcceptsAll() const -> bool;
+    auto Accepts(uint64_t key) const -> bool;
+    //! \brief Extend this filter to also accept all keys accepted by other
+    void Merge(const AcceptanceFilter& other);
+};
+
+//! \brief Services announce an AcceptanceFilter for the messages they receive by providing GetAcceptanceFilter()
+template <typename ServiceT, typename = void>
+struct HasAcceptanceFilter : std::false_type
+{
+};
+template <typename ServiceT>
+struct HasAcceptanceFilter<ServiceT, Util::VoidT<decltype(std::declval<const ServiceT&>().GetAcceptanceFilter())>>
+    : std::true_type
+{
+};
+
+//! \brief The AcceptanceFilter of the service, or a filter accepting all keys if it does not provide one
+template <typename ServiceT>
+auto GetServiceAcceptanceFilter(const ServiceT& service) -> AcceptanceFilter;
+
+inline bool operator==(const AcceptanceRule& lhs, const AcceptanceRule& rhs);
+inline bool operator!=(const AcceptanceRule& lhs, const AcceptanceRule& rhs);
+inline bool operator==(const AcceptanceFilter& lhs, const AcceptanceFilter& rhs);
+inline bool operator!=(const AcceptanceFilter& lhs, const AcceptanceFilter& rhs);
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+namespace Detail {
+template <typename ServiceT>
+auto GetServiceAcceptanceFilter(const ServiceT& service, std::true_type) -> AcceptanceFilter
+{
+    return service.GetAcceptanceFilter();
+}
+template <typename ServiceT>
+auto GetServiceAcceptanceFilter(const ServiceT&, std::false_type) -> AcceptanceFilter
+{
+    return AcceptanceFilter{};
+}
+} // namespace Detail
+
+template <typename ServiceT>
+auto GetServiceAcceptanceFilter(const ServiceT& service) -> AcceptanceFilter
+{
+    return Detail::GetServiceAcceptanceFilter(service, HasAcceptanceFilter<ServiceT>{});
+}
+
+inline auto AcceptanceFilter::AcceptsAll() const -> bool
+{
+    return rules.empty();
+}
+
+inline auto AcceptanceFilter::Accepts(uint64_t key) const -> bool
+{
+    if (rules.empty())
+    {
+        return true;
+    }
+    return std::any_of(rules.begin(), rules.end(), [key](const AcceptanceRule& rule) {
+        return (key & rule.mask) == (rule.id & rule.mask);
+    });
+}
+
+inline void AcceptanceFilter::Merge(const AcceptanceFilter& other)
+{
+    if (AcceptsAll())
+    {
+        return;
+    }
+    if (other.AcceptsAll())
+    {
+        rules.clear();
+        return;
+    }
+    for (auto&& rule : other.rules)
+    {
+        if (std::find(rules.begin(), rules.end(), rule) == rules.end())
+        {
+            rules.push_back(rule);
+        }
+    }
+}
+
+bool operator==(const AcceptanceRule& lhs, const AcceptanceRule& rhs)
+{
+    return lhs.id == rhs.id && lhs.mask == rhs.mask;
+}
+
+bool operator!=(const AcceptanceRule& lhs, const AcceptanceRule& rhs)
+{
+    return !(lhs == rhs);
+}
+
+bool operator==(const AcceptanceFilter& lhs, const AcceptanceFilter& rhs)
+{
+    return lhs.rules == rhs.rules;
+}
+
+bool operator!=(const AcceptanceFilter& lhs, const AcceptanceFilter& rhs)
+{
+    return !(lhs == rhs);
+}
+
+} // namespace Core
+} // namespace SilKit
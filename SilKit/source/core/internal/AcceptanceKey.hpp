@@ -0,0 +1,98 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <cstdint>
+
+#include "AcceptanceFilter.hpp"
+
+#include "WireCanMessages.hpp"
+#include "WireEthernetMessages.hpp"
+#include "WireLinMessages.hpp"
+
+namespace SilKit {
+namespace Core {
+
+//! \brief Size of an Ethernet MAC address in bytes
+constexpr std::size_t EthernetMacAcceptanceKeySize = 6;
+
+//! \brief The acceptance key of an Ethernet MAC address are its six bytes in network byte order
+inline auto MakeEthernetMacAcceptanceKey(const uint8_t* mac) -> uint64_t
+{
+    uint64_t key{0};
+    for (std::size_t i = 0; i < EthernetMacAcceptanceKeySize; ++i)
+    {
+        key = (key << 8) | mac[i];
+    }
+    return key;
+}
+
+//! \brief Rule accepting all broadcast and multicast MACs, i.e., the group bit of the first byte is set
+inline auto MakeEthernetGroupMacAcceptanceRule() -> AcceptanceRule
+{
+    constexpr uint64_t groupBit = uint64_t{1} << 40;
+    return AcceptanceRule{groupBit, groupBit};
+}
+
+/*! \brief Extracts the key of a message which is matched against the AcceptanceFilter of its receivers
+ *
+ *  Messages without a specialization are always sent to all receivers.
+ */
+template <typename MsgT>
+struct AcceptanceKey
+{
+    static constexpr auto IsFilterable() -> bool { return false; }
+    static auto Get(const MsgT&) -> uint64_t { return 0; }
+};
+
+template <>
+struct AcceptanceKey<Services::Can::WireCanFrameEvent>
+{
+    static constexpr auto IsFilterable() -> bool { return true; }
+    static auto Get(const Services::Can::WireCanFrameEvent& msg) -> uint64_t { return msg.frame.canId; }
+};
+
+template <>
+struct AcceptanceKey<Services::Ethernet::WireEthernetFrameEvent>
+{
+    static constexpr auto IsFilterable() -> bool { return true; }
+    static auto Get(const Services::Ethernet::WireEthernetFrameEvent& msg) -> uint64_t
+    {
+        const auto raw = msg.frame.raw.AsSpan();
+        if (raw.size() < EthernetMacAcceptanceKeySize)
+        {
+            // Malformed frames are treated like broadcasts and reach all receivers
+            return (uint64_t{1} << 48) - 1;
+        }
+        return MakeEthernetMacAcceptanceKey(raw.data());
+    }
+};
+
+template <>
+struct AcceptanceKey<Services::Lin::LinTransmission>
+{
+    static constexpr auto IsFilterable() -> bool { return true; }
+    static auto Get(const Services::Lin::LinTransmission& msg) -> uint64_t { return msg.frame.id; }
+};
+
+} // namespace Core
+} // namespace SilKit
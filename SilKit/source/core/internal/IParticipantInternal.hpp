@@ -25,6 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/participant/IParticipant.hpp"
 #include "silkit/experimental/services/orchestration/ISystemController.hpp"
+#include "silkit/util/HandlerId.hpp"
 
 #include "internal_fwd.hpp"
 #include "IServiceEndpoint.hpp"
@@ -111,6 +112,8 @@ public:
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Lin::LinFrameResponseUpdate& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::PubSub::WireDataMessageEvent& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::PubSub::WireDataMessageBatchEvent& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::PubSub::WireDataMessageBatchEvent&& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Rpc::FunctionCall& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Rpc::FunctionCall&& msg) = 0;
@@ -124,6 +127,8 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Logging::LogMsg& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Logging::LogMsg&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Logging::LogMsgBatch& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Logging::LogMsgBatch&& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Discovery::ParticipantDiscoveryEvent& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Discovery::ServiceDiscoveryEvent& msg) = 0;
@@ -163,6 +168,8 @@ public:
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Lin::LinFrameResponseUpdate& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::PubSub::WireDataMessageEvent& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::PubSub::WireDataMessageBatchEvent& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, Services::PubSub::WireDataMessageBatchEvent&& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Rpc::FunctionCall& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, Services::Rpc::FunctionCall&& msg) = 0;
@@ -176,6 +183,8 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Logging::LogMsg& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, Services::Logging::LogMsg&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Logging::LogMsgBatch& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, Services::Logging::LogMsgBatch&& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Discovery::ParticipantDiscoveryEvent& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Discovery::ServiceDiscoveryEvent& msg) = 0;
@@ -186,7 +195,12 @@ public:
     // For Connection/middleware support:
     virtual void OnAllMessagesDelivered(std::function<void()> callback) = 0;
     virtual void FlushSendBuffers() = 0;
+    //! Handlers run by FlushSendBuffers, e.g., to send messages a service holds back for aggregation
+    virtual auto AddSendBufferFlushHandler(std::function<void()> handler) -> Util::HandlerId = 0;
+    virtual void RemoveSendBufferFlushHandler(Util::HandlerId handlerId) = 0;
     virtual void ExecuteDeferred(std::function<void()> callback) = 0;
+    //! Invokes sendMessages and hands all messages it sends to the I/O thread at once
+    virtual void SendMsgBatch(const std::function<void()>& sendMessages) = 0;
 
     // Service discovery for dynamic, configuration-less simulations
     virtual auto GetServiceDiscovery() -> Discovery::IServiceDiscovery* = 0;
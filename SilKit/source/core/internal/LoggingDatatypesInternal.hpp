@@ -22,9 +22,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <string>
 #include <sstream>
 #include <ostream>
+#include <vector>
 
 #include "silkit/services/logging/LoggingDatatypes.hpp"
 #include "silkit/services/logging/string_utils.hpp"
@@ -55,8 +57,30 @@ struct LogMsg
     std::string payload;
 };
 
+/*! \brief A log entry of a LogMsgBatch
+ *
+ * Consecutive identical log entries are coalesced into a single one.
+ */
+struct LogMsgBatchEntry
+{
+    LogMsg msg;
+    //! Number of times the message was logged in a row
+    uint32_t repeatCount{1};
+};
+
+/*! \brief Log entries sent by a remote sink with batching enabled
+ */
+struct LogMsgBatch
+{
+    std::vector<LogMsgBatchEntry> entries;
+    //! Number of log entries dropped by the rate limit since the previous batch
+    uint64_t droppedCount{0};
+};
+
 inline bool operator==(const SourceLoc& lhs, const SourceLoc& rhs);
 inline bool operator==(const LogMsg& lhs, const LogMsg& rhs);
+inline bool operator==(const LogMsgBatchEntry& lhs, const LogMsgBatchEntry& rhs);
+inline bool operator==(const LogMsgBatch& lhs, const LogMsgBatch& rhs);
 
 inline std::string to_string(const SourceLoc& sourceLoc);
 inline std::ostream& operator<<(std::ostream& out, const SourceLoc& sourceLoc);
@@ -64,6 +88,9 @@ inline std::ostream& operator<<(std::ostream& out, const SourceLoc& sourceLoc);
 inline std::string to_string(const LogMsg& msg);
 inline std::ostream& operator<<(std::ostream& out, const LogMsg& msg);
 
+inline std::string to_string(const LogMsgBatch& msg);
+inline std::ostream& operator<<(std::ostream& out, const LogMsgBatch& msg);
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
@@ -79,6 +106,16 @@ inline bool operator==(const LogMsg& lhs, const LogMsg& rhs)
            && lhs.source == rhs.source && lhs.payload == rhs.payload;
 }
 
+bool operator==(const LogMsgBatchEntry& lhs, const LogMsgBatchEntry& rhs)
+{
+    return lhs.msg == rhs.msg && lhs.repeatCount == rhs.repeatCount;
+}
+
+bool operator==(const LogMsgBatch& lhs, const LogMsgBatch& rhs)
+{
+    return lhs.entries == rhs.entries && lhs.droppedCount == rhs.droppedCount;
+}
+
 std::string to_string(const SourceLoc& sourceLoc)
 {
     std::stringstream outStream;
@@ -108,6 +145,18 @@ std::ostream& operator<<(std::ostream& out, const LogMsg& msg)
     return out;
 }
 
+std::string to_string(const LogMsgBatch& msg)
+{
+    std::stringstream outStream;
+    outStream << msg;
+    return outStream.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const LogMsgBatch& msg)
+{
+    return out << "LogMsgBatch{entries=" << msg.entries.size() << ", dropped=" << msg.droppedCount << "}";
+}
+
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
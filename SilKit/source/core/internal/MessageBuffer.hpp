@@ -30,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <cstring>
 #include <stdexcept>
 #include <map>
+#include <memory>
 
 #include "silkit/util/Span.hpp"
 
@@ -67,11 +68,17 @@ public:
     // ----------------------------------------
     // Public Data Types
 
+    //! Tag for constructing a buffer which only counts the written bytes, see SerializedSize.
+    struct SizeMeasurement {};
+
 public:
     // ----------------------------------------
     // Constructors and Destructor
     inline MessageBuffer() = default;
+    inline explicit MessageBuffer(SizeMeasurement);
     inline MessageBuffer(std::vector<uint8_t> data);
+    //! Read-only buffer referring to (and sharing ownership of) the first size bytes of sharedData.
+    inline MessageBuffer(std::shared_ptr<const uint8_t> sharedData, size_t size);
 
     MessageBuffer(const MessageBuffer& other) = default;
     MessageBuffer(MessageBuffer&& other) = default;
@@ -89,10 +96,11 @@ public:
     // peek into raw data, e.g. for retrieving headers without modifying the buffer
     inline auto PeekData() const  -> SilKit::Util::Span<const uint8_t>;
     inline auto ReadPos() const -> size_t;
+    inline auto WritePos() const -> size_t;
 
     //! Set the format version to use for ser/des.
     inline void SetProtocolVersion(ProtocolVersion version);
-    inline auto GetProtocolVersion() -> ProtocolVersion;
+    inline auto GetProtocolVersion() const -> ProtocolVersion;
 
     inline void SetReadPos(size_t newReadPos);
 
@@ -103,6 +111,10 @@ public:
     //! \brief Return the underlying data storage by std::move and reset pointers
     inline auto ReleaseStorage() -> std::vector<uint8_t>;
     inline auto RemainingBytesLeft() const noexcept -> size_t;
+    //! \brief Consume the remaining bytes, sharing the ownership of a received buffer instead of copying its bytes
+    inline auto ShareRemainingBytes() -> Util::SharedVector<uint8_t>;
+    //! \brief Reserve storage for writing the given total number of bytes, avoiding reallocations while serializing
+    inline void Reserve(size_t size);
 public:
     // ----------------------------------------
     // Elementary streaming operators
@@ -112,23 +124,20 @@ public:
     template<typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator<<(IntegerT t)
     {
-        if (_wPos + sizeof(IntegerT) > _storage.size())
+        if (auto* data = Append(sizeof(IntegerT)))
         {
-            _storage.resize(_storage.size() + sizeof(IntegerT));
+            std::memcpy(data, &t, sizeof(IntegerT));
         }
-        std::memcpy(_storage.data() + _wPos, &t, sizeof(IntegerT));
-
-        _wPos += sizeof(IntegerT);
 
         return *this;
     }
     template<typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator>>(IntegerT& t)
     {
-        if (_rPos + sizeof(IntegerT) > _storage.size())
+        if (_rPos + sizeof(IntegerT) > StorageSize())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(IntegerT));
+        std::memcpy(&t, StorageData() + _rPos, sizeof(IntegerT));
         _rPos += sizeof(IntegerT);
 
         return *this;
@@ -141,14 +150,11 @@ public:
     {
         static_assert(std::numeric_limits<double>::is_iec559, "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_wPos + sizeof(DoubleT) > _storage.size())
+        if (auto* data = Append(sizeof(DoubleT)))
         {
-            _storage.resize(_storage.size() + sizeof(DoubleT));
+            std::memcpy(data, &t, sizeof(DoubleT));
         }
 
-        std::memcpy(_storage.data() + _wPos, &t, sizeof(DoubleT));
-        _wPos += sizeof(DoubleT);
-
         return *this;
     }
     template<typename DoubleT, typename std::enable_if_t<std::is_floating_point<DoubleT>::value, int> = 0>
@@ -156,10 +162,10 @@ public:
     {
         static_assert(std::numeric_limits<double>::is_iec559, "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_rPos + sizeof(DoubleT) > _storage.size())
+        if (_rPos + sizeof(DoubleT) > StorageSize())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(DoubleT));
+        std::memcpy(&t, StorageData() + _rPos, sizeof(DoubleT));
         _rPos += sizeof(DoubleT);
 
         return *this;
@@ -201,8 +207,11 @@ public:
     // Util::SharedVector<T>
     template <typename ValueT>
     inline MessageBuffer& operator<<(const Util::SharedVector<ValueT>& sharedData);
+    inline MessageBuffer& operator<<(const Util::SharedVector<uint8_t>& sharedData);
     template <typename ValueT>
     inline MessageBuffer& operator>>(Util::SharedVector<ValueT>& sharedData);
+    //! Refers to the bytes of a shared buffer without copying them
+    inline MessageBuffer& operator>>(Util::SharedVector<uint8_t>& sharedData);
     // --------------------------------------------------------------------------------
     // std::array<uint8_t, SIZE>
     template<size_t SIZE>
@@ -241,15 +250,35 @@ public:
     inline MessageBuffer& operator>>(Util::Uuid& uuid);
 
 
+private:
+    // ----------------------------------------
+    // private methods
+
+    // The readable bytes, either owned by _storage or shared with other buffers via _sharedData.
+    inline auto StorageData() const -> const uint8_t*;
+    inline auto StorageSize() const -> size_t;
+    // Advance the write position by size bytes and return where to write them, or nullptr when only measuring.
+    inline auto Append(size_t size) -> uint8_t*;
+    inline void AppendBytes(const uint8_t* bytes, size_t size);
+
 private:
     // ----------------------------------------
     // private members
     ProtocolVersion _protocolVersion{CurrentProtocolVersion()};
     std::vector<uint8_t> _storage;
+    std::shared_ptr<const uint8_t> _sharedData;
+    std::size_t _sharedSize{0u};
     std::size_t _wPos{0u};
     std::size_t _rPos{0u};
+    bool _isSizeMeasurement{false};
 };
 
+//! \brief The number of bytes written by operator<< for the given value.
+//!
+//! The serializer runs on a buffer which only counts the written bytes, so it cannot diverge from the actual encoding.
+template <typename T>
+auto SerializedSize(const T& value, ProtocolVersion version = CurrentProtocolVersion()) -> size_t;
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
@@ -260,16 +289,95 @@ MessageBuffer::MessageBuffer(std::vector<uint8_t> data)
 {
 }
 
+MessageBuffer::MessageBuffer(SizeMeasurement)
+    : _isSizeMeasurement{true}
+{
+}
+
+MessageBuffer::MessageBuffer(std::shared_ptr<const uint8_t> sharedData, size_t size)
+    : _sharedData{std::move(sharedData)}
+    , _sharedSize{size}
+    , _wPos{size}
+    , _rPos{0u}
+{
+}
+
 auto MessageBuffer::ReleaseStorage() -> std::vector<uint8_t>
 {
     _wPos = 0u;
     _rPos = 0u;
+    if (_sharedData)
+    {
+        // shared bytes must not be modified, hand out a copy
+        std::vector<uint8_t> result(_sharedData.get(), _sharedData.get() + _sharedSize);
+        _sharedData.reset();
+        _sharedSize = 0u;
+        return result;
+    }
     return std::move(_storage);
 }
 
 inline auto MessageBuffer::RemainingBytesLeft() const noexcept -> size_t
 {
-    return (_rPos > _storage.size()) ? 0 : (_storage.size() - _rPos);
+    return (_rPos > StorageSize()) ? 0 : (StorageSize() - _rPos);
+}
+
+inline auto MessageBuffer::ShareRemainingBytes() -> Util::SharedVector<uint8_t>
+{
+    const auto size = RemainingBytesLeft();
+    Util::SharedVector<uint8_t> result;
+    if (_sharedData)
+    {
+        result = Util::SharedVector<uint8_t>{std::shared_ptr<const uint8_t>{_sharedData, _sharedData.get() + _rPos}, size};
+    }
+    else
+    {
+        result = Util::SharedVector<uint8_t>{Util::Span<const uint8_t>{_storage.data() + _rPos, size}};
+    }
+    _rPos += size;
+    return result;
+}
+
+inline auto MessageBuffer::StorageData() const -> const uint8_t*
+{
+    return _sharedData ? _sharedData.get() : _storage.data();
+}
+
+inline auto MessageBuffer::StorageSize() const -> size_t
+{
+    return _sharedData ? _sharedSize : _storage.size();
+}
+
+inline void MessageBuffer::Reserve(size_t size)
+{
+    if (!_isSizeMeasurement)
+    {
+        _storage.reserve(size);
+    }
+}
+
+inline auto MessageBuffer::Append(size_t size) -> uint8_t*
+{
+    const auto pos = _wPos;
+    _wPos += size;
+    if (_isSizeMeasurement)
+    {
+        return nullptr;
+    }
+    if (_wPos > _storage.size())
+    {
+        _storage.resize(_wPos);
+    }
+    return _storage.data() + pos;
+}
+
+inline void MessageBuffer::AppendBytes(const uint8_t* bytes, size_t size)
+{
+    auto* data = Append(size);
+    if (data != nullptr && size > 0)
+    {
+        std::memcpy(data, bytes, size);
+    }
 }
 
 // --------------------------------------------------------------------------------
@@ -280,14 +388,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::string& str)
         throw end_of_buffer{};
 
     *this << static_cast<uint32_t>(str.length());
-
-    if (_wPos + str.size() > _storage.size())
-    {
-        _storage.resize(_wPos + str.size());
-    }
-
-    std::copy(str.begin(), str.end(), _storage.begin() + _wPos);
-    _wPos += str.size();
+    AppendBytes(reinterpret_cast<const uint8_t*>(str.data()), str.size());
 
     return *this;
 }
@@ -296,10 +397,10 @@ MessageBuffer& MessageBuffer::operator>>(std::string& str)
     uint32_t strLength{0u};
     *this >> strLength;
 
-    if (_rPos + strLength > _storage.size())
+    if (_rPos + strLength > StorageSize())
         throw end_of_buffer{};
 
-    str = std::string(_storage.begin() + _rPos, _storage.begin() + _rPos + strLength);
+    str = std::string(StorageData() + _rPos, StorageData() + _rPos + strLength);
     _rPos += strLength;
 
     return *this;
@@ -313,14 +414,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::vector<uint8_t>& vector)
         throw end_of_buffer{};
 
     *this << static_cast<uint32_t>(vector.size());
-
-    if (_wPos + vector.size() > _storage.size())
-    {
-        _storage.resize(_wPos + vector.size());
-    }
-
-    std::copy(vector.begin(), vector.end(), _storage.begin() + _wPos);
-    _wPos += vector.size();
+    AppendBytes(vector.data(), vector.size());
 
     return *this;
 }
@@ -329,10 +423,10 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<uint8_t>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > StorageSize())
         throw end_of_buffer{};
 
-    vector = std::vector<uint8_t>(_storage.begin() + _rPos, _storage.begin() + _rPos + vectorSize);
+    vector = std::vector<uint8_t>(StorageData() + _rPos, StorageData() + _rPos + vectorSize);
     _rPos += vectorSize;
 
     return *this;
@@ -359,7 +453,7 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<ValueT>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > StorageSize())
         throw end_of_buffer{};
 
     vector.resize(vectorSize);
@@ -394,6 +488,21 @@ inline MessageBuffer& MessageBuffer::operator<<(const Util::SharedVector<ValueT>
     return *this;
 }
 
+inline MessageBuffer& MessageBuffer::operator<<(const Util::SharedVector<uint8_t>& sharedData)
+{
+    const auto span = sharedData.AsSpan();
+
+    if (span.size() > std::numeric_limits<uint32_t>::max())
+    {
+        throw end_of_buffer{};
+    }
+
+    *this << static_cast<uint32_t>(span.size());
+    AppendBytes(span.data(), span.size());
+
+    return *this;
+}
+
 template <typename ValueT>
 inline MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<ValueT>& sharedData)
 {
@@ -405,6 +514,29 @@ inline MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<ValueT>& shar
     return *this;
 }
 
+inline MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<uint8_t>& sharedData)
+{
+    if (!_sharedData)
+    {
+        std::vector<uint8_t> vector;
+        *this >> vector;
+        sharedData = Util::SharedVector<uint8_t>{std::move(vector)};
+        return *this;
+    }
+
+    uint32_t size{0u};
+    *this >> size;
+
+    if (_rPos + size > StorageSize())
+        throw end_of_buffer{};
+
+    // share the ownership of the (received) buffer instead of copying the bytes
+    sharedData = Util::SharedVector<uint8_t>{std::shared_ptr<const uint8_t>{_sharedData, _sharedData.get() + _rPos}, size};
+    _rPos += size;
+
+    return *this;
+}
+
 // --------------------------------------------------------------------------------
 // std::array<uint8_t, SIZE>
 template<size_t SIZE>
@@ -413,23 +545,17 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<uint8_t, SIZE>& array)
     if (array.size() > std::numeric_limits<uint32_t>::max())
         throw end_of_buffer{};
 
-    if (_wPos + array.size() > _storage.size())
-    {
-        _storage.resize(_wPos + array.size());
-    }
-
-    std::copy(array.begin(), array.end(), _storage.begin() + _wPos);
-    _wPos += array.size();
+    AppendBytes(array.data(), array.size());
 
     return *this;
 }
 template<size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<uint8_t, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > StorageSize())
         throw end_of_buffer{};
 
-    std::copy(_storage.begin() + _rPos, _storage.begin() + _rPos + array.size(), array.begin());
+    std::copy(StorageData() + _rPos, StorageData() + _rPos + array.size(), array.begin());
     _rPos += array.size();
 
     return *this;
@@ -451,7 +577,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<ValueT, SIZE>& array)
 template<typename ValueT, size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<ValueT, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > StorageSize())
         throw end_of_buffer{};
 
     for (auto&& value : array)
@@ -576,7 +702,7 @@ inline void MessageBuffer::SetProtocolVersion(ProtocolVersion version)
 {
     _protocolVersion = version;
 }
-inline auto MessageBuffer::GetProtocolVersion() -> ProtocolVersion
+inline auto MessageBuffer::GetProtocolVersion() const -> ProtocolVersion
 {
     return _protocolVersion;
 }
@@ -584,12 +710,16 @@ inline auto MessageBuffer::GetProtocolVersion() -> ProtocolVersion
 
 inline auto MessageBuffer::PeekData() const  -> SilKit::Util::Span<const uint8_t>
 {
-    return _storage;
+    return {StorageData(), StorageSize()};
 }
 inline auto MessageBuffer::ReadPos() const -> size_t
 {
     return _rPos;
 }
+inline auto MessageBuffer::WritePos() const -> size_t
+{
+    return _wPos;
+}
 
 inline void MessageBuffer::SetReadPos(size_t newReadPos)
 {
@@ -608,5 +738,15 @@ MessageBufferPeeker::~MessageBufferPeeker()
     _messageBuffer.SetReadPos(_readPos);
 }
 
+
+template <typename T>
+auto SerializedSize(const T& value, ProtocolVersion version) -> size_t
+{
+    MessageBuffer buffer{MessageBuffer::SizeMeasurement{}};
+    buffer.SetProtocolVersion(version);
+    buffer << value;
+    return buffer.WritePos();
+}
+
 } // namespace Core
 } // namespace SilKit
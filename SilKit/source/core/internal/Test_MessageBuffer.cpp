@@ -236,3 +236,100 @@ TEST(MwVAsio_MessageBuffer, mixed_types)
 
     EXPECT_EQ(in, out);
 }
+
+TEST(MwVAsio_MessageBuffer, shared_data_slice)
+{
+    SilKit::Core::MessageBuffer writeBuffer;
+
+    const std::string inStr{"shared slice"};
+    const std::vector<uint8_t> inVec{1, 2, 3, 4};
+    writeBuffer << uint32_t{17} << inStr << inVec;
+    const auto bytes = writeBuffer.ReleaseStorage();
+
+    // embed the serialized bytes into a larger buffer, e.g., a receive buffer holding multiple messages
+    auto receiveBuffer = std::make_shared<std::vector<uint8_t>>(3, uint8_t{0xff});
+    receiveBuffer->insert(receiveBuffer->end(), bytes.begin(), bytes.end());
+    receiveBuffer->push_back(uint8_t{0xff});
+
+    SilKit::Core::MessageBuffer buffer{std::shared_ptr<const uint8_t>{receiveBuffer, receiveBuffer->data() + 3},
+                                       bytes.size()};
+    EXPECT_EQ(receiveBuffer.use_count(), 2);
+    EXPECT_EQ(buffer.RemainingBytesLeft(), bytes.size());
+
+    uint32_t outInt{0};
+    std::string outStr;
+    std::vector<uint8_t> outVec;
+    buffer >> outInt >> outStr >> outVec;
+
+    EXPECT_EQ(outInt, 17u);
+    EXPECT_EQ(outStr, inStr);
+    EXPECT_EQ(outVec, inVec);
+    EXPECT_EQ(buffer.RemainingBytesLeft(), 0u);
+
+    // reading beyond the slice must fail, even though the underlying buffer is larger
+    uint8_t outByte{0};
+    EXPECT_THROW(buffer >> outByte, SilKit::Core::end_of_buffer);
+
+    // releasing the storage yields a copy of the slice
+    EXPECT_EQ(buffer.ReleaseStorage(), bytes);
+    EXPECT_EQ(receiveBuffer.use_count(), 1);
+}
+
+TEST(MwVAsio_MessageBuffer, serialized_size)
+{
+    std::map<std::string, std::string> map{{"key", "value"}, {"other", ""}};
+    std::vector<std::string> strings{"a", "bc", ""};
+    SilKit::Util::SharedVector<uint8_t> sharedData{std::vector<uint8_t>{1, 2, 3, 4, 5}};
+
+    EXPECT_EQ(SilKit::Core::SerializedSize(uint16_t{}), sizeof(uint16_t));
+    EXPECT_EQ(SilKit::Core::SerializedSize(std::string{"abc"}), sizeof(uint32_t) + 3);
+    EXPECT_EQ(SilKit::Core::SerializedSize(sharedData), sizeof(uint32_t) + 5);
+
+    SilKit::Core::MessageBuffer buffer;
+    buffer << map << strings << sharedData << 1.5 << 10ns;
+    const auto size = buffer.WritePos();
+
+    SilKit::Core::MessageBuffer measurement{SilKit::Core::MessageBuffer::SizeMeasurement{}};
+    measurement << map << strings << sharedData << 1.5 << 10ns;
+    EXPECT_EQ(measurement.WritePos(), size);
+
+    // writing into reserved storage does not reallocate
+    SilKit::Core::MessageBuffer reserved;
+    reserved.Reserve(size);
+    reserved << map;
+    const auto* data = reserved.PeekData().data();
+    reserved << strings << sharedData << 1.5 << 10ns;
+    EXPECT_EQ(reserved.PeekData().data(), data);
+
+    auto storage = reserved.ReleaseStorage();
+    EXPECT_EQ(storage.size(), size);
+    EXPECT_EQ(storage, buffer.ReleaseStorage());
+}
+
+TEST(MwVAsio_MessageBuffer, shared_vector_aliases_shared_data)
+{
+    SilKit::Core::MessageBuffer writeBuffer;
+    writeBuffer << SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>{1, 2, 3, 4}} << uint8_t{5};
+    auto receiveBuffer = std::make_shared<std::vector<uint8_t>>(writeBuffer.ReleaseStorage());
+
+    SilKit::Util::SharedVector<uint8_t> out;
+    {
+        SilKit::Core::MessageBuffer buffer{std::shared_ptr<const uint8_t>{receiveBuffer, receiveBuffer->data()},
+                                           receiveBuffer->size()};
+        uint8_t outByte{0};
+        buffer >> out >> outByte;
+        EXPECT_EQ(outByte, 5u);
+    }
+
+    // the payload refers to the received bytes and keeps them alive
+    EXPECT_EQ(receiveBuffer.use_count(), 2);
+    ASSERT_EQ(out.AsSpan().size(), 4u);
+    EXPECT_EQ(out.AsSpan().data(), receiveBuffer->data() + sizeof(uint32_t));
+    EXPECT_EQ(SilKit::Util::ToStdVector(out.AsSpan()), (std::vector<uint8_t>{1, 2, 3, 4}));
+
+    // owned buffers still copy the payload
+    SilKit::Core::MessageBuffer ownedBuffer{*receiveBuffer};
+    ownedBuffer >> out;
+    EXPECT_EQ(receiveBuffer.use_count(), 1);
+    EXPECT_EQ(SilKit::Util::ToStdVector(out.AsSpan()), (std::vector<uint8_t>{1, 2, 3, 4}));
+}
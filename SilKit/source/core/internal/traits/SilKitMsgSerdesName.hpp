@@ -38,11 +38,13 @@ template <class MsgT> struct SilKitMsgTraitSerdesName { static constexpr const c
     }
 
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Logging::LogMsg, "LOGMSG" );
+DefineSilKitMsgTrait_SerdesName(SilKit::Services::Logging::LogMsgBatch, "LOGMSGBATCH" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::SystemCommand, "SYSTEMCOMMAND" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::ParticipantStatus, "PARTICIPANTSTATUS" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::WorkflowConfiguration, "WORKFLOWCONFIGURATION" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::NextSimTask, "NEXTSIMTASK" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::PubSub::WireDataMessageEvent, "DATAMESSAGEEVENT" );
+DefineSilKitMsgTrait_SerdesName(SilKit::Services::PubSub::WireDataMessageBatchEvent, "DATAMESSAGEBATCHEVENT" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCall, "FUNCTIONCALL" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCallResponse, "FUNCTIONCALLRESPONSE" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Can::WireCanFrameEvent, "CANFRAMEEVENT" );
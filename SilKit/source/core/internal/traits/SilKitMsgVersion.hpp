@@ -37,11 +37,13 @@ template <class MsgT> struct SilKitMsgTraitVersion { static constexpr VersionT V
     }
 
 DefineSilKitMsgTrait_Version(SilKit::Services::Logging::LogMsg, 1);
+DefineSilKitMsgTrait_Version(SilKit::Services::Logging::LogMsgBatch, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::SystemCommand, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::ParticipantStatus, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::WorkflowConfiguration, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::NextSimTask, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::PubSub::WireDataMessageEvent, 1);
+DefineSilKitMsgTrait_Version(SilKit::Services::PubSub::WireDataMessageBatchEvent, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCall, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCallResponse, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Can::WireCanFrameEvent, 1);
@@ -59,6 +59,7 @@ struct NullConnection
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
+    void SendMsgBatch(const std::function<void()>& sendMessages) { sendMessages(); }
     void NotifyShutdown() {}
 
     void RegisterMessageReceiver(std::function<void(IVAsioPeer* /*peer*/, ParticipantAnnouncement)> /*callback*/) {}
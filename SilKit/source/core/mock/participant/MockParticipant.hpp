@@ -288,6 +288,8 @@ public:
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Lin::LinWakeupPulse& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::PubSub::WireDataMessageEvent& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const Services::PubSub::WireDataMessageBatchEvent& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, Services::PubSub::WireDataMessageBatchEvent&& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Rpc::FunctionCall& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, Services::Rpc::FunctionCall&& /*msg*/) override {}
@@ -301,6 +303,8 @@ public:
 
     void SendMsg(const IServiceEndpoint* /*from*/, Services::Logging::LogMsg&& /*msg*/)  override{}
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Logging::LogMsg& /*msg*/)  override{}
+    void SendMsg(const IServiceEndpoint* /*from*/, Services::Logging::LogMsgBatch&& /*msg*/)  override{}
+    void SendMsg(const IServiceEndpoint* /*from*/, const Services::Logging::LogMsgBatch& /*msg*/)  override{}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Discovery::ParticipantDiscoveryEvent& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const Discovery::ServiceDiscoveryEvent& /*msg*/) override {}
@@ -341,6 +345,8 @@ public:
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Lin::LinWakeupPulse& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::PubSub::WireDataMessageEvent& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::PubSub::WireDataMessageBatchEvent& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, Services::PubSub::WireDataMessageBatchEvent&& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Rpc::FunctionCall& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, Services::Rpc::FunctionCall&& /*msg*/) override {}
@@ -354,6 +360,8 @@ public:
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, Services::Logging::LogMsg&& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Logging::LogMsg& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, Services::Logging::LogMsgBatch&& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Logging::LogMsgBatch& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Discovery::ParticipantDiscoveryEvent& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Discovery::ServiceDiscoveryEvent& /*msg*/) override {}
@@ -363,11 +371,20 @@ public:
 
 
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) override {}
-    void FlushSendBuffers() override {}
+    void FlushSendBuffers() override { sendBufferFlushHandlers.InvokeAll(); }
+    auto AddSendBufferFlushHandler(std::function<void()> handler) -> HandlerId override
+    {
+        return sendBufferFlushHandlers.Add(std::move(handler));
+    }
+    void RemoveSendBufferFlushHandler(HandlerId handlerId) override { sendBufferFlushHandlers.Remove(handlerId); }
     void ExecuteDeferred(std::function<void()> callback) override
     {
         callback();
     }
+    void SendMsgBatch(const std::function<void()>& sendMessages) override
+    {
+        sendMessages();
+    }
 
     auto GetParticipantName() const -> const std::string& override { return _name; }
     auto GetRegistryUri() const -> const std::string& override { return _registryUri; }
@@ -401,6 +418,7 @@ public:
     const std::string _name = "MockParticipant";
     const std::string _registryUri = "silkit://mock.participant.silkit:0";
     MockLogger logger;
+    Util::SynchronizedHandlers<std::function<void()>> sendBufferFlushHandlers;
     MockTimeProvider mockTimeProvider;
     MockLifecycleService mockLifecycleService;
     MockTimeSyncService mockTimeSyncService;
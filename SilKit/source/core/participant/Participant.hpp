@@ -75,6 +75,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "procedures/ParticipantReplies.hpp"
 
 #include "ProtocolVersion.hpp"
+#include "SynchronizedHandlers.hpp"
 #include "TimeProvider.hpp"
 
 // Add connection types here and make sure they are instantiated in Participant.cpp
@@ -102,6 +103,7 @@ public:
     Participant(const Participant&) = default;
     Participant(Participant&&) = default;
     Participant(Config::ParticipantConfiguration participantConfig, ProtocolVersion version = CurrentProtocolVersion());
+    ~Participant() override;
 
 public:
     // ----------------------------------------
@@ -202,8 +204,12 @@ public:
 
     void SendMsg(const IServiceEndpoint*, const Services::Logging::LogMsg& msg) override;
     void SendMsg(const IServiceEndpoint*, Services::Logging::LogMsg&& msg) override;
+    void SendMsg(const IServiceEndpoint*, const Services::Logging::LogMsgBatch& msg) override;
+    void SendMsg(const IServiceEndpoint*, Services::Logging::LogMsgBatch&& msg) override;
 
     void SendMsg(const IServiceEndpoint* from, const Services::PubSub::WireDataMessageEvent& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const Services::PubSub::WireDataMessageBatchEvent& msg) override;
+    void SendMsg(const IServiceEndpoint* from, Services::PubSub::WireDataMessageBatchEvent&& msg) override;
     void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCall& msg) override;
     void SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCall&& msg) override;
     void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCallResponse& msg) override;
@@ -253,8 +259,12 @@ public:
 
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const Services::Logging::LogMsg& msg) override;
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, Services::Logging::LogMsg&& msg) override;
+    void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const Services::Logging::LogMsgBatch& msg) override;
+    void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, Services::Logging::LogMsgBatch&& msg) override;
 
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, const Services::PubSub::WireDataMessageEvent& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, const Services::PubSub::WireDataMessageBatchEvent& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, Services::PubSub::WireDataMessageBatchEvent&& msg) override;
 
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Rpc::FunctionCall& msg) override;
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, Services::Rpc::FunctionCall&& msg) override;
@@ -269,7 +279,10 @@ public:
 
     void OnAllMessagesDelivered(std::function<void()> callback) override;
     void FlushSendBuffers() override;
+    auto AddSendBufferFlushHandler(std::function<void()> handler) -> Util::HandlerId override;
+    void RemoveSendBufferFlushHandler(Util::HandlerId handlerId) override;
     void ExecuteDeferred(std::function<void()> callback) override;
+    void SendMsgBatch(const std::function<void()>& sendMessages) override;
 
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler) override;
 
@@ -368,6 +381,9 @@ private:
     std::vector<std::unique_ptr<ITraceMessageSink>> _traceSinks;
     std::unique_ptr<Tracing::ReplayScheduler> _replayScheduler;
     std::unique_ptr<RequestReply::ParticipantReplies> _participantReplies;
+    Services::Logging::LogMsgSender* _logMsgSender{nullptr};
+    // Declared before the controllers, which remove their handlers on destruction
+    Util::SynchronizedHandlers<std::function<void()>> _sendBufferFlushHandlers;
 
     std::tuple<
         ControllerMap<Services::Can::IMsgForCanController>,
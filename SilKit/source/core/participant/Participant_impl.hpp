@@ -133,6 +133,18 @@ void Participant<SilKitConnectionT>::OnSilKitSimulationJoined()
     }
 }
 
+template <class SilKitConnectionT>
+Participant<SilKitConnectionT>::~Participant()
+{
+    // The connection is destroyed before the controllers: send the last batch of remote log messages
+    // and the aggregated data messages now
+    if (_logMsgSender)
+    {
+        _logMsgSender->Shutdown();
+    }
+    _sendBufferFlushHandlers.InvokeAll();
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SetupRemoteLogging()
 {
@@ -162,7 +174,8 @@ void Participant<SilKitConnectionT>::SetupRemoteLogging()
             config.name = "LogMsgSender";
             config.network = "default";
             auto&& logMsgSender = CreateController<Services::Logging::LogMsgSender>(
-                config, std::move(supplementalData), true);
+                config, std::move(supplementalData), true, sinkIter->batching);
+            _logMsgSender = logMsgSender;
 
             logger->RegisterRemoteLogging([logMsgSender](Services::Logging::LogMsg logMsg) {
 
@@ -457,6 +470,13 @@ auto Participant<SilKitConnectionT>::CreateDataPublisher(const std::string& cano
     // Merge config and parameters, sort labels
     SilKit::Config::DataPublisher controllerConfig = GetConfigByControllerName(_participantConfig.dataPublishers, canonicalName);
     UpdateOptionalConfigValue(canonicalName, controllerConfig.topic, dataSpec.Topic());
+    if (history > 0 && controllerConfig.aggregation.mode != Config::DataPublisherAggregation::Mode::Off)
+    {
+        // Only single data messages are kept as history for late-joining subscribers, batches are not
+        Logging::Warn(GetLogger(), "DataPublisher '{}' has a history: its messages are not aggregated",
+                      controllerConfig.name);
+        controllerConfig.aggregation.mode = Config::DataPublisherAggregation::Mode::Off;
+    }
     SilKit::Services::PubSub::PubSubSpec configuredDataNodeSpec{controllerConfig.topic.value(), dataSpec.MediaType()};
     auto labels = dataSpec.Labels();
     std::sort(labels.begin(), labels.end(), [](const MatchingLabel& v1, const MatchingLabel& v2) {
@@ -1076,6 +1096,18 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Services::PubSub::WireDataMessageBatchEvent& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Services::PubSub::WireDataMessageBatchEvent&& msg)
+{
+    SendMsgImpl(from, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCall& msg)
 {
@@ -1137,6 +1169,18 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Servi
     SendMsgImpl(from, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Services::Logging::LogMsgBatch& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Services::Logging::LogMsgBatch&& msg)
+{
+    SendMsgImpl(from, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Discovery::ParticipantDiscoveryEvent& msg)
 {
@@ -1333,6 +1377,20 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                              const Services::PubSub::WireDataMessageBatchEvent& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                              Services::PubSub::WireDataMessageBatchEvent&& msg)
+{
+    SendMsgImpl(from, targetParticipantName, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                               const Services::Rpc::FunctionCall& msg)
@@ -1398,6 +1456,18 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Logging::LogMsgBatch& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, Services::Logging::LogMsgBatch&& msg)
+{
+    SendMsgImpl(from, targetParticipantName, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, const Discovery::ParticipantDiscoveryEvent& msg)
 {
@@ -1589,15 +1659,34 @@ void Participant<SilKitConnectionT>::OnAllMessagesDelivered(std::function<void()
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::FlushSendBuffers()
 {
+    _sendBufferFlushHandlers.InvokeAll();
     _connection.FlushSendBuffers();
 }
 
+template <class SilKitConnectionT>
+auto Participant<SilKitConnectionT>::AddSendBufferFlushHandler(std::function<void()> handler) -> Util::HandlerId
+{
+    return _sendBufferFlushHandlers.Add(std::move(handler));
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::RemoveSendBufferFlushHandler(Util::HandlerId handlerId)
+{
+    _sendBufferFlushHandlers.Remove(handlerId);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::ExecuteDeferred(std::function<void()> callback)
 {
     _connection.ExecuteDeferred(std::move(callback));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsgBatch(const std::function<void()>& sendMessages)
+{
+    _connection.SendMsgBatch(sendMessages);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler)
 {
@@ -0,0 +1,174 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+// Microbenchmark of the serialization of all message types transported by the VAsioConnection.
+//
+// Compares writing into a growing MessageBuffer with writing into storage which is reserved up front by means of
+// the precomputed SerializedPayloadSize. Usage: Bench_MwVAsio_Serdes [iterations]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "VAsioConnection.hpp"
+#include "SerializedMessage.hpp"
+
+#include "tuple_tools/for_each.hpp"
+
+namespace {
+
+using namespace SilKit::Core;
+using namespace SilKit::Services;
+
+template <typename MessageT>
+auto MakeBenchmarkMessage() -> MessageT
+{
+    return MessageT{};
+}
+
+template <>
+auto MakeBenchmarkMessage<Can::WireCanFrameEvent>() -> Can::WireCanFrameEvent
+{
+    Can::WireCanFrameEvent msg{};
+    msg.frame.dataField = std::vector<uint8_t>(64, 0x5a);
+    return msg;
+}
+
+template <>
+auto MakeBenchmarkMessage<Ethernet::WireEthernetFrameEvent>() -> Ethernet::WireEthernetFrameEvent
+{
+    Ethernet::WireEthernetFrameEvent msg{};
+    msg.frame.raw = std::vector<uint8_t>(1500, 0x5a);
+    return msg;
+}
+
+template <>
+auto MakeBenchmarkMessage<Flexray::WireFlexrayFrameEvent>() -> Flexray::WireFlexrayFrameEvent
+{
+    Flexray::WireFlexrayFrameEvent msg{};
+    msg.frame.payload = std::vector<uint8_t>(254, 0x5a);
+    return msg;
+}
+
+template <>
+auto MakeBenchmarkMessage<Flexray::WireFlexrayTxBufferUpdate>() -> Flexray::WireFlexrayTxBufferUpdate
+{
+    Flexray::WireFlexrayTxBufferUpdate msg{};
+    msg.payload = std::vector<uint8_t>(254, 0x5a);
+    return msg;
+}
+
+template <>
+auto MakeBenchmarkMessage<PubSub::WireDataMessageEvent>() -> PubSub::WireDataMessageEvent
+{
+    PubSub::WireDataMessageEvent msg{};
+    msg.data = std::vector<uint8_t>(1024, 0x5a);
+    return msg;
+}
+
+template <>
+auto MakeBenchmarkMessage<Rpc::FunctionCall>() -> Rpc::FunctionCall
+{
+    Rpc::FunctionCall msg{};
+    msg.data = std::vector<uint8_t>(1024, 0x5a);
+    return msg;
+}
+
+template <>
+auto MakeBenchmarkMessage<Logging::LogMsg>() -> Logging::LogMsg
+{
+    Logging::LogMsg msg{};
+    msg.logger_name = "BenchmarkParticipant";
+    msg.source.filename = "Bench_Serdes.cpp";
+    msg.source.funcname = "MakeBenchmarkMessage";
+    msg.payload = std::string(128, 'x');
+    return msg;
+}
+
+template <typename Callable>
+auto MeasureNanosecondsPerIteration(size_t iterations, Callable&& callable) -> double
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        callable();
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>{duration}.count() / iterations;
+}
+
+size_t sink{0};
+
+template <typename MessageT>
+void RunBenchmark(size_t iterations)
+{
+    const auto msg = MakeBenchmarkMessage<MessageT>();
+
+    const auto growing = MeasureNanosecondsPerIteration(iterations, [&msg] {
+        MessageBuffer buffer;
+        Serialize(buffer, msg);
+        sink += buffer.ReleaseStorage().size();
+    });
+    const auto reserved = MeasureNanosecondsPerIteration(iterations, [&msg] {
+        MessageBuffer buffer;
+        buffer.Reserve(SerializedPayloadSize(msg));
+        Serialize(buffer, msg);
+        sink += buffer.ReleaseStorage().size();
+    });
+
+    MessageBuffer buffer;
+    Serialize(buffer, msg);
+    auto blob = buffer.ReleaseStorage();
+    const auto size = blob.size();
+    const auto deserialize = MeasureNanosecondsPerIteration(iterations, [&blob] {
+        MessageBuffer readBuffer{blob};
+        MessageT out{};
+        Deserialize(readBuffer, out);
+        sink += readBuffer.ReadPos();
+    });
+
+    std::cout << std::left << std::setw(60) << SilKitMsgTraits<MessageT>::TypeName() << std::right << std::setw(8)
+              << size << std::fixed << std::setprecision(1) << std::setw(12) << growing << std::setw(12) << reserved
+              << std::setw(12) << deserialize << "\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    size_t iterations = 100000;
+    if (argc > 1)
+    {
+        iterations = std::stoul(argv[1]);
+    }
+
+    std::cout << std::left << std::setw(60) << "message type" << std::right << std::setw(8) << "bytes"
+              << std::setw(12) << "grow [ns]" << std::setw(12) << "reserve [ns]" << std::setw(12) << "read [ns]"
+              << "\n";
+
+    SilKit::Util::tuple_tools::for_each(VAsioConnection::SilKitMessageTypes{}, [iterations](auto&& message) {
+        RunBenchmark<std::decay_t<decltype(message)>>(iterations);
+    });
+
+    return sink == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -44,6 +44,7 @@ public:
 public:
     // ----------------------------------------
     // Public interface methods
+    //! The message may refer to a shared, immutable body (see SerializedMessage::ReleaseStorageParts)
     virtual void SendSilKitMsg(SerializedMessage buffer) = 0;
     virtual void Subscribe(VAsioMsgSubscriber subscriber) = 0;
 
@@ -0,0 +1,81 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "MessageBufferPool.hpp"
+
+namespace SilKit {
+namespace Core {
+
+MessageBufferPool::MessageBufferPool(std::size_t maxPooledBuffers, std::size_t maxPooledCapacity)
+    : _maxPooledBuffers{maxPooledBuffers}
+    , _maxPooledCapacity{maxPooledCapacity}
+{
+}
+
+auto MessageBufferPool::Acquire() -> std::vector<uint8_t>
+{
+    std::unique_lock<std::mutex> lock{_mutex};
+    if (_buffers.empty())
+    {
+        return {};
+    }
+
+    auto buffer = std::move(_buffers.back());
+    _buffers.pop_back();
+    return buffer;
+}
+
+void MessageBufferPool::Release(std::vector<uint8_t> buffer)
+{
+    if (buffer.capacity() == 0 || buffer.capacity() > _maxPooledCapacity)
+    {
+        return;
+    }
+
+    buffer.clear();
+
+    std::unique_lock<std::mutex> lock{_mutex};
+    if (_buffers.size() < _maxPooledBuffers)
+    {
+        _buffers.emplace_back(std::move(buffer));
+    }
+}
+
+auto MessageBufferPool::Share(std::vector<uint8_t> buffer) -> std::shared_ptr<const std::vector<uint8_t>>
+{
+    // the deleter keeps the pool alive until the last shared buffer is released
+    return std::shared_ptr<const std::vector<uint8_t>>{
+        new std::vector<uint8_t>{std::move(buffer)},
+        [pool = shared_from_this()](const std::vector<uint8_t>* sharedBuffer) {
+            auto* buffer = const_cast<std::vector<uint8_t>*>(sharedBuffer);
+            pool->Release(std::move(*buffer));
+            delete buffer;
+        }};
+}
+
+auto MessageBufferPool::NumberOfPooledBuffers() const -> std::size_t
+{
+    std::unique_lock<std::mutex> lock{_mutex};
+    return _buffers.size();
+}
+
+} // namespace Core
+} // namespace SilKit
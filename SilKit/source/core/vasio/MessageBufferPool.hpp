@@ -0,0 +1,63 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace SilKit {
+namespace Core {
+
+//! Recycles the storage of serialized message buffers, which are shared immutably after serialization.
+class MessageBufferPool : public std::enable_shared_from_this<MessageBufferPool>
+{
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    MessageBufferPool(std::size_t maxPooledBuffers, std::size_t maxPooledCapacity);
+
+public:
+    // ----------------------------------------
+    // Public methods
+
+    //! Returns an empty buffer which reuses the storage of a previously released buffer, if available.
+    auto Acquire() -> std::vector<uint8_t>;
+    //! Returns the storage of the buffer to the pool, unless the pool is full or the capacity is too large.
+    void Release(std::vector<uint8_t> buffer);
+    //! Makes the buffer immutable and shared. The storage is released to the pool when the last owner is gone.
+    auto Share(std::vector<uint8_t> buffer) -> std::shared_ptr<const std::vector<uint8_t>>;
+
+    auto NumberOfPooledBuffers() const -> std::size_t;
+
+private:
+    // ----------------------------------------
+    // private members
+    std::size_t _maxPooledBuffers;
+    std::size_t _maxPooledCapacity;
+    mutable std::mutex _mutex;
+    std::vector<std::vector<uint8_t>> _buffers;
+};
+
+} // namespace Core
+} // namespace SilKit
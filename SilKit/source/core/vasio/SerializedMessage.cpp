@@ -29,18 +29,120 @@ SerializedMessage::SerializedMessage(std::vector<uint8_t>&& blob)
     : _buffer{std::move(blob)}
 {
     ReadNetworkHeaders();
+    ShareProxiedMessage();
+}
+
+SerializedMessage::SerializedMessage(std::shared_ptr<const uint8_t> sharedBlob, size_t size)
+    : _buffer{std::move(sharedBlob), size}
+{
+    ReadNetworkHeaders();
+    ShareProxiedMessage();
+}
+
+SerializedMessage::SerializedMessage(const EncodedSimMessageHeaders& headers, EndpointAddress endpointAddress,
+                                     SharedMessageBody body)
+{
+    if (!body)
+    {
+        throw SilKitError("SerializedMessage: the shared body must not be empty");
+    }
+    _sharedBody = Util::SharedVector<uint8_t>{std::shared_ptr<const uint8_t>{body, body->data()}, body->size()};
+    WriteEncodedNetworkHeaders(headers, endpointAddress, 0);
+}
+
+auto SerializedMessage::EncodeSimMessageHeaders(VAsioMsgKind messageKind, EndpointId remoteIndex)
+    -> EncodedSimMessageHeaders
+{
+    if (!IsMwOrSim(messageKind))
+    {
+        throw SilKitError("SerializedMessage: only the headers of simulation messages can be pre-encoded");
+    }
+
+    SerializedMessage message;
+    message._messageKind = messageKind;
+    message._remoteIndex = remoteIndex;
+
+    MessageBuffer buffer;
+    message.WriteNetworkHeaders(buffer);
+
+    EncodedSimMessageHeaders headers;
+    headers.messageKind = messageKind;
+    headers.remoteIndex = remoteIndex;
+    // the endpoint address is written last by WriteNetworkHeaders
+    headers.endpointAddressOffset = buffer.WritePos() - sizeof(ParticipantId) - sizeof(EndpointId);
+    headers.bytes = buffer.ReleaseStorage();
+    return headers;
+}
+
+SerializedMessage::SerializedMessage(const CompactProxyMessageHeader& header, SerializedMessage&& proxiedMessage)
+    : _messageKind{VAsioMsgKind::SilKitCompactProxyMessage}
+    , _compactProxyMessageHeader{header}
+{
+    auto proxiedParts = proxiedMessage.ReleaseStorageParts();
+    MessageBuffer headers;
+    WriteNetworkHeaders(headers);
+    auto storage = headers.ReleaseStorage();
+    if (proxiedParts.body.AsSpan().size() > 0)
+    {
+        // the (small) head of the proxied message is copied, its shared body is passed through
+        storage.insert(storage.end(), proxiedParts.head.begin(), proxiedParts.head.end());
+        _sharedBody = std::move(proxiedParts.body);
+    }
+    else
+    {
+        _sharedBody = Util::SharedVector<uint8_t>{std::move(proxiedParts.head)};
+    }
+    _buffer = MessageBuffer{std::move(storage)};
+    ReadNetworkHeaders();
 }
 
 auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
 {
-    auto buffer = _buffer.ReleaseStorage();
-    if (buffer.size() > std::numeric_limits<uint32_t>::max())
+    auto parts = ReleaseStorageParts();
+    const auto body = parts.body.AsSpan();
+    parts.head.insert(parts.head.end(), body.begin(), body.end());
+    return std::move(parts.head);
+}
+
+auto SerializedMessage::ReleaseStorageParts() -> SerializedMessageParts
+{
+    SerializedMessageParts parts;
+    parts.head = _buffer.ReleaseStorage();
+    parts.body = std::move(_sharedBody);
+    _sharedBody = {};
+    if (parts.Size() > std::numeric_limits<uint32_t>::max())
         throw SilKitError{"SerializedMessage::Serialize: message buffer is too large"};
 
-    // emplace the buffer size as the first element in the byte stream
-    const auto bufferSize = static_cast<uint32_t>(buffer.size());
-    memcpy(buffer.data(), &bufferSize, sizeof(uint32_t));
-    return buffer;
+    // emplace the message size (including the shared body) as the first element in the byte stream
+    const auto messageSize = static_cast<uint32_t>(parts.Size());
+    memcpy(parts.head.data(), &messageSize, sizeof(uint32_t));
+    return parts;
+}
+
+auto SerializedMessage::SharedBodyBuffer() const -> MessageBuffer
+{
+    const auto body = _sharedBody.AsSpan();
+    MessageBuffer bodyBuffer{_sharedBody.GetSharedData(), body.size()};
+    bodyBuffer.SetProtocolVersion(_buffer.GetProtocolVersion());
+    return bodyBuffer;
+}
+
+auto SerializedMessage::HasSharedBody() const -> bool
+{
+    return _sharedBody.AsSpan().size() > 0;
+}
+
+void SerializedMessage::ShareProxiedMessage()
+{
+    if (_messageKind != VAsioMsgKind::SilKitCompactProxyMessage)
+    {
+        return;
+    }
+    _sharedBody = _buffer.ShareRemainingBytes();
+    MessageBuffer headers;
+    WriteNetworkHeaders(headers);
+    headers.SetReadPos(headers.WritePos());
+    _buffer = std::move(headers);
 }
 
 auto SerializedMessage::GetMessageKind() const -> VAsioMsgKind
@@ -88,20 +190,74 @@ auto SerializedMessage::GetProxyMessageHeader() const -> ProxyMessageHeader
     return _proxyMessageHeader;
 }
 
-void SerializedMessage::WriteNetworkHeaders()
+auto SerializedMessage::GetCompactProxyMessageHeader() const -> CompactProxyMessageHeader
+{
+    return _compactProxyMessageHeader;
+}
+
+auto SerializedMessage::GetProxiedMessage() const -> SerializedMessage
+{
+    if (_messageKind != VAsioMsgKind::SilKitCompactProxyMessage)
+    {
+        throw SilKitError("SerializedMessage::GetProxiedMessage called on wrong message kind: "
+                          + std::to_string((int)_messageKind));
+    }
+    const auto body = _sharedBody.AsSpan();
+    if (_buffer.RemainingBytesLeft() == 0)
+    {
+        return SerializedMessage{_sharedBody.GetSharedData(), body.size()};
+    }
+    // a locally constructed message stores the head of the proxied message separately from its body
+    const auto head = _buffer.PeekData();
+    std::vector<uint8_t> blob(head.begin() + _buffer.ReadPos(), head.end());
+    blob.insert(blob.end(), body.begin(), body.end());
+    return SerializedMessage{std::move(blob)};
+}
+
+void SerializedMessage::WriteNetworkHeaders(MessageBuffer& buffer) const
 {
-    _buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
-    _buffer << _messageKind;
+    buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
+    buffer << _messageKind;
     if (_messageKind == VAsioMsgKind::SilKitRegistryMessage)
     {
-        _buffer << _registryKind;
+        buffer << _registryKind;
     }
     if (IsMwOrSim(_messageKind))
     {
-        _buffer << _remoteIndex << _endpointAddress;
+        buffer << _remoteIndex << _endpointAddress;
+    }
+    if (_messageKind == VAsioMsgKind::SilKitCompactProxyMessage)
+    {
+        SerializeCompactProxyMessageHeader(buffer, _compactProxyMessageHeader);
     }
 }
 
+void SerializedMessage::ReserveStorage(size_t payloadSize)
+{
+    MessageBuffer headers{MessageBuffer::SizeMeasurement{}};
+    WriteNetworkHeaders(headers);
+    _buffer.Reserve(headers.WritePos() + payloadSize);
+}
+
+void SerializedMessage::WriteEncodedNetworkHeaders(const EncodedSimMessageHeaders& headers,
+                                                   EndpointAddress endpointAddress, size_t payloadSize)
+{
+    _messageKind = headers.messageKind;
+    _remoteIndex = headers.remoteIndex;
+    _endpointAddress = endpointAddress;
+
+    std::vector<uint8_t> storage;
+    storage.reserve(headers.bytes.size() + payloadSize);
+    storage.assign(headers.bytes.begin(), headers.bytes.end());
+    // same encoding as the MessageBuffer uses for integers
+    auto* address = storage.data() + headers.endpointAddressOffset;
+    std::memcpy(address, &endpointAddress.participant, sizeof(ParticipantId));
+    std::memcpy(address + sizeof(ParticipantId), &endpointAddress.endpoint, sizeof(EndpointId));
+
+    _buffer = MessageBuffer{std::move(storage)};
+    _buffer.SetReadPos(headers.bytes.size());
+}
+
 void SerializedMessage::ReadNetworkHeaders()
 {
     _messageSize = ExtractMessageSize(_buffer);
@@ -149,6 +305,10 @@ void SerializedMessage::ReadNetworkHeaders()
     {
         _proxyMessageHeader = PeekProxyMessageHeader(_buffer);
     }
+    if (_messageKind == VAsioMsgKind::SilKitCompactProxyMessage)
+    {
+        _compactProxyMessageHeader = ExtractCompactProxyMessageHeader(_buffer);
+    }
     if (IsMwOrSim(_messageKind))
     {
         //optional remoteIndex and endpoint address
@@ -23,6 +23,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "VAsioDatatypes.hpp"
 #include "SerializedMessageTraits.hpp"
 #include "MessageBuffer.hpp"
+#include "SharedVector.hpp"
+
+#include <memory>
 
 // Component specific Serialize/Deserialize functions
 #include "VAsioSerdes.hpp"
@@ -48,6 +51,32 @@ auto AdlDeserialize(Args&&... args) -> decltype(auto)
 	return Deserialize(std::forward<Args>(args)...);
 }
 
+// The number of bytes written by Serialize(MessageBuffer&, const MessageT&), see SerializedSize
+template<typename MessageT>
+auto SerializedPayloadSize(const MessageT& message, ProtocolVersion version = CurrentProtocolVersion()) -> size_t;
+
+// The serialized payload of a simulation message, shared by the messages sent to multiple remote receivers.
+using SharedMessageBody = std::shared_ptr<const std::vector<uint8_t>>;
+
+// The network headers of the simulation messages to one remote receiver, which are encoded once when the receiver
+// subscribes. Only the endpoint address of the sending service is written per message.
+struct EncodedSimMessageHeaders
+{
+	VAsioMsgKind messageKind{VAsioMsgKind::Invalid};
+	EndpointId remoteIndex{0};
+	std::vector<uint8_t> bytes; //!< including a placeholder for the endpoint address
+	size_t endpointAddressOffset{0};
+};
+
+// The wire representation of a message: the owned leading bytes, followed by the optional shared body.
+struct SerializedMessageParts
+{
+	std::vector<uint8_t> head;
+	Util::SharedVector<uint8_t> body;
+
+	auto Size() const -> size_t { return head.size() + body.AsSpan().size(); }
+};
+
 // A serialized message used as binary wire format for the VAsio transport.
 class SerializedMessage
 {
@@ -65,11 +94,29 @@ public: // Sending a SerializedMessage: from T to binary blob
 	explicit SerializedMessage(const MessageT& message , EndpointAddress endpointAddress, EndpointId remoteIndex);
 	template<typename MessageT>
 	explicit SerializedMessage(ProtocolVersion version, const MessageT& message);
+	// Sim messages using the pre-encoded network headers of the remote receiver
+	template<typename MessageT>
+	explicit SerializedMessage(const EncodedSimMessageHeaders& headers, EndpointAddress endpointAddress,
+	                           const MessageT& message);
+	static auto EncodeSimMessageHeaders(VAsioMsgKind messageKind, EndpointId remoteIndex) -> EncodedSimMessageHeaders;
+	// Sim messages with a payload that was serialized once (see SerializeBody) and is shared between receivers.
+	// Only the network headers are written per message.
+	explicit SerializedMessage(const EncodedSimMessageHeaders& headers, EndpointAddress endpointAddress,
+	                           SharedMessageBody body);
+
+	template<typename MessageT>
+	static auto SerializeBody(const MessageT& message, std::vector<uint8_t> storage = {}) -> std::vector<uint8_t>;
+	// Compact proxy messages carry the complete proxied message after a fixed-size header
+	explicit SerializedMessage(const CompactProxyMessageHeader& header, SerializedMessage&& proxiedMessage);
 
 	auto ReleaseStorage() -> std::vector<uint8_t>;
+	// Leaves the shared body untouched, which avoids copying it into the returned storage
+	auto ReleaseStorageParts() -> SerializedMessageParts;
 
 public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 	explicit SerializedMessage(std::vector<uint8_t>&& blob);
+	// Refers to the first size bytes of a (larger) receive buffer, whose ownership is shared
+	explicit SerializedMessage(std::shared_ptr<const uint8_t> sharedBlob, size_t size);
 
 	template<typename ApiMessageT>
 	auto Deserialize() -> ApiMessageT;
@@ -83,10 +130,24 @@ public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 	void SetProtocolVersion(ProtocolVersion version);
     auto GetProxyMessageHeader() const -> ProxyMessageHeader;
 	auto GetRegistryMessageHeader() const -> RegistryMsgHeader;
+	auto GetCompactProxyMessageHeader() const -> CompactProxyMessageHeader;
+	// The message carried by a compact proxy message, which shares the bytes of a received buffer
+	auto GetProxiedMessage() const -> SerializedMessage;
 
 private:
-	void WriteNetworkHeaders();
+	SerializedMessage() = default;
+	void WriteNetworkHeaders(MessageBuffer& buffer) const;
 	void ReadNetworkHeaders();
+	// Reserve the storage for the network headers and the payload up front
+	void ReserveStorage(size_t payloadSize);
+	// Copy the pre-encoded network headers into the (reserved) storage and fill in the endpoint address
+	void WriteEncodedNetworkHeaders(const EncodedSimMessageHeaders& headers, EndpointAddress endpointAddress,
+	                                size_t payloadSize);
+	auto SharedBodyBuffer() const -> MessageBuffer;
+	auto HasSharedBody() const -> bool;
+	// Keep only the header of a received compact proxy message in _buffer and share the proxied bytes as the body,
+	// such that forwarding the message does not copy them
+	void ShareProxiedMessage();
 	// network headers, some members are optional depending on messageKind
 	uint32_t _messageSize{0};
 	VAsioMsgKind _messageKind{VAsioMsgKind::Invalid};
@@ -98,8 +159,11 @@ private:
 	RegistryMsgHeader _registryMessageHeader;
     // For proxy messages
     ProxyMessageHeader _proxyMessageHeader;
+    CompactProxyMessageHeader _compactProxyMessageHeader;
 
 	MessageBuffer _buffer;
+	// If set, _buffer only contains the network headers (and the head of a proxied message)
+	Util::SharedVector<uint8_t> _sharedBody;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -110,7 +174,8 @@ SerializedMessage::SerializedMessage(const MessageT& message)
 {
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
-    WriteNetworkHeaders();
+    ReserveStorage(SerializedPayloadSize(message, _buffer.GetProtocolVersion()));
+    WriteNetworkHeaders(_buffer);
     Serialize(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
@@ -122,7 +187,8 @@ SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& me
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     _buffer.SetProtocolVersion(version);
-    WriteNetworkHeaders();
+    ReserveStorage(SerializedPayloadSize(message, _buffer.GetProtocolVersion()));
+    WriteNetworkHeaders(_buffer);
     Serialize(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
@@ -135,16 +201,50 @@ SerializedMessage::SerializedMessage(const MessageT& message, EndpointAddress en
     _endpointAddress = endpointAddress;
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
-    WriteNetworkHeaders();
+    ReserveStorage(SerializedPayloadSize(message, _buffer.GetProtocolVersion()));
+    WriteNetworkHeaders(_buffer);
     Serialize(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
 
+template <typename MessageT>
+SerializedMessage::SerializedMessage(const EncodedSimMessageHeaders& headers, EndpointAddress endpointAddress,
+                                     const MessageT& message)
+{
+    WriteEncodedNetworkHeaders(headers, endpointAddress, SerializedPayloadSize(message, _buffer.GetProtocolVersion()));
+    Serialize(_buffer, message);
+}
+
+template <typename MessageT>
+auto SerializedPayloadSize(const MessageT& message, ProtocolVersion version) -> size_t
+{
+    MessageBuffer buffer{MessageBuffer::SizeMeasurement{}};
+    buffer.SetProtocolVersion(version);
+    Serialize(buffer, message);
+    return buffer.WritePos();
+}
+
+template <typename MessageT>
+auto SerializedMessage::SerializeBody(const MessageT& message, std::vector<uint8_t> storage) -> std::vector<uint8_t>
+{
+    storage.clear();
+    MessageBuffer buffer{std::move(storage)};
+    buffer.Reserve(SerializedPayloadSize(message));
+    Serialize(buffer, message);
+    return buffer.ReleaseStorage();
+}
+
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() -> ApiMessageT
 {
     ApiMessageT value{};
+    if (HasSharedBody())
+    {
+        auto bodyBuffer = SharedBodyBuffer();
+        AdlDeserialize(bodyBuffer, value);
+        return value;
+    }
     AdlDeserialize(_buffer, value);
     return value;
 }
@@ -152,7 +252,7 @@ auto SerializedMessage::Deserialize() -> ApiMessageT
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() const -> ApiMessageT
 {
-    auto bufferCopy = _buffer;
+    auto bufferCopy = HasSharedBody() ? SharedBodyBuffer() : _buffer;
     ApiMessageT value{};
     AdlDeserialize(bufferCopy, value);
     return value;
@@ -41,7 +41,11 @@ inline constexpr auto messageKind<SubscriptionAcknowledge>() -> VAsioMsgKind { r
 template<>
 inline constexpr auto messageKind<VAsioMsgSubscriber>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionAnnouncement; }
 template<>
+inline constexpr auto messageKind<SubscriptionFilter>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionFilter; }
+template<>
 inline constexpr auto messageKind<ProxyMessage>() -> VAsioMsgKind { return VAsioMsgKind::SilKitProxyMessage; }
+template<>
+inline constexpr auto messageKind<SharedMemoryTransportMessage>() -> VAsioMsgKind { return VAsioMsgKind::SharedMemoryTransport; }
 
 template<typename MessageT>
 inline constexpr auto registryMessageKind() -> RegistryMessageKind { return RegistryMessageKind::Invalid; }
@@ -0,0 +1,326 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "SharedMemoryPipe.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#include "fmt/format.h"
+
+#include "silkit/participant/exception.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define SILKIT_SHARED_MEMORY_SUPPORTED 1
+#else
+#    define SILKIT_SHARED_MEMORY_SUPPORTED 0
+#endif
+
+namespace {
+// 'S' = 0x53, 'K' = 0x4b, 'S' = 0x53, 'M' = 0x4d
+constexpr uint32_t SegmentMagic = 0x4d534b53;
+constexpr uint32_t SegmentVersion = 1;
+constexpr std::size_t CacheLineSize = 64;
+constexpr std::size_t MinRingCapacity = 4096;
+constexpr std::size_t MaxRingCapacity = std::size_t{1} << 30;
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "the shared-memory rings require address-free atomics");
+
+auto RoundUpToPowerOfTwo(std::size_t value) -> std::size_t
+{
+    std::size_t result = MinRingCapacity;
+    while (result < value && result < MaxRingCapacity)
+    {
+        result <<= 1u;
+    }
+    return result;
+}
+} // namespace
+
+namespace SilKit {
+namespace Core {
+
+// The positions are monotonically increasing byte counters, the offset into the ring is position % capacity.
+struct SharedMemoryPipe::RingHeader
+{
+    alignas(CacheLineSize) std::atomic<uint64_t> writePos;
+    alignas(CacheLineSize) std::atomic<uint64_t> readPos;
+    alignas(CacheLineSize) std::atomic<uint32_t> readerWaiting;
+    std::atomic<uint32_t> writerWaiting;
+};
+
+struct SharedMemoryPipe::SegmentHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t ringCapacity;
+    RingHeader rings[2];
+};
+
+auto SharedMemoryPipe::DataOffset() -> std::size_t
+{
+    return (sizeof(SegmentHeader) + CacheLineSize - 1) / CacheLineSize * CacheLineSize;
+}
+
+SharedMemoryPipe::SharedMemoryPipe(std::string name, void* mapping, std::size_t mappingSize, bool isCreator)
+    : _name{std::move(name)}
+    , _mapping{mapping}
+    , _mappingSize{mappingSize}
+    , _isCreator{isCreator}
+    , _isLinked{isCreator}
+{
+    _segment = static_cast<SegmentHeader*>(_mapping);
+    _ringCapacity = static_cast<std::size_t>(_segment->ringCapacity);
+
+    auto* ringData = static_cast<uint8_t*>(_mapping) + DataOffset();
+    const std::size_t outgoingIndex = _isCreator ? 0 : 1;
+    const std::size_t incomingIndex = _isCreator ? 1 : 0;
+    _outgoing = &_segment->rings[outgoingIndex];
+    _incoming = &_segment->rings[incomingIndex];
+    _outgoingData = ringData + outgoingIndex * _ringCapacity;
+    _incomingData = ringData + incomingIndex * _ringCapacity;
+}
+
+#if SILKIT_SHARED_MEMORY_SUPPORTED
+
+SharedMemoryPipe::~SharedMemoryPipe()
+{
+    Unlink();
+    ::munmap(_mapping, _mappingSize);
+}
+
+auto SharedMemoryPipe::Create(const std::string& name, std::size_t ringCapacity) -> std::unique_ptr<SharedMemoryPipe>
+{
+    const auto capacity = RoundUpToPowerOfTwo(ringCapacity);
+    const auto mappingSize = DataOffset() + 2 * capacity;
+
+    const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        throw SilKitError{fmt::format("SharedMemoryPipe: cannot create segment '{}': {}", name, strerror(errno))};
+    }
+
+    void* mapping = MAP_FAILED;
+    if (::ftruncate(fd, static_cast<off_t>(mappingSize)) == 0)
+    {
+        mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    const auto error = errno;
+    ::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        ::shm_unlink(name.c_str());
+        throw SilKitError{fmt::format("SharedMemoryPipe: cannot map segment '{}': {}", name, strerror(error))};
+    }
+
+    auto* segment = new (mapping) SegmentHeader{};
+    segment->magic = SegmentMagic;
+    segment->version = SegmentVersion;
+    segment->ringCapacity = capacity;
+    for (auto& ring : segment->rings)
+    {
+        ring.writePos = 0;
+        ring.readPos = 0;
+        ring.readerWaiting = 0;
+        ring.writerWaiting = 0;
+    }
+
+    return std::unique_ptr<SharedMemoryPipe>{new SharedMemoryPipe{name, mapping, mappingSize, true}};
+}
+
+auto SharedMemoryPipe::Open(const std::string& name) -> std::unique_ptr<SharedMemoryPipe>
+{
+    const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+    {
+        throw SilKitError{fmt::format("SharedMemoryPipe: cannot open segment '{}': {}", name, strerror(errno))};
+    }
+
+    struct stat info{};
+    void* mapping = MAP_FAILED;
+    std::size_t mappingSize = 0;
+    if (::fstat(fd, &info) == 0 && static_cast<std::size_t>(info.st_size) > DataOffset())
+    {
+        mappingSize = static_cast<std::size_t>(info.st_size);
+        mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw SilKitError{fmt::format("SharedMemoryPipe: cannot map segment '{}'", name)};
+    }
+
+    const auto* segment = static_cast<const SegmentHeader*>(mapping);
+    if (segment->magic != SegmentMagic || segment->version != SegmentVersion
+        || DataOffset() + 2 * segment->ringCapacity != mappingSize)
+    {
+        ::munmap(mapping, mappingSize);
+        throw SilKitError{fmt::format("SharedMemoryPipe: segment '{}' has an unknown layout", name)};
+    }
+
+    return std::unique_ptr<SharedMemoryPipe>{new SharedMemoryPipe{name, mapping, mappingSize, false}};
+}
+
+auto SharedMemoryPipe::MakeUniqueName() -> std::string
+{
+    // POSIX only guarantees short names to be portable (e.g., 31 characters on macOS)
+    static std::atomic<uint32_t> counter{0};
+    return fmt::format("/SilKit-{}-{}", ::getpid(), counter++);
+}
+
+bool SharedMemoryPipe::IsSupported()
+{
+    return true;
+}
+
+void SharedMemoryPipe::Unlink()
+{
+    if (_isLinked)
+    {
+        ::shm_unlink(_name.c_str());
+        _isLinked = false;
+    }
+}
+
+#else
+
+SharedMemoryPipe::~SharedMemoryPipe() = default;
+
+auto SharedMemoryPipe::Create(const std::string&, std::size_t) -> std::unique_ptr<SharedMemoryPipe>
+{
+    throw SilKitError{"SharedMemoryPipe: not supported on this platform"};
+}
+
+auto SharedMemoryPipe::Open(const std::string&) -> std::unique_ptr<SharedMemoryPipe>
+{
+    throw SilKitError{"SharedMemoryPipe: not supported on this platform"};
+}
+
+auto SharedMemoryPipe::MakeUniqueName() -> std::string
+{
+    return {};
+}
+
+bool SharedMemoryPipe::IsSupported()
+{
+    return false;
+}
+
+void SharedMemoryPipe::Unlink()
+{
+}
+
+#endif
+
+auto SharedMemoryPipe::Name() const -> const std::string&
+{
+    return _name;
+}
+
+auto SharedMemoryPipe::RingCapacity() const -> std::size_t
+{
+    return _ringCapacity;
+}
+
+auto SharedMemoryPipe::Write(const uint8_t* data, std::size_t size) -> std::size_t
+{
+    const auto writePos = _outgoing->writePos.load(std::memory_order_relaxed);
+    const auto readPos = _outgoing->readPos.load(std::memory_order_acquire);
+    const auto count = (std::min)(size, _ringCapacity - static_cast<std::size_t>(writePos - readPos));
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const auto offset = static_cast<std::size_t>(writePos) & (_ringCapacity - 1);
+    const auto firstChunk = (std::min)(count, _ringCapacity - offset);
+    memcpy(_outgoingData + offset, data, firstChunk);
+    memcpy(_outgoingData, data + firstChunk, count - firstChunk);
+
+    // sequentially consistent, such that TakeRemoteReaderWaiting cannot miss a reader which starts waiting now
+    _outgoing->writePos.store(writePos + count, std::memory_order_seq_cst);
+    return count;
+}
+
+auto SharedMemoryPipe::Read(uint8_t* data, std::size_t size) -> std::size_t
+{
+    const auto readPos = _incoming->readPos.load(std::memory_order_relaxed);
+    const auto writePos = _incoming->writePos.load(std::memory_order_acquire);
+    const auto count = (std::min)(size, static_cast<std::size_t>(writePos - readPos));
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const auto offset = static_cast<std::size_t>(readPos) & (_ringCapacity - 1);
+    const auto firstChunk = (std::min)(count, _ringCapacity - offset);
+    memcpy(data, _incomingData + offset, firstChunk);
+    memcpy(data + firstChunk, _incomingData, count - firstChunk);
+
+    _incoming->readPos.store(readPos + count, std::memory_order_seq_cst);
+    return count;
+}
+
+bool SharedMemoryPipe::WaitForData()
+{
+    _incoming->readerWaiting.store(1, std::memory_order_seq_cst);
+    if (_incoming->writePos.load(std::memory_order_seq_cst) != _incoming->readPos.load(std::memory_order_relaxed))
+    {
+        _incoming->readerWaiting.store(0, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+bool SharedMemoryPipe::WaitForSpace()
+{
+    _outgoing->writerWaiting.store(1, std::memory_order_seq_cst);
+    const auto readPos = _outgoing->readPos.load(std::memory_order_seq_cst);
+    if (_outgoing->writePos.load(std::memory_order_relaxed) - readPos < _ringCapacity)
+    {
+        _outgoing->writerWaiting.store(0, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+bool SharedMemoryPipe::TakeRemoteReaderWaiting()
+{
+    return _outgoing->readerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+bool SharedMemoryPipe::TakeRemoteWriterWaiting()
+{
+    return _incoming->writerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,106 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace SilKit {
+namespace Core {
+
+//! A pair of single-producer/single-consumer byte rings in a named shared-memory segment.
+//! The creator of the segment writes into the first ring and reads from the second one, the side which opens the
+//! segment uses the rings the other way round. Both sides must only access the pipe from a single thread each.
+class SharedMemoryPipe
+{
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    SharedMemoryPipe(const SharedMemoryPipe&) = delete;
+    SharedMemoryPipe& operator=(const SharedMemoryPipe&) = delete;
+    ~SharedMemoryPipe();
+
+    //! Creates a new segment with one ring of (at least) ringCapacity bytes per direction. Throws on failure.
+    static auto Create(const std::string& name, std::size_t ringCapacity) -> std::unique_ptr<SharedMemoryPipe>;
+    //! Attaches to a segment created by the remote side. Throws on failure.
+    static auto Open(const std::string& name) -> std::unique_ptr<SharedMemoryPipe>;
+    //! Returns a segment name which is unique for this process.
+    static auto MakeUniqueName() -> std::string;
+    //! True if shared-memory segments are supported on this platform.
+    static bool IsSupported();
+
+public:
+    // ----------------------------------------
+    // Public methods
+
+    auto Name() const -> const std::string&;
+    auto RingCapacity() const -> std::size_t;
+
+    //! Removes the name of the segment. The mapping stays valid until both sides have released it.
+    void Unlink();
+
+    //! Copies as many bytes as fit into the outgoing ring. Returns the number of bytes written.
+    auto Write(const uint8_t* data, std::size_t size) -> std::size_t;
+    //! Copies up to size bytes from the incoming ring. Returns the number of bytes read.
+    auto Read(uint8_t* data, std::size_t size) -> std::size_t;
+
+    // The rings are not able to wake up the remote side. A side which runs out of data (or space) announces that
+    // it waits and the remote side notifies it out-of-band after it produced data (or freed space).
+
+    //! Announces that the reader waits for data. Returns false, if data arrived in the meantime.
+    bool WaitForData();
+    //! Announces that the writer waits for space. Returns false, if space was freed in the meantime.
+    bool WaitForSpace();
+    //! Returns true (once) if the remote reader of the outgoing ring announced to wait for data.
+    bool TakeRemoteReaderWaiting();
+    //! Returns true (once) if the remote writer of the incoming ring announced to wait for space.
+    bool TakeRemoteWriterWaiting();
+
+private:
+    // ----------------------------------------
+    // Private types and methods
+    struct RingHeader;
+    struct SegmentHeader;
+
+    SharedMemoryPipe(std::string name, void* mapping, std::size_t mappingSize, bool isCreator);
+    static auto DataOffset() -> std::size_t;
+
+private:
+    // ----------------------------------------
+    // private members
+    std::string _name;
+    void* _mapping{nullptr};
+    std::size_t _mappingSize{0};
+    bool _isCreator{false};
+    bool _isLinked{false};
+
+    SegmentHeader* _segment{nullptr};
+    RingHeader* _outgoing{nullptr};
+    RingHeader* _incoming{nullptr};
+    uint8_t* _outgoingData{nullptr};
+    uint8_t* _incomingData{nullptr};
+    std::size_t _ringCapacity{0};
+};
+
+} // namespace Core
+} // namespace SilKit
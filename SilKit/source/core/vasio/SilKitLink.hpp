@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <algorithm>
+
 #include "ILogger.hpp"
 
 #include "VAsioTransmitter.hpp"
@@ -53,6 +55,7 @@ public:
     void AddLocalReceiver(ReceiverT* receiver);
     void AddRemoteReceiver(IVAsioPeer* peer, EndpointId remoteIdx);
     void RemoveRemoteReceiver(IVAsioPeer* peer);
+    void SetRemoteReceiverFilter(IVAsioPeer* peer, EndpointId remoteIdx, AcceptanceFilter filter);
     size_t GetNumberOfRemoteReceivers();
     std::vector<std::string> GetParticipantNamesOfRemoteReceivers();
 
@@ -68,6 +71,20 @@ private:
     // private methods
     void DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoint* from, const MsgT& msg);
 
+private:
+    // ----------------------------------------
+    // private types
+
+    //! A local receiver and its service endpoint, which is resolved once when the receiver is added
+    struct LocalReceiver
+    {
+        ReceiverT* receiver;
+        const IServiceEndpoint* endpoint;
+    };
+
+    static bool IsSameEndpoint(const IServiceEndpoint* receiverEndpoint, const IServiceEndpoint* from,
+                               const EndpointAddress& fromAddress);
+
 private:
     // ----------------------------------------
     // private members
@@ -75,7 +92,7 @@ private:
     Services::Logging::ILogger* _logger;
     Services::Orchestration::ITimeProvider* _timeProvider;
 
-    std::vector<ReceiverT*> _localReceivers;
+    std::vector<LocalReceiver> _localReceivers;
     VAsioTransmitter<MsgT> _vasioTransmitter;
 };
 
@@ -93,8 +110,13 @@ SilKitLink<MsgT>::SilKitLink(std::string name, Services::Logging::ILogger* logge
 template <class MsgT>
 void SilKitLink<MsgT>::AddLocalReceiver(ReceiverT* receiver)
 {
-    if (std::find(_localReceivers.begin(), _localReceivers.end(), receiver) != _localReceivers.end()) return;
-    _localReceivers.push_back(receiver);
+    if (std::any_of(_localReceivers.begin(), _localReceivers.end(), [receiver](const LocalReceiver& localReceiver) {
+            return localReceiver.receiver == receiver;
+        }))
+    {
+        return;
+    }
+    _localReceivers.push_back(LocalReceiver{receiver, dynamic_cast<const IServiceEndpoint*>(receiver)});
 }
 
 template <class MsgT>
@@ -108,6 +130,11 @@ void SilKitLink<MsgT>::RemoveRemoteReceiver(IVAsioPeer* peer)
     _vasioTransmitter.RemoveRemoteReceiver(peer);
 }
 template <class MsgT>
+void SilKitLink<MsgT>::SetRemoteReceiverFilter(IVAsioPeer* peer, EndpointId remoteIdx, AcceptanceFilter filter)
+{
+    _vasioTransmitter.SetRemoteReceiverFilter(peer, remoteIdx, std::move(filter));
+}
+template <class MsgT>
 auto SilKitLink<MsgT>::GetNumberOfRemoteReceivers() -> size_t
 {
     return _vasioTransmitter.GetNumberOfRemoteReceivers();
@@ -146,9 +173,9 @@ void SilKitLink<MsgT>::DistributeRemoteSilKitMessage(const IServiceEndpoint* fro
         SetTimestamp(msg, _timeProvider->Now());
     }
 
-    for (auto&& receiver : _localReceivers)
+    for (auto&& localReceiver : _localReceivers)
     {
-        DispatchSilKitMessage(receiver, from, msg);
+        DispatchSilKitMessage(localReceiver.receiver, from, msg);
     }
 }
 
@@ -160,16 +187,33 @@ void SilKitLink<MsgT>::DistributeLocalSilKitMessage(const IServiceEndpoint* from
     // Otherwise, messages that may be produced during the internal dispatch will be dispatched to remote receivers first.
     // As a result, the messages may be delivered in the wrong order (possibly even reversed)
     DispatchSilKitMessage(&_vasioTransmitter, from, msg);
-    for (auto&& receiver : _localReceivers)
+
+    const auto fromAddress = from->GetServiceDescriptor().to_endpointAddress();
+    for (auto&& localReceiver : _localReceivers)
     {
-        auto* receiverId = dynamic_cast<const IServiceEndpoint*>(receiver);
         // C++ 17 -> if constexpr
         if (!SilKitMsgTraits<MsgT>::IsSelfDeliveryEnforced())
         {
-            if (receiverId->GetServiceDescriptor() == from->GetServiceDescriptor()) continue;
+            if (IsSameEndpoint(localReceiver.endpoint, from, fromAddress)) continue;
         }
-        DispatchSilKitMessage(receiver, from, msg);
+        DispatchSilKitMessage(localReceiver.receiver, from, msg);
+    }
+}
+
+template <class MsgT>
+bool SilKitLink<MsgT>::IsSameEndpoint(const IServiceEndpoint* receiverEndpoint, const IServiceEndpoint* from,
+                                      const EndpointAddress& fromAddress)
+{
+    if (receiverEndpoint == from)
+    {
+        return true;
     }
+
+    // NB: The descriptors are read on every message, because simulators change their descriptor after registration.
+    //     Comparing the endpoint addresses first avoids the string comparisons for all other receivers.
+    const auto& receiverDescriptor = receiverEndpoint->GetServiceDescriptor();
+    return receiverDescriptor.to_endpointAddress() == fromAddress
+           && receiverDescriptor == from->GetServiceDescriptor();
 }
 
 // Dispatcher for outgoing SilKitMessages
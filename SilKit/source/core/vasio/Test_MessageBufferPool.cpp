@@ -0,0 +1,76 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "MessageBufferPool.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+
+TEST(MwVAsio_MessageBufferPool, shared_buffer_storage_is_reused)
+{
+    auto pool = std::make_shared<MessageBufferPool>(2, 1024);
+
+    auto buffer = pool->Acquire();
+    buffer.resize(100);
+    const auto* storage = buffer.data();
+
+    auto shared = pool->Share(std::move(buffer));
+    auto sharedCopy = shared;
+    shared.reset();
+    EXPECT_EQ(pool->NumberOfPooledBuffers(), 0u);
+
+    sharedCopy.reset();
+    ASSERT_EQ(pool->NumberOfPooledBuffers(), 1u);
+
+    auto reused = pool->Acquire();
+    EXPECT_TRUE(reused.empty());
+    EXPECT_GE(reused.capacity(), 100u);
+    EXPECT_EQ(reused.data(), storage);
+    EXPECT_EQ(pool->NumberOfPooledBuffers(), 0u);
+}
+
+TEST(MwVAsio_MessageBufferPool, limits)
+{
+    auto pool = std::make_shared<MessageBufferPool>(2, 1024);
+
+    pool->Release(std::vector<uint8_t>(2048));
+    EXPECT_EQ(pool->NumberOfPooledBuffers(), 0u);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        pool->Release(std::vector<uint8_t>(16));
+    }
+    EXPECT_EQ(pool->NumberOfPooledBuffers(), 2u);
+}
+
+TEST(MwVAsio_MessageBufferPool, shared_buffer_outlives_pool_owner)
+{
+    auto pool = std::make_shared<MessageBufferPool>(2, 1024);
+    auto shared = pool->Share(std::vector<uint8_t>{1, 2, 3});
+    pool.reset();
+
+    EXPECT_EQ(*shared, (std::vector<uint8_t>{1, 2, 3}));
+}
+
+} // anonymous namespace
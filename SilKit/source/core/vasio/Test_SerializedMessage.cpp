@@ -95,3 +95,135 @@ TEST(VAsioSerializedMessage, packed_handshake_message)
 
     ASSERT_EQ(to_string(ptr->acceptorUri0, ptr->acceptorUri0Size), announcement.peerInfo.acceptorUris.at(0));
 }
+
+TEST(VAsioSerializedMessage, from_shared_receive_buffer)
+{
+    VAsioMsgSubscriber subscriber;
+    subscriber.receiverIdx = 5;
+    subscriber.networkName = "Network";
+    subscriber.msgTypeName = "MsgType";
+    subscriber.version = 1;
+
+    auto blob = SerializedMessage{subscriber}.ReleaseStorage();
+
+    // two messages back to back in the same receive buffer
+    auto receiveBuffer = std::make_shared<std::vector<uint8_t>>(blob);
+    receiveBuffer->insert(receiveBuffer->end(), blob.begin(), blob.end());
+
+    for (size_t offset : {size_t{0}, blob.size()})
+    {
+        SerializedMessage msg{std::shared_ptr<const uint8_t>{receiveBuffer, receiveBuffer->data() + offset},
+                              blob.size()};
+        ASSERT_EQ(msg.GetMessageKind(), VAsioMsgKind::SubscriptionAnnouncement);
+
+        auto out = msg.Deserialize<VAsioMsgSubscriber>();
+        EXPECT_EQ(out.receiverIdx, subscriber.receiverIdx);
+        EXPECT_EQ(out.networkName, subscriber.networkName);
+        EXPECT_EQ(out.msgTypeName, subscriber.msgTypeName);
+        EXPECT_EQ(out.version, subscriber.version);
+    }
+}
+
+TEST(VAsioSerializedMessage, shared_body_matches_regular_message)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{1234};
+    event.data = std::vector<uint8_t>{1, 2, 3, 4, 5};
+
+    const EndpointAddress endpointAddress{17, 42};
+    const EndpointId remoteIndex{3};
+
+    auto body = std::make_shared<const std::vector<uint8_t>>(SerializedMessage::SerializeBody(event));
+
+    const auto headers = SerializedMessage::EncodeSimMessageHeaders(messageKind<decltype(event)>(), remoteIndex);
+    SerializedMessage shared{headers, endpointAddress, body};
+    EXPECT_EQ(shared.GetRemoteIndex(), remoteIndex);
+    EXPECT_EQ(shared.GetEndpointAddress(), endpointAddress);
+
+    auto out = shared.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+    EXPECT_EQ(out.timestamp, event.timestamp);
+    EXPECT_EQ(SilKit::Util::ToStdVector(out.data.AsSpan()), SilKit::Util::ToStdVector(event.data.AsSpan()));
+
+    auto parts = SerializedMessage{shared}.ReleaseStorageParts();
+    EXPECT_EQ(parts.body.AsSpan().data(), body->data());
+
+    // the shared body is not modified and the resulting wire bytes are identical to a regular message
+    auto regular = SerializedMessage{event, endpointAddress, remoteIndex}.ReleaseStorage();
+    EXPECT_EQ(shared.ReleaseStorage(), regular);
+    EXPECT_EQ(*body, SerializedMessage::SerializeBody(event));
+}
+
+TEST(VAsioSerializedMessage, encoded_headers_match_regular_message)
+{
+    SilKit::Services::Can::WireCanFrameEvent canFrameEvent{};
+    canFrameEvent.frame.canId = 0x123;
+    canFrameEvent.frame.dataField = std::vector<uint8_t>(8, 0xab);
+
+    const EndpointId remoteIndex{3};
+    const auto headers = SerializedMessage::EncodeSimMessageHeaders(messageKind<decltype(canFrameEvent)>(), remoteIndex);
+
+    // the same headers are used for messages of different senders
+    for (const EndpointAddress endpointAddress : {EndpointAddress{17, 42}, EndpointAddress{0xffff'ffff'ffff, 7}})
+    {
+        SerializedMessage encoded{headers, endpointAddress, canFrameEvent};
+        EXPECT_EQ(encoded.GetMessageKind(), messageKind<decltype(canFrameEvent)>());
+        EXPECT_EQ(encoded.GetRemoteIndex(), remoteIndex);
+        EXPECT_EQ(encoded.GetEndpointAddress(), endpointAddress);
+        EXPECT_EQ(encoded.Deserialize<SilKit::Services::Can::WireCanFrameEvent>().frame.canId, canFrameEvent.frame.canId);
+
+        auto regular = SerializedMessage{canFrameEvent, endpointAddress, remoteIndex}.ReleaseStorage();
+        EXPECT_EQ(encoded.ReleaseStorage(), regular);
+    }
+
+    EXPECT_THROW(SerializedMessage::EncodeSimMessageHeaders(VAsioMsgKind::SubscriptionAnnouncement, remoteIndex),
+                 SilKit::SilKitError);
+}
+
+TEST(VAsioSerializedMessage, serialized_payload_size)
+{
+    SilKit::Services::Can::WireCanFrameEvent canFrameEvent{};
+    canFrameEvent.frame.dataField = std::vector<uint8_t>(64, 0xab);
+
+    MessageBuffer buffer;
+    Serialize(buffer, canFrameEvent);
+    EXPECT_EQ(SerializedPayloadSize(canFrameEvent), buffer.WritePos());
+
+    const EndpointAddress endpointAddress{1, 2};
+    auto blob = SerializedMessage{canFrameEvent, endpointAddress, 3}.ReleaseStorage();
+    auto headers = SerializedMessage{SilKit::Services::Can::CanSetControllerMode{}, endpointAddress, 3};
+    const auto headersSize = headers.ReleaseStorage().size() - SerializedPayloadSize(SilKit::Services::Can::CanSetControllerMode{});
+    EXPECT_EQ(blob.size(), headersSize + buffer.WritePos());
+}
+
+TEST(VAsioSerializedMessage, compact_proxy_message_is_forwarded_without_copying_the_proxied_message)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{1234};
+    event.data = std::vector<uint8_t>(128, 0xab);
+
+    const EndpointAddress endpointAddress{17, 42};
+    const CompactProxyMessageHeader header{0, 1111, 2222};
+    const auto proxiedBlob = SerializedMessage{event, endpointAddress, 3}.ReleaseStorage();
+
+    auto compactBlob =
+        SerializedMessage{header, SerializedMessage{event, endpointAddress, 3}}.ReleaseStorage();
+    ASSERT_EQ(compactBlob.size(), proxiedBlob.size() + 4 + 1 + 17);
+
+    // the registry receives the message into a shared buffer
+    auto receiveBuffer = std::make_shared<std::vector<uint8_t>>(compactBlob);
+    SerializedMessage received{std::shared_ptr<const uint8_t>{receiveBuffer, receiveBuffer->data()},
+                               receiveBuffer->size()};
+    ASSERT_EQ(received.GetMessageKind(), VAsioMsgKind::SilKitCompactProxyMessage);
+    EXPECT_EQ(received.GetCompactProxyMessageHeader().source, header.source);
+    EXPECT_EQ(received.GetCompactProxyMessageHeader().destination, header.destination);
+
+    auto proxied = received.GetProxiedMessage();
+    ASSERT_EQ(proxied.GetMessageKind(), messageKind<decltype(event)>());
+    EXPECT_EQ(proxied.GetEndpointAddress(), endpointAddress);
+    EXPECT_EQ(proxied.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>().timestamp, event.timestamp);
+
+    // forwarding only writes the header, the proxied bytes refer to the receive buffer
+    auto parts = SerializedMessage{received}.ReleaseStorageParts();
+    EXPECT_EQ(parts.body.AsSpan().data(), receiveBuffer->data() + (compactBlob.size() - proxiedBlob.size()));
+    EXPECT_EQ(SerializedMessage{received}.ReleaseStorage(), compactBlob);
+}
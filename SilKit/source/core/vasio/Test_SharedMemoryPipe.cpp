@@ -0,0 +1,112 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "SharedMemoryPipe.hpp"
+
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+
+TEST(MwVAsio_SharedMemoryPipe, bytes_are_transferred_in_both_directions)
+{
+    if (!SharedMemoryPipe::IsSupported())
+    {
+        return;
+    }
+
+    auto creator = SharedMemoryPipe::Create(SharedMemoryPipe::MakeUniqueName(), 4096);
+    auto opener = SharedMemoryPipe::Open(creator->Name());
+    creator->Unlink();
+    EXPECT_EQ(opener->RingCapacity(), 4096u);
+
+    const std::vector<uint8_t> request{1, 2, 3, 4};
+    const std::vector<uint8_t> reply{5, 6, 7};
+    EXPECT_EQ(creator->Write(request.data(), request.size()), request.size());
+    EXPECT_EQ(opener->Write(reply.data(), reply.size()), reply.size());
+
+    std::vector<uint8_t> buffer(16);
+    ASSERT_EQ(opener->Read(buffer.data(), buffer.size()), request.size());
+    EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + 4), request);
+    ASSERT_EQ(creator->Read(buffer.data(), buffer.size()), reply.size());
+    EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + 3), reply);
+    EXPECT_EQ(creator->Read(buffer.data(), buffer.size()), 0u);
+}
+
+TEST(MwVAsio_SharedMemoryPipe, full_ring_accepts_partial_writes_and_wraps_around)
+{
+    if (!SharedMemoryPipe::IsSupported())
+    {
+        return;
+    }
+
+    auto writer = SharedMemoryPipe::Create(SharedMemoryPipe::MakeUniqueName(), 4096);
+    auto reader = SharedMemoryPipe::Open(writer->Name());
+
+    std::vector<uint8_t> data(3000);
+    std::iota(data.begin(), data.end(), uint8_t{0});
+    std::vector<uint8_t> received(3000);
+
+    ASSERT_EQ(writer->Write(data.data(), data.size()), 3000u);
+    ASSERT_EQ(writer->Write(data.data(), data.size()), 4096u - 3000u);
+    EXPECT_EQ(writer->Write(data.data(), data.size()), 0u);
+
+    ASSERT_EQ(reader->Read(received.data(), received.size()), 3000u);
+    EXPECT_EQ(received, data);
+
+    // the second chunk wraps around the end of the ring
+    ASSERT_EQ(writer->Write(data.data() + 1096, 1904), 1904u);
+    ASSERT_EQ(reader->Read(received.data(), received.size()), 3000u);
+    EXPECT_EQ(received, data);
+}
+
+TEST(MwVAsio_SharedMemoryPipe, waiting_sides_are_reported_once)
+{
+    if (!SharedMemoryPipe::IsSupported())
+    {
+        return;
+    }
+
+    auto writer = SharedMemoryPipe::Create(SharedMemoryPipe::MakeUniqueName(), 4096);
+    auto reader = SharedMemoryPipe::Open(writer->Name());
+    const std::vector<uint8_t> data(4096);
+    std::vector<uint8_t> received(4096);
+
+    EXPECT_FALSE(writer->TakeRemoteReaderWaiting());
+    EXPECT_TRUE(reader->WaitForData());
+    EXPECT_TRUE(writer->TakeRemoteReaderWaiting());
+    EXPECT_FALSE(writer->TakeRemoteReaderWaiting());
+
+    ASSERT_EQ(writer->Write(data.data(), data.size()), data.size());
+    EXPECT_FALSE(reader->WaitForData());
+    EXPECT_TRUE(writer->WaitForSpace());
+    EXPECT_TRUE(reader->TakeRemoteWriterWaiting());
+    EXPECT_FALSE(reader->TakeRemoteWriterWaiting());
+
+    ASSERT_EQ(reader->Read(received.data(), 1), 1u);
+    EXPECT_FALSE(writer->WaitForSpace());
+}
+
+} // namespace
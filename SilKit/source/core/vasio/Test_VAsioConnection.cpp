@@ -49,6 +49,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IMessageReceiver.hpp"
 
 #include "VAsioConnection.hpp"
+#include "VAsioTcpPeer.hpp"
 #include "MockParticipant.hpp" // for DummyLogger
 #include "VAsioSerdes.hpp"
 #include "SerializedMessage.hpp"
@@ -188,6 +189,11 @@ protected:
     {
         _connection.RegisterSilKitMsgReceiver<MessageT, ServiceT>(receiver);
     }
+
+    void AddParticipantPeer(ParticipantId participantId, IVAsioPeer* peer)
+    {
+        _connection._participantIdToPeer[participantId] = peer;
+    }
 };
 
 } // namespace Core
@@ -258,6 +264,77 @@ TEST_F(VAsioConnectionTest, current_version_connect)
     _connection.OnSocketData(&_from, std::move(message));
 }
 
+//////////////////////////////////////////////////////////////////////
+// Asynchronous connection setup
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(VAsioConnectionTest, connect_async_skips_unreachable_uris)
+{
+    asio::io_context ioContext;
+
+    asio::ip::tcp::acceptor acceptor{ioContext, asio::ip::tcp::endpoint{asio::ip::address_v4::loopback(), 0}};
+    asio::ip::tcp::socket acceptedSocket{ioContext};
+    acceptor.async_accept(acceptedSocket, [](const asio::error_code&) {});
+
+    // a port without listener: bind a socket, but never listen on it
+    asio::ip::tcp::socket closedSocket{ioContext, asio::ip::tcp::endpoint{asio::ip::address_v4::loopback(), 0}};
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "Peer";
+    peerInfo.acceptorUris.push_back("local:///this/path/does/not/exist");
+    peerInfo.acceptorUris.push_back("tcp://127.0.0.1:" + std::to_string(closedSocket.local_endpoint().port()));
+    peerInfo.acceptorUris.push_back("tcp://127.0.0.1:" + std::to_string(acceptor.local_endpoint().port()));
+
+    bool isCompleted{false};
+    bool isConnected{false};
+    auto peer = VAsioTcpPeer::Create(ioContext.get_executor(), &_connection, &_dummyLogger);
+    peer->ConnectAsync(peerInfo, [&](bool connected, const std::string&) {
+        isCompleted = true;
+        isConnected = connected;
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    while (!isCompleted && std::chrono::steady_clock::now() - start < 5s)
+    {
+        ioContext.run_one_for(100ms);
+    }
+
+    EXPECT_TRUE(isCompleted);
+    EXPECT_TRUE(isConnected);
+    EXPECT_EQ(peer->GetInfo().participantName, "Peer");
+    EXPECT_TRUE(peer->Socket().is_open());
+}
+
+TEST_F(VAsioConnectionTest, connect_async_reports_failure)
+{
+    asio::io_context ioContext;
+
+    asio::ip::tcp::socket closedSocket{ioContext, asio::ip::tcp::endpoint{asio::ip::address_v4::loopback(), 0}};
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.acceptorUris.push_back("tcp://127.0.0.1:" + std::to_string(closedSocket.local_endpoint().port()));
+
+    bool isCompleted{false};
+    bool isConnected{true};
+    std::string errorMessage;
+    auto peer = VAsioTcpPeer::Create(ioContext.get_executor(), &_connection, &_dummyLogger);
+    peer->ConnectAsync(peerInfo, [&](bool connected, const std::string& error) {
+        isCompleted = true;
+        isConnected = connected;
+        errorMessage = error;
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    while (!isCompleted && std::chrono::steady_clock::now() - start < 5s)
+    {
+        ioContext.run_one_for(100ms);
+    }
+
+    EXPECT_TRUE(isCompleted);
+    EXPECT_FALSE(isConnected);
+    EXPECT_NE(errorMessage.find(peerInfo.acceptorUris.front()), std::string::npos);
+}
+
 //////////////////////////////////////////////////////////////////////
 // Versioned subscriptions: test backward compatibility
 //////////////////////////////////////////////////////////////////////
@@ -296,3 +373,205 @@ TEST_F(VAsioConnectionTest, DISABLED_versioned_send_testmessage)
 
     _connection.OnSocketData(&_from, std::move(buffer));
 }
+
+//////////////////////////////////////////////////////////////////////
+// Registry as fallback proxy
+//////////////////////////////////////////////////////////////////////
+
+namespace {
+
+auto MakeReceivedCompactProxyMessage(ParticipantId source, ParticipantId destination) -> SerializedMessage
+{
+    Tests::Version1::TestMessage message;
+    message.integer = 1234;
+    message.str = "1234";
+
+    const CompactProxyMessageHeader header{0, source, destination};
+    auto blob = std::make_shared<std::vector<uint8_t>>(
+        SerializedMessage{header, SerializedMessage{message, EndpointAddress{17, 42}, 0}}.ReleaseStorage());
+    return SerializedMessage{std::shared_ptr<const uint8_t>{blob, blob->data()}, blob->size()};
+}
+
+} // namespace
+
+TEST_F(VAsioConnectionTest, compact_proxy_message_is_forwarded_from_its_source)
+{
+    MockVAsioPeer destination;
+    AddParticipantPeer(1111, &_from);
+    AddParticipantPeer(2222, &destination);
+
+    EXPECT_CALL(destination, SendSilKitMsg(_)).Times(1);
+    _connection.OnSocketData(&_from, MakeReceivedCompactProxyMessage(1111, 2222));
+}
+
+TEST_F(VAsioConnectionTest, compact_proxy_message_with_a_spoofed_source_is_dropped)
+{
+    MockVAsioPeer source;
+    MockVAsioPeer destination;
+    AddParticipantPeer(1111, &source);
+    AddParticipantPeer(2222, &destination);
+
+    EXPECT_CALL(destination, SendSilKitMsg(_)).Times(0);
+    _connection.OnSocketData(&_from, MakeReceivedCompactProxyMessage(1111, 2222));
+
+    // a source which is not connected to the registry at all is dropped as well
+    _connection.OnSocketData(&_from, MakeReceivedCompactProxyMessage(3333, 2222));
+}
+
+//////////////////////////////////////////////////////////////////////
+// Sender-side acceptance filters
+//////////////////////////////////////////////////////////////////////
+
+TEST(VAsioTransmitterTest, send_only_to_receivers_accepting_the_message)
+{
+    using SilKit::Services::Can::WireCanFrameEvent;
+
+    testing::NiceMock<MockVAsioPeer> sender;
+    testing::NiceMock<MockVAsioPeer> unfiltered;
+    testing::NiceMock<MockVAsioPeer> filtered;
+
+    VAsioTransmitter<WireCanFrameEvent> transmitter;
+    transmitter.AddRemoteReceiver(&unfiltered, 1);
+    transmitter.AddRemoteReceiver(&filtered, 2);
+
+    AcceptanceFilter filter;
+    filter.rules.push_back(AcceptanceRule{0x100, 0x7F0});
+    transmitter.SetRemoteReceiverFilter(&filtered, 2, filter);
+
+    WireCanFrameEvent accepted{};
+    accepted.frame.canId = 0x105;
+    WireCanFrameEvent rejected{};
+    rejected.frame.canId = 0x205;
+
+    EXPECT_CALL(unfiltered, SendSilKitMsg(_)).Times(2);
+    EXPECT_CALL(filtered, SendSilKitMsg(_)).Times(1);
+    transmitter.ReceiveMsg(&sender, accepted);
+    transmitter.ReceiveMsg(&sender, rejected);
+}
+
+TEST(VAsioTransmitterTest, reset_filter_accepts_all_messages)
+{
+    using SilKit::Services::Can::WireCanFrameEvent;
+
+    testing::NiceMock<MockVAsioPeer> sender;
+    testing::NiceMock<MockVAsioPeer> filtered;
+
+    VAsioTransmitter<WireCanFrameEvent> transmitter;
+    transmitter.AddRemoteReceiver(&filtered, 1);
+
+    AcceptanceFilter filter;
+    filter.rules.push_back(AcceptanceRule{0x100, 0x7FF});
+    transmitter.SetRemoteReceiverFilter(&filtered, 1, filter);
+
+    WireCanFrameEvent msg{};
+    msg.frame.canId = 0x200;
+
+    EXPECT_CALL(filtered, SendSilKitMsg(_)).Times(0);
+    transmitter.ReceiveMsg(&sender, msg);
+    testing::Mock::VerifyAndClearExpectations(&filtered);
+
+    transmitter.SetRemoteReceiverFilter(&filtered, 1, AcceptanceFilter{});
+    EXPECT_CALL(filtered, SendSilKitMsg(_)).Times(1);
+    transmitter.ReceiveMsg(&sender, msg);
+}
+
+TEST(VAsioTransmitterTest, ethernet_filter_accepts_group_destinations)
+{
+    using SilKit::Services::Ethernet::WireEthernetFrameEvent;
+
+    const std::vector<uint8_t> unicastMac{0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+    const std::vector<uint8_t> otherMac{0x02, 0x00, 0x00, 0x00, 0x00, 0x02};
+    const std::vector<uint8_t> broadcastMac{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+    AcceptanceFilter filter;
+    filter.rules.push_back(MakeEthernetGroupMacAcceptanceRule());
+    filter.rules.push_back(AcceptanceRule{MakeEthernetMacAcceptanceKey(unicastMac.data()), (uint64_t{1} << 48) - 1});
+
+    auto makeFrameEvent = [](std::vector<uint8_t> raw) {
+        WireEthernetFrameEvent frameEvent{};
+        raw.resize(64);
+        frameEvent.frame.raw = SilKit::Util::SharedVector<uint8_t>{std::move(raw)};
+        return frameEvent;
+    };
+    using Key = AcceptanceKey<WireEthernetFrameEvent>;
+    EXPECT_TRUE(filter.Accepts(Key::Get(makeFrameEvent(unicastMac))));
+    EXPECT_TRUE(filter.Accepts(Key::Get(makeFrameEvent(broadcastMac))));
+    EXPECT_FALSE(filter.Accepts(Key::Get(makeFrameEvent(otherMac))));
+}
+
+TEST(VAsioTransmitterTest, merged_filter_accepts_union)
+{
+    AcceptanceFilter lhs;
+    lhs.rules.push_back(AcceptanceRule{0x100, 0x7FF});
+    AcceptanceFilter rhs;
+    rhs.rules.push_back(AcceptanceRule{0x200, 0x7FF});
+
+    auto merged = lhs;
+    merged.Merge(rhs);
+    EXPECT_TRUE(merged.Accepts(0x100));
+    EXPECT_TRUE(merged.Accepts(0x200));
+    EXPECT_FALSE(merged.Accepts(0x300));
+
+    merged.Merge(AcceptanceFilter{});
+    EXPECT_TRUE(merged.AcceptsAll());
+}
+
+TEST(VAsioTransmitterTest, targeted_messages_are_sent_to_the_receiver_of_the_participant)
+{
+    using SilKit::Services::Can::WireCanFrameEvent;
+
+    testing::NiceMock<MockVAsioPeer> sender;
+    testing::NiceMock<MockVAsioPeer> first;
+    testing::NiceMock<MockVAsioPeer> second;
+    first._peerInfo.participantName = "First";
+    first._peerInfo.participantId = 1;
+    second._peerInfo.participantName = "Second";
+    second._peerInfo.participantId = 2;
+
+    VAsioTransmitter<WireCanFrameEvent> transmitter;
+    transmitter.AddRemoteReceiver(&first, 1);
+    transmitter.AddRemoteReceiver(&second, 2);
+
+    SerializedMessage sent{VAsioMsgSubscriber{}};
+    EXPECT_CALL(first, SendSilKitMsg(_)).Times(0);
+    EXPECT_CALL(second, SendSilKitMsg(_)).WillOnce(testing::SaveArg<0>(&sent));
+    transmitter.SendMessageToTarget(&sender, "Second", WireCanFrameEvent{});
+    EXPECT_EQ(sent.GetRemoteIndex(), 2u);
+    EXPECT_EQ(sent.GetEndpointAddress(), sender._serviceDescriptor.to_endpointAddress());
+    testing::Mock::VerifyAndClearExpectations(&first);
+    testing::Mock::VerifyAndClearExpectations(&second);
+
+    // the receivers behind a removed one are still found
+    transmitter.RemoveRemoteReceiver(&first);
+    EXPECT_CALL(second, SendSilKitMsg(_)).Times(1);
+    transmitter.SendMessageToTarget(&sender, "Second", WireCanFrameEvent{});
+    EXPECT_THROW(transmitter.SendMessageToTarget(&sender, "First", WireCanFrameEvent{}), SilKit::SilKitError);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Local distribution
+//////////////////////////////////////////////////////////////////////
+
+TEST(SilKitLinkTest, local_messages_are_not_delivered_to_the_sender)
+{
+    SilKit::Services::Orchestration::TimeProvider timeProvider;
+    Tests::MockLogger logger;
+
+    testing::NiceMock<MockSilKitMessageReceiver> sender;
+    testing::NiceMock<MockSilKitMessageReceiver> receiver;
+    receiver._serviceDescriptor.SetServiceId(2);
+    // a different endpoint object with the sender's identity
+    testing::NiceMock<MockSilKitMessageReceiver> senderAlias;
+
+    SilKitLink<Tests::TestFrameEvent> link{"link", &logger, &timeProvider};
+    link.AddLocalReceiver(&sender);
+    link.AddLocalReceiver(&receiver);
+    link.AddLocalReceiver(&senderAlias);
+    link.AddLocalReceiver(&receiver);
+
+    EXPECT_CALL(sender, ReceiveMsg(_, testing::An<const Tests::TestFrameEvent&>())).Times(0);
+    EXPECT_CALL(senderAlias, ReceiveMsg(_, testing::An<const Tests::TestFrameEvent&>())).Times(0);
+    EXPECT_CALL(receiver, ReceiveMsg(&sender, testing::An<const Tests::TestFrameEvent&>())).Times(1);
+
+    link.DistributeLocalSilKitMessage(&sender, Tests::TestFrameEvent{});
+}
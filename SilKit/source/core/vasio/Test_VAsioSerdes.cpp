@@ -47,7 +47,8 @@ bool operator==(const ParticipantAnnouncementReply& lhs, const ParticipantAnnoun
 
 bool operator==(const KnownParticipants& lhs, const KnownParticipants& rhs)
 {
-    return lhs.messageHeader == rhs.messageHeader && lhs.peerInfos == rhs.peerInfos;
+    return lhs.messageHeader == rhs.messageHeader && lhs.peerInfos == rhs.peerInfos
+           && lhs.registryCapabilities == rhs.registryCapabilities;
 }
 
 } // namespace Core
@@ -136,6 +137,7 @@ TEST(MwVAsioSerdes, vasio_knownParticipants)
         vpi.acceptorUris.push_back("local://localhost");
         in.peerInfos.emplace_back(std::move(vpi));
     }
+    in.registryCapabilities = "compact-proxy-message";
 
     Serialize(buffer, in);
     Deserialize(buffer, out);
@@ -143,4 +145,51 @@ TEST(MwVAsioSerdes, vasio_knownParticipants)
     EXPECT_EQ(in, out);
 }
 
+TEST(MwVAsioSerdes, vasio_compactProxyMessageHeader)
+{
+    MessageBuffer buffer;
+    const CompactProxyMessageHeader in{0, 0x1122334455667788, 0x8877665544332211};
+
+    SerializeCompactProxyMessageHeader(buffer, in);
+    EXPECT_EQ(buffer.WritePos(), 17u);
+
+    const auto out = ExtractCompactProxyMessageHeader(buffer);
+    EXPECT_EQ(out.version, in.version);
+    EXPECT_EQ(out.source, in.source);
+    EXPECT_EQ(out.destination, in.destination);
+}
+
+TEST(MwVAsioSerdes, vasio_sharedMemoryTransportMessage)
+{
+    MessageBuffer buffer;
+    SharedMemoryTransportMessage in{};
+    SharedMemoryTransportMessage out{};
+
+    in.kind = SharedMemoryTransportMessage::Kind::Request;
+    in.segmentName = "/SilKit-1234-0";
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(in.kind, out.kind);
+    EXPECT_EQ(in.segmentName, out.segmentName);
+}
+
+TEST(MwVAsioSerdes, vasio_subscriptionFilter)
+{
+    MessageBuffer buffer;
+    SubscriptionFilter in{};
+    SubscriptionFilter out{};
+
+    in.subscriber = MakeSubscriber();
+    in.filter.rules.push_back(AcceptanceRule{0x100, 0x7F0});
+    in.filter.rules.push_back(AcceptanceRule{0x0000'0100'0000'0000, 0x0000'0100'0000'0000});
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(in.subscriber, out.subscriber);
+    EXPECT_EQ(in.filter, out.filter);
+}
+
 } // namespace
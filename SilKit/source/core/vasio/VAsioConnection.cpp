@@ -36,6 +36,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ILogger.hpp"
 #include "VAsioTcpPeer.hpp"
 #include "VAsioProxyPeer.hpp"
+#include "SharedMemoryPipe.hpp"
 #include "Filesystem.hpp"
 #include "SetThreadName.hpp"
 #include "Uri.hpp"
@@ -46,6 +47,9 @@ namespace fs = SilKit::Filesystem;
 
 namespace {
 
+// Upper bound for the number of known participants that are connected to concurrently
+constexpr std::size_t MaxConcurrentPeerConnects{16};
+
 // only TCP/IP need platform tweaks
 template<typename AcceptorT>
 void SetPlatformOptions(AcceptorT&)
@@ -273,11 +277,22 @@ auto GetCurrentCapabilities(const SilKit::Config::ParticipantConfiguration& part
     if (participantConfiguration.middleware.registryAsFallbackProxy)
     {
         capabilities.AddCapability("proxy-message");
+        capabilities.AddCapability("compact-proxy-message");
+    }
+
+    if (participantConfiguration.middleware.enableSharedMemory && SilKit::Core::SharedMemoryPipe::IsSupported())
+    {
+        capabilities.AddCapability("shared-memory");
     }
 
     return capabilities.ToCapabilitiesString();
 }
 
+auto CapabilitiesSupportCompactProxyMessage(const SilKit::Core::VAsioCapabilities& capabilities) -> bool
+{
+    return capabilities.HasCapability("compact-proxy-message");
+}
+
 auto CapabilitiesSupportProxyMessage(const SilKit::Core::VAsioCapabilities& capabilities) -> bool
 {
     return capabilities.HasCapability("proxy-message");
@@ -330,11 +345,26 @@ VAsioConnection::VAsioConnection(SilKit::Config::ParticipantConfiguration config
     : _config{std::move(config)}
     , _participantName{std::move(participantName)}
     , _participantId{participantId}
+    , _participantNameHash{SilKit::Util::Hash::Hash(_participantName)}
     , _timeProvider{timeProvider}
     , _version{version}
 {
+    if (HasMultipleIoWorkers())
+    {
+        _ioExecutor = asio::make_strand(_ioContext);
+    }
+    else
+    {
+        _ioExecutor = _ioContext.get_executor();
+    }
+
     RegisterPeerShutdownCallback([this](IVAsioPeer* peer) { UpdateParticipantStatusOnConnectionLoss(peer); });
-    _hashToParticipantName.insert(std::pair<uint64_t, std::string>(SilKit::Util::Hash::Hash(_participantName), _participantName));
+    _hashToParticipantName.insert(std::pair<uint64_t, std::string>(_participantNameHash, _participantName));
+}
+
+auto VAsioConnection::GetCapabilities() const -> std::string
+{
+    return GetCurrentCapabilities(_config);
 }
 
 VAsioConnection::~VAsioConnection()
@@ -350,10 +380,13 @@ VAsioConnection::~VAsioConnection()
     }
     lock.unlock();
 
-    if (_ioWorker.joinable())
+    _ioContext.stop();
+    for (auto& ioWorker : _ioWorkers)
     {
-        _ioContext.stop();
-        _ioWorker.join();
+        if (ioWorker.joinable())
+        {
+            ioWorker.join();
+        }
     }
 
     // clean up local ipc sockets
@@ -411,7 +444,7 @@ void VAsioConnection::OpenTcpAcceptors(const std::vector<std::string> & acceptor
                     Services::Logging::Debug(_logger, "Accepting {} connections on {}:{}",
                                              (address.is_v4() ? "TCPv4" : "TCPv6"), uri.Host(), uri.Port());
 
-                    _tcpAcceptors.emplace_back(_ioContext);
+                    _tcpAcceptors.emplace_back(_ioExecutor);
                     auto& acceptor = _tcpAcceptors.back();
 
                     try
@@ -460,7 +493,7 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string> & accept
             // file must not exist before we bind/listen on it
             (void)fs::remove(endpoint.path());
 
-            _localAcceptors.emplace_back(_ioContext);
+            _localAcceptors.emplace_back(_ioExecutor);
             auto& acceptor = _localAcceptors.back();
 
             try
@@ -506,7 +539,7 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
         throw SilKitError{"JoinSimulation: no acceptors available"};
     }
 
-    auto registry = VAsioTcpPeer::Create(_ioContext.get_executor(), this, _logger);
+    auto registry = VAsioTcpPeer::Create(MakePeerExecutor(), this, _logger);
     bool ok = false;
 
     // NB: We attempt to connect multiple times. The registry might be a separate process
@@ -647,7 +680,7 @@ void VAsioConnection::SendParticipantAnnouncement(IVAsioPeer* peer)
 {
     // Legacy Info for interop
     // URI encoded infos
-    VAsioPeerInfo info{_participantName, _participantId, {}, GetCurrentCapabilities(_config)};
+    VAsioPeerInfo info{_participantName, _participantId, {}, GetCapabilities()};
 
     size_t openAcceptorCount = 0;
 
@@ -776,6 +809,8 @@ void VAsioConnection::SendParticipantAnnouncementReply(IVAsioPeer* peer)
                              peer->GetInfo().participantName, ExtractProtocolVersion(reply.remoteHeader));
 
     peer->SendSilKitMsg(SerializedMessage{peer->GetProtocolVersion(), reply});
+    // the filters refer to the subscribers of the reply and must follow it
+    SendSubscriptionFilters(peer);
 }
 
 void VAsioConnection::SendFailedParticipantAnnouncementReply(IVAsioPeer* peer, ProtocolVersion version,
@@ -869,129 +904,191 @@ void VAsioConnection::ReceiveKnownParticpants(IVAsioPeer* peer, SerializedMessag
     }
 
     _hasReceivedKnownParticipants = true;
+    // Registries before 4.0.30 do not announce their capabilities
+    _registrySupportsCompactProxyMessage =
+        !participantsMsg.registryCapabilities.empty()
+        && CapabilitiesSupportCompactProxyMessage(VAsioCapabilities{participantsMsg.registryCapabilities});
 
     Services::Logging::Debug(_logger, "Received known participants list from SilKitRegistry protocol {}.{}",
                              participantsMsg.messageHeader.versionHigh, participantsMsg.messageHeader.versionLow);
 
-    auto connectPeer = [this](const VAsioPeerInfo peerInfo) {
-        Services::Logging::Debug(_logger, "Connecting to {} with Id {} on {}", peerInfo.participantName,
-                                 peerInfo.participantId, printUris(peerInfo));
-
+    for (auto&& peerInfo : participantsMsg.peerInfos)
+    {
         // Create the "direct-connection" peer
-        auto directPeer = VAsioTcpPeer::Create(_ioContext.get_executor(), this, _logger);
+        auto directPeer = VAsioTcpPeer::Create(MakePeerExecutor(), this, _logger);
+        directPeer->SetInfo(peerInfo);
 
-        // Remember that we expect a reply from this peer
+        // Remember that we expect a reply from this peer, before trying to connect to it. Otherwise, no suitable
+        // error will be raised if the connection cannot be established.
         _pendingParticipantReplies.push_back(directPeer);
+        _queuedPeerConnects.push_back(std::move(directPeer));
+    }
 
-        std::shared_ptr<IVAsioConnectionPeer> peer;
+    StartQueuedPeerConnects();
 
-        // Try to connect to the peer only _after_ remembering that we need to connect, otherwise suitable error will
-        // be raised.
-        try
-        {
-            directPeer->Connect(peerInfo);
-            peer = std::move(directPeer);
-        }
-        catch (const std::exception& exception)
-        {
-            SilKit::Services::Logging::Warn(
-                _logger,
-                "VAsioConnection: Failed to connect directly to {}, trying to proxy messages through the registry: {}",
-                peerInfo.participantName, exception.what());
+    if (_pendingParticipantReplies.empty())
+    {
+        _receivedAllParticipantReplies.set_value();
+    }
+    Services::Logging::Trace(_logger, "SIL Kit is waiting for {} ParticipantAnnouncementReplies",
+                             _pendingParticipantReplies.size());
+}
 
-            if (!_config.middleware.registryAsFallbackProxy)
-            {
-                SilKit::Services::Logging::Warn(_logger,
-                                                "VAsioConnection: Cannot use ProxyMessage to communicate with {}, "
-                                                "because it is disabled in the configuration",
-                                                peerInfo.participantName);
-                return;
-            }
 
-            // NB: Cannot check the capabilities of the registry, since we do not receive the PeerInfo from the
-            //       registry over the network, but build it ourselves in VAsioConnection::JoinSimulation.
-            //       This is not be a huge issue, since we can just 'throw the messages at the registry' and will
-            //       fail with the participant-connection-timeout if it is not capable of routing it to the other
-            //       participant.
 
-            // Parse the capabilities reported in the remotes VAsioPeerInfo
-            VAsioCapabilities capabilities{peerInfo.capabilities};
+void VAsioConnection::StartQueuedPeerConnects()
+{
+    while (!_queuedPeerConnects.empty() && _activePeerConnects < MaxConcurrentPeerConnects)
+    {
+        auto directPeer = std::move(_queuedPeerConnects.front());
+        _queuedPeerConnects.pop_front();
+        ++_activePeerConnects;
 
-            // To use the ProxyMessage, the peer we're trying to connect to must support it
-            if (!CapabilitiesSupportProxyMessage(capabilities))
-            {
-                SilKit::Services::Logging::Warn(_logger,
-                                                "VAsioConnection: Cannot use ProxyMessage to communicate with {}, "
-                                                "because {} does not support it",
-                                                peerInfo.participantName, peerInfo.participantName);
-                return;
-            }
+        const auto& peerInfo = directPeer->GetInfo();
+        Services::Logging::Debug(_logger, "Connecting to {} with Id {} on {}", peerInfo.participantName,
+                                 peerInfo.participantId, printUris(peerInfo));
 
-            // Remove the "direct-connection" peer from the list of peers we expect an answer from
-            auto it = std::find(_pendingParticipantReplies.begin(), _pendingParticipantReplies.end(), directPeer);
-            _pendingParticipantReplies.erase(it);
-            // Destroy the peer object
-            directPeer = nullptr;
+        directPeer->ConnectAsync(peerInfo, [this, directPeer](bool connected, const std::string& errorMessage) {
+            // the handler runs on the executor of the peer
+            asio::dispatch(_ioExecutor, [this, directPeer, connected, errorMessage] {
+                --_activePeerConnects;
+                OnPeerConnectCompleted(directPeer, connected, errorMessage);
+                StartQueuedPeerConnects();
+            });
+        });
+    }
+}
+
+void VAsioConnection::OnPeerConnectCompleted(std::shared_ptr<VAsioTcpPeer> directPeer, bool connected,
+                                             const std::string& errorMessage)
+{
+    const auto peerInfo = directPeer->GetInfo();
 
-            // Create the "proxy-peer" object
-            peer = std::make_shared<VAsioProxyPeer>(this, peerInfo, _registry.get(), _logger);
-            // Remember that we expect a reply from this peer
-            _pendingParticipantReplies.push_back(peer);
+    std::shared_ptr<IVAsioConnectionPeer> peer;
+    if (connected)
+    {
+        peer = directPeer;
+    }
+    else
+    {
+        SilKit::Services::Logging::Warn(
+            _logger,
+            "VAsioConnection: Failed to connect directly to {}, trying to proxy messages through the registry: {}",
+            peerInfo.participantName, errorMessage);
+
+        if (!_config.middleware.registryAsFallbackProxy)
+        {
+            SilKit::Services::Logging::Warn(_logger,
+                                            "VAsioConnection: Cannot use ProxyMessage to communicate with {}, "
+                                            "because it is disabled in the configuration",
+                                            peerInfo.participantName);
+            return;
         }
 
-        // We connected to the other peer. tell him who we are.
-        SendParticipantAnnouncement(peer.get());
+        // NB: Cannot check the capabilities of the registry, since we do not receive the PeerInfo from the
+        //       registry over the network, but build it ourselves in VAsioConnection::JoinSimulation.
+        //       This is not be a huge issue, since we can just 'throw the messages at the registry' and will
+        //       fail with the participant-connection-timeout if it is not capable of routing it to the other
+        //       participant.
 
-        // The service ID is incomplete at this stage.
-        ServiceDescriptor peerId;
-        peerId.SetParticipantNameAndComputeId(peerInfo.participantName);
-        peer->SetServiceDescriptor(peerId);
+        // Parse the capabilities reported in the remotes VAsioPeerInfo
+        VAsioCapabilities capabilities{peerInfo.capabilities};
 
-        const auto result =
-            _hashToParticipantName.insert({SilKit::Util::Hash::Hash(peerInfo.participantName), peerInfo.participantName});
-        if (result.second == false)
+        // To use the ProxyMessage, the peer we're trying to connect to must support it
+        if (!CapabilitiesSupportProxyMessage(capabilities))
         {
-            SILKIT_ASSERT(false);
+            SilKit::Services::Logging::Warn(_logger,
+                                            "VAsioConnection: Cannot use ProxyMessage to communicate with {}, "
+                                            "because {} does not support it",
+                                            peerInfo.participantName, peerInfo.participantName);
+            return;
         }
 
-        AssociateParticipantNameAndPeer(peer->GetInfo().participantName, peer.get());
-        AddPeer(std::move(peer));
-    };
-    // check URI first
-    for (auto&& peerInfo : participantsMsg.peerInfos)
-    {
-        connectPeer(peerInfo);
+        // Remove the "direct-connection" peer from the list of peers we expect an answer from
+        auto it = std::find(_pendingParticipantReplies.begin(), _pendingParticipantReplies.end(), directPeer);
+        if (it != _pendingParticipantReplies.end())
+        {
+            _pendingParticipantReplies.erase(it);
+        }
+        // Destroy the peer object
+        directPeer = nullptr;
+
+        // Create the "proxy-peer" object
+        auto proxyPeer = std::make_shared<VAsioProxyPeer>(this, peerInfo, _registry.get(), _logger);
+        // The registry forwards compact proxy messages without deserializing them, if both ends support them
+        if (_registrySupportsCompactProxyMessage && CapabilitiesSupportCompactProxyMessage(capabilities))
+        {
+            proxyPeer->EnableCompactFraming(SilKit::Util::Hash::Hash(peerInfo.participantName));
+        }
+        peer = std::move(proxyPeer);
+        // Remember that we expect a reply from this peer
+        _pendingParticipantReplies.push_back(peer);
     }
 
-    if (_pendingParticipantReplies.empty())
+    // We connected to the other peer. tell him who we are.
+    SendParticipantAnnouncement(peer.get());
+
+    if (directPeer)
     {
-        _receivedAllParticipantReplies.set_value();
+        // Peers on the same host may continue via shared memory, if both support it
+        directPeer->RequestSharedMemoryTransport();
     }
-    Services::Logging::Trace(_logger, "SIL Kit is waiting for {} ParticipantAnnouncementReplies",
-                             _pendingParticipantReplies.size());
-}
 
+    // The service ID is incomplete at this stage.
+    ServiceDescriptor peerId;
+    peerId.SetParticipantNameAndComputeId(peerInfo.participantName);
+    peer->SetServiceDescriptor(peerId);
 
+    const auto result =
+        _hashToParticipantName.insert({SilKit::Util::Hash::Hash(peerInfo.participantName), peerInfo.participantName});
+    if (result.second == false)
+    {
+        SILKIT_ASSERT(false);
+    }
+
+    AssociateParticipantNameAndPeer(peer->GetInfo().participantName, peer.get());
+    AddPeer(std::move(peer));
+}
 
 void VAsioConnection::AssociateParticipantNameAndPeer(const std::string& participantName, IVAsioPeer* peer)
 {
     _participantNameToPeer.insert({participantName, peer});
+    _participantIdToPeer.insert({SilKit::Util::Hash::Hash(participantName), peer});
 }
 void VAsioConnection::StartIoWorker()
 {
-    _ioWorker = std::thread{[this]() {
-        try
-        {
-            SilKit::Util::SetThreadName("SilKit-IOWorker");
-            _ioContext.run();
-            return 0;
-        }
-        catch (const std::exception& error)
-        {
-            Services::Logging::Error(_logger, "SilKit-IOWorker: Something went wrong: {}", error.what());
-            return -1;
-        }
-    }};
+    const auto numberOfIoWorkers = (std::max)(_config.middleware.ioWorkerThreads, 1);
+    for (auto i = 0; i < numberOfIoWorkers; ++i)
+    {
+        _ioWorkers.emplace_back([this]() {
+            try
+            {
+                SilKit::Util::SetThreadName("SilKit-IOWorker");
+                _ioContext.run();
+                return 0;
+            }
+            catch (const std::exception& error)
+            {
+                Services::Logging::Error(_logger, "SilKit-IOWorker: Something went wrong: {}", error.what());
+                return -1;
+            }
+        });
+    }
+}
+
+bool VAsioConnection::HasMultipleIoWorkers() const
+{
+    return _config.middleware.ioWorkerThreads > 1;
+}
+
+auto VAsioConnection::MakePeerExecutor() -> asio::any_io_executor
+{
+    if (HasMultipleIoWorkers())
+    {
+        // the reads and writes of a single peer are serialized, different peers are served concurrently
+        return asio::make_strand(_ioContext);
+    }
+    return _ioContext.get_executor();
 }
 
 void VAsioConnection::AcceptLocalConnections(const std::string& uniqueId)
@@ -1001,7 +1098,7 @@ void VAsioConnection::AcceptLocalConnections(const std::string& uniqueId)
     // file must not exist before we bind/listen on it
     (void)fs::remove(localEndpoint.path());
 
-    _localAcceptors.emplace_back(_ioContext);
+    _localAcceptors.emplace_back(_ioExecutor);
     auto &acceptor = _localAcceptors.back();
 
     AcceptConnectionsOn(acceptor, localEndpoint);
@@ -1036,7 +1133,7 @@ auto VAsioConnection::AcceptTcpConnectionsOn(const std::string& hostName, uint16
                        (isIpv4(endpoint) ? "TCPv4" : "TCPv6"));
     }
 
-    _tcpAcceptors.emplace_back(_ioContext);
+    _tcpAcceptors.emplace_back(_ioExecutor);
     auto &acceptor = _tcpAcceptors.back();
 
     const auto localEndpoint = AcceptConnectionsOn(acceptor, endpoint);
@@ -1066,7 +1163,7 @@ auto VAsioConnection::AcceptConnectionsOn(AcceptorT& acceptor, EndpointT endpoin
     catch (const std::exception& e)
     {
         Services::Logging::Error(_logger, "SIL Kit failed to listening on {}: {}", endpoint, e.what());
-        acceptor = AcceptorT{_ioContext}; // Reset socket
+        acceptor = AcceptorT{_ioExecutor}; // Reset socket
         throw;
     }
 
@@ -1083,7 +1180,7 @@ void VAsioConnection::AcceptNextConnection(AcceptorT& acceptor)
     std::shared_ptr<VAsioTcpPeer> newConnection;
     try
     {
-        newConnection = VAsioTcpPeer::Create(_ioContext.get_executor(), this, _logger);
+        newConnection = VAsioTcpPeer::Create(MakePeerExecutor(), this, _logger);
     }
     catch (const std::exception& e)
     {
@@ -1127,6 +1224,17 @@ void VAsioConnection::RegisterPeerShutdownCallback(std::function<void(IVAsioPeer
 }
 
 void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
+{
+    if (HasMultipleIoWorkers())
+    {
+        // Usually called on the strand of the peer. Posting keeps the shutdown behind the received messages.
+        asio::post(_ioExecutor, [this, peer] { OnPeerShutdownImpl(peer); });
+        return;
+    }
+    OnPeerShutdownImpl(peer);
+}
+
+void VAsioConnection::OnPeerShutdownImpl(IVAsioPeer* peer)
 {
     if (!_isShuttingDown)
     {
@@ -1145,7 +1253,7 @@ void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
 
         for (IVAsioPeer* const proxyPeer : proxyPeers)
         {
-            OnPeerShutdown(proxyPeer);
+            OnPeerShutdownImpl(proxyPeer);
         }
 
         {
@@ -1160,6 +1268,7 @@ void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
 
             RemovePeerFromLinks(peer);
             RemovePeerFromConnection(peer);
+            _remoteServiceEndpoints.erase(peer);
         }
     }
 }
@@ -1168,21 +1277,21 @@ void VAsioConnection::SendProxyPeerShutdownNotification(IVAsioPeer* peer)
 {
     const auto & source = peer->GetInfo().participantName;
 
-    const auto proxyDestinationsIt = _proxySourceToDestinations.find(source);
+    const auto proxyDestinationsIt = _proxySourceToDestinations.find(SilKit::Util::Hash::Hash(source));
     if (proxyDestinationsIt != _proxySourceToDestinations.end())
     {
-        for (const auto& destination : proxyDestinationsIt->second)
+        for (const auto destination : proxyDestinationsIt->second)
         {
-            // if a destination participant name has no associated peer, ignore it, it was already been disconnected
-            const auto peerIt = _participantNameToPeer.find(destination);
-            if (peerIt == _participantNameToPeer.end())
+            // if a destination participant has no associated peer, ignore it, it was already been disconnected
+            const auto peerIt = _participantIdToPeer.find(destination);
+            if (peerIt == _participantIdToPeer.end())
             {
                 continue;
             }
 
             ProxyMessage msg{};
             msg.source = source;
-            msg.destination = destination;
+            msg.destination = peerIt->second->GetInfo().participantName;
             msg.payload.clear();
 
             peerIt->second->SendSilKitMsg(SerializedMessage{std::move(msg)});
@@ -1206,6 +1315,7 @@ void VAsioConnection::RemovePeerFromLinks(IVAsioPeer* peer)
 void VAsioConnection::RemovePeerFromConnection(IVAsioPeer* peer)
 {
     _participantNameToPeer.erase(peer->GetInfo().participantName);
+    _participantIdToPeer.erase(SilKit::Util::Hash::Hash(peer->GetInfo().participantName));
 
     auto it = std::find_if(_peers.begin(), _peers.end(), [peer](auto&& p) {
         auto localPeerInfo = p->GetInfo();
@@ -1257,6 +1367,42 @@ void VAsioConnection::UpdateParticipantStatusOnConnectionLoss(IVAsioPeer* peer)
 }
 
 void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    if (!HasMultipleIoWorkers())
+    {
+        // the peers share the single I/O thread with the connection
+        ProcessSocketData(from, std::move(buffer));
+        return;
+    }
+
+    // Called on the strand of the peer. Simulation messages are deserialized right here, only the distribution to
+    // the links is serialized on the connection's executor. Posting preserves the order of the peer's messages.
+    if (IsMwOrSim(buffer.GetMessageKind()))
+    {
+        const auto receiverIdx = buffer.GetRemoteIndex();
+        auto* receiver = GetVAsioReceiver(receiverIdx);
+        if (receiver == nullptr)
+        {
+            Services::Logging::Warn(_logger, "Ignoring RawSilKitMessage for unknown receiverIdx={}", receiverIdx);
+            return;
+        }
+
+        const auto endpointAddress = buffer.GetEndpointAddress();
+        auto distribute = receiver->DeserializeRawMsg(std::move(buffer));
+        asio::post(_ioExecutor, [this, from, endpointAddress, distribute = std::move(distribute)] {
+            distribute(GetRemoteServiceEndpoint(from, endpointAddress));
+        });
+        return;
+    }
+
+    asio::post(_ioExecutor, [this, from, buffer = std::move(buffer)]() mutable {
+        // the protocol version of the peer might have been set after the message was received
+        buffer.SetProtocolVersion(from->GetProtocolVersion());
+        ProcessSocketData(from, std::move(buffer));
+    });
+}
+
+void VAsioConnection::ProcessSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
 {
     auto messageKind = buffer.GetMessageKind();
     switch (messageKind)
@@ -1276,6 +1422,13 @@ void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
         return ReceiveRegistryMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitProxyMessage:
         return ReceiveProxyMessage(from, std::move(buffer));
+    case VAsioMsgKind::SharedMemoryTransport:
+        // handled by the VAsioTcpPeer, never forwarded to the connection
+        break;
+    case VAsioMsgKind::SilKitCompactProxyMessage:
+        return ReceiveCompactProxyMessage(from, std::move(buffer));
+    case VAsioMsgKind::SubscriptionFilter:
+        return ReceiveSubscriptionFilter(from, std::move(buffer));
     }
 }
 
@@ -1324,7 +1477,8 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         // We are relaying a message from source to destination and acting as a proxy. Record the association between
         // source and destination. This is used during disconnects, where we create empty ProxyMessages on behalf of
         // the disconnected peer, to inform the destination that the source peer has disconnected.
-        _proxySourceToDestinations[proxyMessage.source].insert(proxyMessage.destination);
+        _proxySourceToDestinations[SilKit::Util::Hash::Hash(proxyMessage.source)].insert(
+            SilKit::Util::Hash::Hash(proxyMessage.destination));
 
         return;
     }
@@ -1357,11 +1511,84 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         }
         else
         {
-            OnSocketData(peer, SerializedMessage{std::move(proxyMessage.payload)});
+            ProcessSocketData(peer, SerializedMessage{std::move(proxyMessage.payload)});
+        }
+
+        return;
+    }
+}
+
+void VAsioConnection::ReceiveCompactProxyMessage(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    const auto header = buffer.GetCompactProxyMessageHeader();
+    if (header.version != 0)
+    {
+        static SilKit::Services::Logging::LogOnceFlag onceFlag;
+        SilKit::Services::Logging::Warn(
+            _logger, onceFlag,
+            "Ignoring VAsioMsgKind::SilKitCompactProxyMessage because message version is not supported: version {}",
+            header.version);
+        return;
+    }
+
+    if (!_config.middleware.registryAsFallbackProxy)
+    {
+        static SilKit::Services::Logging::LogOnceFlag onceFlag;
+        SilKit::Services::Logging::Warn(
+            _logger, onceFlag,
+            "Ignoring VAsioMsgKind::SilKitCompactProxyMessage because feature is disabled via configuration: From {}",
+            from->GetInfo().participantName);
+        return;
+    }
+
+    if (header.destination != _participantNameHash)
+    {
+        // Like for the classic ProxyMessage, only messages received from their source are relayed
+        const auto sourceIt = _participantIdToPeer.find(header.source);
+        if (sourceIt == _participantIdToPeer.end() || sourceIt->second != from)
+        {
+            SilKit::Services::Logging::Warn(
+                _logger, "Dropping compact proxy message from {} with the source {}, which is not the sender",
+                from->GetInfo().participantName, header.source);
+            return;
+        }
+
+        auto it = _participantIdToPeer.find(header.destination);
+        if (it == _participantIdToPeer.end())
+        {
+            SilKit::Services::Logging::Error(_logger, "Unable to deliver compact proxy message from {} to {}",
+                                             from->GetInfo().participantName, header.destination);
+            return;
         }
 
+        // Only the fixed-size header is written again, the bytes of the proxied message are forwarded as received
+        it->second->SendSilKitMsg(std::move(buffer));
+
+        // Record the association between source and destination, see ReceiveProxyMessage
+        _proxySourceToDestinations[header.source].insert(header.destination);
         return;
     }
+
+    IVAsioPeer* peer{nullptr};
+
+    auto it = _participantIdToPeer.find(header.source);
+    if (it == _participantIdToPeer.end())
+    {
+        SilKit::Services::Logging::Debug(_logger, "Creating VAsioProxyPeer ({})", header.source);
+
+        auto proxyPeer = std::make_shared<VAsioProxyPeer>(this, VAsioPeerInfo{}, from, _logger);
+        // The source and the registry support compact proxy messages, so the replies use them as well
+        proxyPeer->EnableCompactFraming(header.source);
+        AddPeer(proxyPeer);
+
+        peer = proxyPeer.get();
+    }
+    else
+    {
+        peer = it->second;
+    }
+
+    ProcessSocketData(peer, buffer.GetProxiedMessage());
 }
 
 void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer)
@@ -1429,6 +1656,81 @@ void VAsioConnection::ReceiveSubscriptionAcknowledge(IVAsioPeer* from, Serialize
     RemovePendingSubscription({from, ack.subscriber});
 }
 
+void VAsioConnection::ReceiveSubscriptionFilter(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto subscriptionFilter = buffer.Deserialize<SubscriptionFilter>();
+    const auto& subscriber = subscriptionFilter.subscriber;
+
+    tt::for_each(_links, [this, from, &subscriptionFilter, &subscriber](auto&& linkMap) {
+        using LinkPtr = typename std::decay_t<decltype(linkMap)>::mapped_type;
+        using LinkType = typename LinkPtr::element_type;
+
+        if (subscriber.msgTypeName != LinkType::MessageSerdesName())
+            return;
+
+        std::unique_lock<decltype(_linksMx)> lock{_linksMx};
+        auto it = linkMap.find(subscriber.networkName);
+        if (it == linkMap.end())
+            return;
+        auto link = it->second;
+        lock.unlock();
+
+        link->SetRemoteReceiverFilter(from, subscriber.receiverIdx, subscriptionFilter.filter);
+    });
+
+    Services::Logging::Debug(_logger, "Received subscription filter with {} rules for [{}] {} from {}",
+                             subscriptionFilter.filter.rules.size(), subscriber.networkName, subscriber.msgTypeName,
+                             from->GetInfo().participantName);
+}
+
+void VAsioConnection::AddSubscriptionFilter(const std::string& uniqueReceiverId, const VAsioMsgSubscriber& subscriber,
+                                            const AcceptanceFilter& acceptanceFilter)
+{
+    SubscriptionFilter changedFilter;
+    {
+        std::unique_lock<decltype(_vasioReceiversMx)> lock{_vasioReceiversMx};
+        auto it = _subscriptionFilters.find(uniqueReceiverId);
+        if (it == _subscriptionFilters.end())
+        {
+            // the first service of a new receiver determines the initial filter
+            it = _subscriptionFilters.emplace(uniqueReceiverId, SubscriptionFilter{subscriber, acceptanceFilter}).first;
+            if (acceptanceFilter.AcceptsAll())
+            {
+                return;
+            }
+        }
+        else
+        {
+            auto merged = it->second.filter;
+            merged.Merge(acceptanceFilter);
+            if (merged == it->second.filter)
+            {
+                return;
+            }
+            it->second.filter = std::move(merged);
+        }
+        changedFilter = it->second;
+    }
+
+    std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+    for (auto&& peer : _peers)
+    {
+        peer->SendSilKitMsg(SerializedMessage{changedFilter});
+    }
+}
+
+void VAsioConnection::SendSubscriptionFilters(IVAsioPeer* peer)
+{
+    std::unique_lock<decltype(_vasioReceiversMx)> lock{_vasioReceiversMx};
+    for (auto&& kv : _subscriptionFilters)
+    {
+        if (!kv.second.filter.AcceptsAll())
+        {
+            peer->SendSilKitMsg(SerializedMessage{kv.second});
+        }
+    }
+}
+
 void VAsioConnection::RemovePendingSubscription(const PendingAcksIdentifier& ackId)
 {
     auto iterPendingSync =
@@ -1491,7 +1793,8 @@ bool VAsioConnection::TryAddRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSub
 void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer)
 {
     auto receiverIdx =  buffer.GetRemoteIndex();//ExtractEndpointId(buffer);
-    if (receiverIdx >= _vasioReceivers.size())
+    auto* receiver = GetVAsioReceiver(receiverIdx);
+    if (receiver == nullptr)
     {
         Services::Logging::Warn(_logger, "Ignoring RawSilKitMessage for unknown receiverIdx={}", receiverIdx);
         return;
@@ -1499,11 +1802,38 @@ void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessag
 
     auto endpoint = buffer.GetEndpointAddress(); //ExtractEndpointAddress(buffer);
 
-    auto* fromService = dynamic_cast<IServiceEndpoint*>(from);
-    ServiceDescriptor tmpService(fromService->GetServiceDescriptor());
-    tmpService.SetServiceId(endpoint.endpoint);
+    const auto& remoteServiceEndpoint = GetRemoteServiceEndpoint(from, endpoint);
+    receiver->ReceiveRawMsg(from, remoteServiceEndpoint, std::move(buffer));
+}
+
+auto VAsioConnection::GetVAsioReceiver(EndpointId receiverIdx) -> IVAsioReceiver*
+{
+    std::unique_lock<decltype(_vasioReceiversMx)> lock{_vasioReceiversMx};
+    if (receiverIdx >= _vasioReceivers.size())
+    {
+        return nullptr;
+    }
+    return _vasioReceivers[receiverIdx].get();
+}
+
+auto VAsioConnection::GetRemoteServiceEndpoint(IVAsioPeer* from, EndpointAddress endpointAddress)
+    -> const RemoteServiceEndpoint&
+{
+    auto& remoteServiceEndpoints = _remoteServiceEndpoints[from];
+
+    auto it = remoteServiceEndpoints.find(endpointAddress);
+    if (it == remoteServiceEndpoints.end())
+    {
+        auto* fromService = dynamic_cast<IServiceEndpoint*>(from);
+        ServiceDescriptor serviceDescriptor{fromService->GetServiceDescriptor()};
+        serviceDescriptor.SetServiceId(endpointAddress.endpoint);
+
+        it = remoteServiceEndpoints
+                 .emplace(endpointAddress, std::make_unique<RemoteServiceEndpoint>(std::move(serviceDescriptor)))
+                 .first;
+    }
 
-    _vasioReceivers[receiverIdx]->ReceiveRawMsg(from, tmpService, std::move(buffer));
+    return *it->second;
 }
 
 void VAsioConnection::RegisterMessageReceiver(std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)> callback)
@@ -1549,6 +1879,54 @@ void VAsioConnection::SetAsyncSubscriptionsCompletionHandler(std::function<void(
     }
 }
 
+auto VAsioConnection::CurrentSendBatch() -> SendBatch*&
+{
+    thread_local SendBatch* currentSendBatch{nullptr};
+    return currentSendBatch;
+}
+
+void VAsioConnection::SendMsgBatch(const std::function<void()>& sendMessages)
+{
+    auto*& currentSendBatch = CurrentSendBatch();
+    if (currentSendBatch != nullptr)
+    {
+        // Nested batches are merged into the outermost one
+        sendMessages();
+        return;
+    }
+
+    SendBatch sendBatch;
+    sendBatch.connection = this;
+    currentSendBatch = &sendBatch;
+
+    // The messages sent before an exception are still delivered, like with individual calls
+    auto postSendBatch = [this, &sendBatch, &currentSendBatch]() {
+        currentSendBatch = nullptr;
+        if (sendBatch.handlers.empty())
+        {
+            return;
+        }
+        asio::post(_ioExecutor, [handlers = std::move(sendBatch.handlers)]() {
+            VAsioTcpPeer::SendBatchScope sendBatchScope;
+            for (const auto& handler : handlers)
+            {
+                handler();
+            }
+        });
+    };
+
+    try
+    {
+        sendMessages();
+    }
+    catch (...)
+    {
+        postSendBatch();
+        throw;
+    }
+    postSendBatch();
+}
+
 auto VAsioConnection::GetNumberOfRemoteReceivers(const IServiceEndpoint* service, const std::string& msgTypeName)
     -> size_t
 {
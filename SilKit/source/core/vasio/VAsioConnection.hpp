@@ -21,11 +21,14 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <deque>
+#include <map>
 #include <memory>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 #include <tuple>
+#include <utility>
 #include <typeinfo>
 #include <future>
 #include <mutex>
@@ -65,6 +68,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 namespace SilKit {
 namespace Core {
 
+class VAsioTcpPeer;
+
 class VAsioConnection : public IVAsioPeerConnection
 {
 public:
@@ -109,7 +114,7 @@ public:
             _hasPendingAsyncSubscriptions = true;
         }
 
-        asio::post(_ioContext, [this, service]() {
+        asio::post(_ioExecutor, [this, service]() {
             this->RegisterSilKitServiceImpl<SilKitServiceT>(service);
         });
 
@@ -155,9 +160,15 @@ public:
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> function)
     {
-        asio::post(_ioContext.get_executor(), std::move(function));
+        if (!AddToSendBatch(function))
+        {
+            asio::post(_ioExecutor, std::move(function));
+        }
     }
 
+    //! Runs sendMessages on the calling thread and posts all messages it sends as a single I/O-thread handler
+    void SendMsgBatch(const std::function<void()>& sendMessages);
+
     inline auto Config() const -> const SilKit::Config::ParticipantConfiguration& override
     {
         return _config;
@@ -168,6 +179,9 @@ public:
         return _participantName;
     }
 
+    //! The capabilities announced to other participants (and by the registry in the KnownParticipants message)
+    auto GetCapabilities() const -> std::string;
+
     // Temporary Helpers
     void RegisterMessageReceiver(std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)> callback);
     void OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer) override;
@@ -202,29 +216,17 @@ public:
 
 public: //members
     static constexpr const ParticipantId RegistryParticipantId { 0 };
-private:
-    template<typename AcceptorT, typename EndpointT>
-    auto AcceptConnectionsOn(AcceptorT& acceptor, EndpointT endpoint) -> EndpointT;
-
-    // ----------------------------------------
-    // private data types
-    template <class MsgT>
-    using SilKitLinkMap = std::map<std::string, std::shared_ptr<SilKitLink<MsgT>>>;
-
-    template <class MsgT>
-    using SilKitServiceToReceiverMap = std::map<std::string, IMessageReceiver<MsgT>*>;
-    template <class MsgT>
-    using SilKitServiceToLinkMap = std::map<std::string, std::shared_ptr<SilKitLink<MsgT>>>;
-
-    using ParticipantAnnouncementReceiver = std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)>;
 
+    //! \brief All message types which are transported by the VAsioConnection
     using SilKitMessageTypes = std::tuple<
         Services::Logging::LogMsg,
+        Services::Logging::LogMsgBatch,
         Services::Orchestration::NextSimTask,
         Services::Orchestration::SystemCommand,
         Services::Orchestration::ParticipantStatus,
         Services::Orchestration::WorkflowConfiguration,
         Services::PubSub::WireDataMessageEvent,
+        Services::PubSub::WireDataMessageBatchEvent,
         Services::Rpc::FunctionCall,
         Services::Rpc::FunctionCallResponse,
         Services::Can::WireCanFrameEvent,
@@ -264,17 +266,45 @@ private:
         Core::Tests::TestFrameEvent
     >;
 
+private:
+    template<typename AcceptorT, typename EndpointT>
+    auto AcceptConnectionsOn(AcceptorT& acceptor, EndpointT endpoint) -> EndpointT;
+
+    // ----------------------------------------
+    // private data types
+    template <class MsgT>
+    using SilKitLinkMap = std::map<std::string, std::shared_ptr<SilKitLink<MsgT>>>;
+
+    template <class MsgT>
+    using SilKitServiceToReceiverMap = std::map<std::string, IMessageReceiver<MsgT>*>;
+    template <class MsgT>
+    using SilKitServiceToLinkMap = std::map<std::string, std::shared_ptr<SilKitLink<MsgT>>>;
+
+    using ParticipantAnnouncementReceiver = std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)>;
+
 private:
     // ----------------------------------------
     // private methods
+    //! Handles a received message on the I/O executor of the connection
+    void ProcessSocketData(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer);
+    auto GetVAsioReceiver(EndpointId receiverIdx) -> IVAsioReceiver*;
+    //! Returns the cached endpoint of the remote service, which is created on the first message from it
+    auto GetRemoteServiceEndpoint(IVAsioPeer* from, EndpointAddress endpointAddress) -> const RemoteServiceEndpoint&;
     void ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveSubscriptionFilter(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveRegistryMessage(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveCompactProxyMessage(IVAsioPeer* from, SerializedMessage&& buffer);
 
     bool TryAddRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSubscriber& subscriber);
 
+    //! Merges the filter of a local service into the filter of its VAsioReceiver and announces changes to all peers
+    void AddSubscriptionFilter(const std::string& uniqueReceiverId, const VAsioMsgSubscriber& subscriber,
+                               const AcceptanceFilter& acceptanceFilter);
+    void SendSubscriptionFilters(IVAsioPeer* peer);
+
     void UpdateParticipantStatusOnConnectionLoss(IVAsioPeer* peer);
 
     // Registry related send / receive methods
@@ -286,6 +316,9 @@ private:
     void ReceiveParticipantAnnouncementReply(IVAsioPeer* from, SerializedMessage&& buffer);
 
     void ReceiveKnownParticpants(IVAsioPeer* peer, SerializedMessage&& buffer);
+    //! Starts connecting to queued known participants, up to the limit of concurrent connection attempts
+    void StartQueuedPeerConnects();
+    void OnPeerConnectCompleted(std::shared_ptr<VAsioTcpPeer> directPeer, bool connected, const std::string& errorMessage);
 
     void NotifyNetworkIncompatibility(const RegistryMsgHeader& other, const std::string& otherParticipantName);
 
@@ -303,10 +336,15 @@ private:
     using PendingAcksIdentifier = std::pair<IVAsioPeer*, VAsioMsgSubscriber>;
     void RemovePendingSubscription(const PendingAcksIdentifier& ackId);
 
+    void OnPeerShutdownImpl(IVAsioPeer* peer);
     void SendProxyPeerShutdownNotification(IVAsioPeer* peer);
     void RemovePeerFromLinks(IVAsioPeer* peer);
     void RemovePeerFromConnection(IVAsioPeer* peer);
 
+    //! The executor of a new peer: a strand of its own if multiple I/O workers are used
+    auto MakePeerExecutor() -> asio::any_io_executor;
+    bool HasMultipleIoWorkers() const;
+
     template<class SilKitMessageT>
     auto GetLinkByName(const std::string& networkName) -> std::shared_ptr<SilKitLink<SilKitMessageT>>
     {
@@ -321,7 +359,8 @@ private:
     }
 
     template<class SilKitMessageT, class SilKitServiceT>
-    void RegisterSilKitMsgReceiver(IMessageReceiver<SilKitMessageT>* receiver)
+    void RegisterSilKitMsgReceiver(IMessageReceiver<SilKitMessageT>* receiver,
+                                   const AcceptanceFilter& acceptanceFilter = {})
     {
         SILKIT_ASSERT(_logger);
         auto&& serviceDescriptor = GetServiceDescriptor(receiver);
@@ -333,10 +372,10 @@ private:
         std::string msgSerdesName = SilKitMsgTraits<SilKitMessageT>::SerdesName();
         const std::string uniqueReceiverId = networkName + "/" + msgSerdesName;
         bool isNewReceiver = _vasioUniqueReceiverIds.insert(uniqueReceiverId).second;
+        VAsioMsgSubscriber subscriptionInfo;
         if (isNewReceiver)
         {
             // we have to subscribe to messages from other peers
-            VAsioMsgSubscriber subscriptionInfo;
             subscriptionInfo.receiverIdx = static_cast<decltype(subscriptionInfo.receiverIdx)>(_vasioReceivers.size());
             subscriptionInfo.networkName = networkName;
             subscriptionInfo.msgTypeName = msgSerdesName;
@@ -348,7 +387,10 @@ private:
             tmpServiceDescriptor.SetParticipantNameAndComputeId(_participantName);
             // copy the Service Endpoint Id
             serviceEndpointPtr->SetServiceDescriptor(tmpServiceDescriptor);
-            _vasioReceivers.emplace_back(std::move(rawReceiver));
+            {
+                std::unique_lock<decltype(_vasioReceiversMx)> lock{_vasioReceiversMx};
+                _vasioReceivers.emplace_back(std::move(rawReceiver));
+            }
 
             {
                 std::unique_lock<decltype(_peersLock)> lock{_peersLock};
@@ -370,6 +412,11 @@ private:
                 }
             }
         }
+
+        if (AcceptanceKey<SilKitMessageT>::IsFilterable())
+        {
+            AddSubscriptionFilter(uniqueReceiverId, subscriptionInfo, acceptanceFilter);
+        }
     }
 
     template<class SilKitMessageT>
@@ -389,7 +436,8 @@ private:
         Util::tuple_tools::for_each(receiveMessageTypes, [this, service](auto&& message)
         {
             using SilKitMessageT = std::decay_t<decltype(message)>;
-            this->RegisterSilKitMsgReceiver<SilKitMessageT, SilKitServiceT>(service);
+            this->RegisterSilKitMsgReceiver<SilKitMessageT, SilKitServiceT>(service,
+                                                                             GetServiceAcceptanceFilter(*service));
         }
         );
 
@@ -451,11 +499,44 @@ private:
     template <typename... MethodArgs, typename... Args>
     inline void ExecuteOnIoThread(void (VAsioConnection::*method)(MethodArgs...), Args&&... args)
     {
-        asio::post(_ioContext.get_executor(), [=]() mutable { (this->*method)(std::move(args)...); });
+        // NB: Arguments passed as rvalues, e.g., messages, are moved into the handler instead of being copied
+        auto handler = [this, method, arguments = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+            InvokeWithArguments(method, arguments, std::index_sequence_for<Args...>{});
+        };
+        if (!AddToSendBatch(handler))
+        {
+            asio::post(_ioExecutor, std::move(handler));
+        }
+    }
+    template <typename... MethodArgs, typename TupleT, std::size_t... Indices>
+    inline void InvokeWithArguments(void (VAsioConnection::*method)(MethodArgs...), TupleT& arguments,
+                                    std::index_sequence<Indices...>)
+    {
+        (this->*method)(std::move(std::get<Indices>(arguments))...);
     }
     inline void ExecuteOnIoThread(std::function<void()> function)
     {
-        asio::post(_ioContext.get_executor(), std::move(function));
+        asio::post(_ioExecutor, std::move(function));
+    }
+
+    // The handlers collected while the calling thread is inside SendMsgBatch of this connection
+    struct SendBatch
+    {
+        VAsioConnection* connection{nullptr};
+        std::vector<std::function<void()>> handlers;
+    };
+    static auto CurrentSendBatch() -> SendBatch*&;
+
+    template <typename HandlerT>
+    inline bool AddToSendBatch(HandlerT& handler)
+    {
+        auto* sendBatch = CurrentSendBatch();
+        if (sendBatch == nullptr || sendBatch->connection != this)
+        {
+            return false;
+        }
+        sendBatch->handlers.emplace_back(std::move(handler));
+        return true;
     }
 
     template <class SilKitServiceT>
@@ -470,6 +551,8 @@ private:
     SilKit::Config::ParticipantConfiguration _config;
     std::string _participantName;
     ParticipantId _participantId{0};
+    // Identifies this participant in compact proxy messages
+    ParticipantId _participantNameHash{0};
     Services::Logging::ILogger* _logger{nullptr};
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
 
@@ -480,8 +563,16 @@ private:
     //! \brief Lookup for links by name.
     Util::tuple_tools::wrapped_tuple<SilKitServiceToLinkMap, SilKitMessageTypes> _serviceToLinkMap;
 
+    // Lookups from the executors of the peers are guarded, modifications happen on the I/O executor only
+    std::mutex _vasioReceiversMx;
     std::vector<std::unique_ptr<IVAsioReceiver>> _vasioReceivers;
+    // Endpoints of remote services per peer, which are passed as the sender of received messages. Caching them
+    // avoids copying the service descriptor of the peer for every received message.
+    std::unordered_map<IVAsioPeer*, std::map<EndpointAddress, std::unique_ptr<RemoteServiceEndpoint>>>
+        _remoteServiceEndpoints;
     std::unordered_set<std::string> _vasioUniqueReceiverIds;
+    // Filters of the VAsioReceivers of filterable messages by their unique receiver id, guarded by _vasioReceiversMx
+    std::unordered_map<std::string, SubscriptionFilter> _subscriptionFilters;
 
     std::mutex _participantAnnouncementReceiversMutex;
     std::vector<ParticipantAnnouncementReceiver> _participantAnnouncementReceivers;
@@ -489,6 +580,8 @@ private:
 
     // NB: The IO context must be listed before anything socket related.
     asio::io_context _ioContext;
+    // All connection state is accessed on this executor. It is a strand if multiple I/O workers are used.
+    asio::any_io_executor _ioExecutor;
 
     // NB: peers and acceptors must be listed AFTER the io_context. Otherwise,
     // their destructor will crash!
@@ -507,6 +600,12 @@ private:
     std::promise<void> _receivedAllParticipantReplies;
 
     std::atomic<bool> _hasReceivedKnownParticipants{false};
+    // The registry announced that it forwards compact proxy messages
+    bool _registrySupportsCompactProxyMessage{false};
+
+    // Known participants are connected asynchronously, with a bounded number of concurrent attempts
+    std::deque<std::shared_ptr<VAsioTcpPeer>> _queuedPeerConnects;
+    std::size_t _activePeerConnects{0};
 
     // Keep track of the sent Subscriptions when Registering an SIL Kit Service
     std::vector<PendingAcksIdentifier> _pendingSubscriptionAcknowledges;
@@ -517,9 +616,9 @@ private:
     std::function<void()> _asyncSubscriptionsCompletionHandler;
     std::atomic<bool> _hasPendingAsyncSubscriptions{false};
 
-    // The worker thread should be the last members in this class. This ensures
-    // that no callback is destroyed before the thread finishes.
-    std::thread _ioWorker;
+    // The worker threads should be the last members in this class. This ensures
+    // that no callback is destroyed before the threads finish.
+    std::vector<std::thread> _ioWorkers;
 
     //We violate the strict layering architecture, so that we can cleanly shutdown without false error messages.
     std::atomic_bool _isShuttingDown{false};
@@ -531,9 +630,12 @@ private:
 
     // Hold mapping from participantName to peer
     std::unordered_map<std::string, IVAsioPeer *> _participantNameToPeer;
+    // Hold mapping from the hash of the participantName to peer (used for compact proxy messages)
+    std::unordered_map<ParticipantId, IVAsioPeer *> _participantIdToPeer;
 
-    // Hold mapping from proxy source to all proxy destinations (used by registry for shutdown information)
-    std::unordered_map<std::string, std::unordered_set<std::string>> _proxySourceToDestinations;
+    // Hold mapping from proxy source to all proxy destinations, identified by the hash of their names (used by
+    // registry for shutdown information)
+    std::unordered_map<ParticipantId, std::unordered_set<ParticipantId>> _proxySourceToDestinations;
 
     // Hold mapping from proxied peer to all proxy peers being served via the key.
     std::unordered_map<IVAsioPeer *, std::unordered_set<IVAsioPeer *>> _peerToProxyPeers;
@@ -543,19 +645,23 @@ private:
     friend class VAsioConnectionTest;
 };
 
+//! Remove the brackets around IPv6 addresses, which the resolver does not accept
+inline auto StripHostForResolver(const std::string& host) -> std::string
+{
+    std::string value{host};
+    size_t it;
+    while((it = value.find_first_of("[]")) != value.npos)
+    {
+        value.erase(it, 1);
+    }
+
+    return value;
+}
+
 inline auto ResolveHostAndPort(const asio::any_io_executor& executor, Services::Logging::ILogger* logger, const std::string& host, const uint16_t port)
     -> asio::ip::tcp::resolver::results_type
 {
-    auto strippedHost = [host]() {
-        std::string value{host};
-        size_t it;
-        while((it = value.find_first_of("[]")) != value.npos)
-        {
-            value.erase(it, 1);
-        }
-
-        return value;
-    }();
+    auto strippedHost = StripHostForResolver(host);
     asio::ip::tcp::resolver resolver(executor);
     asio::ip::tcp::resolver::results_type results;
 
@@ -28,6 +28,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "VAsioPeerInfo.hpp"
 #include "ProtocolVersion.hpp" // for current ProtocolVersion in RegistryMsgHeader
+#include "AcceptanceFilter.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -59,6 +60,13 @@ struct VAsioMsgSubscriber
     uint32_t version{0};
 };
 
+//! Restricts the messages sent to a subscriber to those accepted by the filter. Older participants ignore it.
+struct SubscriptionFilter
+{
+    VAsioMsgSubscriber subscriber;
+    AcceptanceFilter filter;
+};
+
 struct SubscriptionAcknowledge
 {
     enum class Status : uint8_t {
@@ -93,6 +101,9 @@ struct KnownParticipants
 {
     RegistryMsgHeader messageHeader;
     std::vector<SilKit::Core::VAsioPeerInfo> peerInfos;
+
+    /// Capabilities of the registry, e.g., whether it forwards compact proxy messages. Added in 4.0.30.
+    std::string registryCapabilities;
 };
 
 enum class RegistryMessageKind : uint8_t
@@ -123,6 +134,32 @@ struct ProxyMessage
     std::vector<uint8_t> payload;
 };
 
+//! Fixed-size network header of a compact proxy message, which is followed by the complete proxied message.
+//! The participants are identified by the hash of their names, which allows the registry to forward the message
+//! without deserializing (and copying) the proxied message.
+struct CompactProxyMessageHeader
+{
+    uint8_t version{0};
+    uint64_t source{0};
+    uint64_t destination{0};
+};
+
+//! Control messages of the shared-memory transport between two peers connected via a local-domain socket.
+struct SharedMemoryTransportMessage
+{
+    enum class Kind : uint8_t
+    {
+        Invalid = 0,
+        Request = 1, //!< The connecting peer created the segment named in segmentName
+        Accept = 2, //!< Last message before the accepting peer sends via shared memory
+        Reject = 3, //!< The accepting peer cannot use the segment, the socket is used as before
+        Start = 4, //!< Last message before the connecting peer sends via shared memory
+        Notify = 5, //!< The ring buffer contains new data or free space
+    };
+    Kind kind{Kind::Invalid};
+    std::string segmentName;
+};
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
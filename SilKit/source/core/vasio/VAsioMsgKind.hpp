@@ -34,6 +34,9 @@ enum class VAsioMsgKind: uint8_t
     SilKitSimMsg = 4,
     SilKitRegistryMessage = 5,
     SilKitProxyMessage = 6, // 3.1 with "proxy-message" capability
+    SharedMemoryTransport = 7, // 4.0.30 with "shared-memory" capability, handled by the peer itself
+    SilKitCompactProxyMessage = 8, // 4.0.30 with "compact-proxy-message" capability
+    SubscriptionFilter = 9, // 4.0.30, ignored by older participants
 };
 
 } // namespace Core
@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "VAsioProxyPeer.hpp"
 
 #include "Logger.hpp"
+#include "Hash.hpp"
 
 
 namespace {
@@ -50,6 +51,13 @@ VAsioProxyPeer::VAsioProxyPeer(IVAsioPeerConnection *connection, VAsioPeerInfo p
 
 void VAsioProxyPeer::SendSilKitMsg(SerializedMessage buffer)
 {
+    if (_useCompactFraming)
+    {
+        Trace(_logger, "VAsioProxyPeer ({}): SendSilKitMsg (compact)", _peerInfo.participantName);
+        _peer->SendSilKitMsg(SerializedMessage{_compactHeader, std::move(buffer)});
+        return;
+    }
+
     ProxyMessage msg{};
     msg.source = GetParticipantName();
     msg.destination = GetInfo().participantName;
@@ -152,5 +160,13 @@ auto VAsioProxyPeer::GetPeer() const -> IVAsioPeer *
     return _peer;
 }
 
+void VAsioProxyPeer::EnableCompactFraming(ParticipantId destinationId)
+{
+    Debug(_logger, "VAsioProxyPeer ({}): Using compact proxy messages", _peerInfo.participantName);
+    _compactHeader.source = SilKit::Util::Hash::Hash(GetParticipantName());
+    _compactHeader.destination = destinationId;
+    _useCompactFraming = true;
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -71,6 +71,10 @@ public: // IVAsioPeerConnection
 public:
     auto GetPeer() const -> IVAsioPeer*;
 
+    //! Send compact proxy messages, which the registry forwards without deserializing them. Requires the
+    //! "compact-proxy-message" capability of the proxy and the destination, identified by its name hash.
+    void EnableCompactFraming(ParticipantId destinationId);
+
 private:
     IVAsioPeerConnection* _connection;
     IVAsioPeer* _peer;
@@ -78,6 +82,8 @@ private:
     ServiceDescriptor _serviceDescriptor;
     SilKit::Services::Logging::ILogger* _logger;
     ProtocolVersion _protocolVersion;
+    bool _useCompactFraming{false};
+    CompactProxyMessageHeader _compactHeader;
 };
 
 } // namespace Core
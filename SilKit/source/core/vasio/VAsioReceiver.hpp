@@ -21,6 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include "SilKitLink.hpp"
 
 #include "VAsioDatatypes.hpp"
@@ -32,6 +35,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 namespace SilKit {
 namespace Core {
 
+//! Immutable endpoint of a remote service, which is handed to the links as the sender of received messages
 struct RemoteServiceEndpoint : IServiceEndpoint
 {
     void SetServiceDescriptor(const SilKit::Core::ServiceDescriptor&) override 
@@ -44,9 +48,9 @@ struct RemoteServiceEndpoint : IServiceEndpoint
         return _serviceDescriptor; 
     }
 
-    RemoteServiceEndpoint(const ServiceDescriptor& descriptor)
+    RemoteServiceEndpoint(ServiceDescriptor descriptor)
+        : _serviceDescriptor{std::move(descriptor)}
     {
-        _serviceDescriptor = descriptor;
     }
 
 private:
@@ -62,7 +66,9 @@ public:
     // Public interface methods
     virtual ~IVAsioReceiver() = default;
     virtual auto GetDescriptor() const -> const VAsioMsgSubscriber& = 0;
-    virtual void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) = 0;
+    virtual void ReceiveRawMsg(IVAsioPeer* from, const RemoteServiceEndpoint& endpoint, SerializedMessage&& buffer) = 0;
+    //! Deserializes the message. The returned function distributes it to the link, on the I/O executor of the connection.
+    virtual auto DeserializeRawMsg(SerializedMessage&& buffer) -> std::function<void(const RemoteServiceEndpoint&)> = 0;
 };
 
 template <class MsgT>
@@ -79,7 +85,8 @@ public:
     // ----------------------------------------
     // Public interface methods
     auto GetDescriptor() const -> const VAsioMsgSubscriber& override;
-    void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) override;
+    void ReceiveRawMsg(IVAsioPeer* from, const RemoteServiceEndpoint& endpoint, SerializedMessage&& buffer) override;
+    auto DeserializeRawMsg(SerializedMessage&& buffer) -> std::function<void(const RemoteServiceEndpoint&)> override;
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
     {
         _serviceDescriptor = serviceDescriptor;
@@ -117,15 +124,26 @@ auto VAsioReceiver<MsgT>::GetDescriptor() const -> const VAsioMsgSubscriber&
 }
 
 template <class MsgT>
-void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const ServiceDescriptor& descriptor, SerializedMessage&& buffer)
+void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const RemoteServiceEndpoint& endpoint, SerializedMessage&& buffer)
 {
     MsgT msg = buffer.Deserialize<MsgT>();
 
-    Services::TraceRx(_logger, this, msg, descriptor);
+    Services::TraceRx(_logger, this, msg, endpoint.GetServiceDescriptor());
+
+    _link->DistributeRemoteSilKitMessage(&endpoint, std::move(msg));
+}
+
+template <class MsgT>
+auto VAsioReceiver<MsgT>::DeserializeRawMsg(SerializedMessage&& buffer)
+    -> std::function<void(const RemoteServiceEndpoint&)>
+{
+    auto msg = std::make_shared<MsgT>(buffer.Deserialize<MsgT>());
 
-    auto remoteId = RemoteServiceEndpoint(descriptor);
-    _link->DistributeRemoteSilKitMessage(&remoteId, std::move(msg));
+    return [this, msg = std::move(msg)](const RemoteServiceEndpoint& endpoint) {
+        Services::TraceRx(_logger, this, *msg, endpoint.GetServiceDescriptor());
 
+        _link->DistributeRemoteSilKitMessage(&endpoint, std::move(*msg));
+    };
 }
 
 } // namespace Core
@@ -187,6 +187,9 @@ void VAsioRegistry::SendKnownParticipants(IVAsioPeer* peer)
         knownParticipantsMsg.peerInfos.push_back(peerInfo);
     }
 
+    // Participants may use compact proxy messages, if we are able to forward them
+    knownParticipantsMsg.registryCapabilities = _connection.GetCapabilities();
+
     peer->SendSilKitMsg(SerializedMessage{peer->GetProtocolVersion(), knownParticipantsMsg});
 }
 
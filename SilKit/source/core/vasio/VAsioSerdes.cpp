@@ -89,6 +89,38 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, VAsioMsgSubscriber& subs
     return buffer;
 }
 
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const AcceptanceRule& rule)
+{
+    buffer << rule.id
+           << rule.mask
+        ;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, AcceptanceRule& rule)
+{
+    buffer >> rule.id
+           >> rule.mask
+        ;
+    return buffer;
+}
+
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SubscriptionFilter& msg)
+{
+    buffer << msg.subscriber
+           << msg.filter.rules
+        ;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionFilter& msg)
+{
+    buffer >> msg.subscriber
+           >> msg.filter.rules
+        ;
+    return buffer;
+}
+
 inline MessageBuffer& operator<<(MessageBuffer& buffer, const SubscriptionAcknowledge& ack)
 {
     buffer << ack.status
@@ -194,6 +226,8 @@ inline MessageBuffer& operator<<(MessageBuffer& buffer, const KnownParticipants&
     {
         buffer << participants.messageHeader
             << participants.peerInfos
+            // Added in 4.0.30.
+            << participants.registryCapabilities
             ;
     }
     return buffer;
@@ -210,6 +244,13 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, KnownParticipants& parti
         buffer >> participants.messageHeader
             >> participants.peerInfos
             ;
+
+        // Added in 4.0.30. Messages with a 3.0 header are followed by the legacy peer URIs instead.
+        if (buffer.RemainingBytesLeft() > 0
+            && ExtractProtocolVersion(participants.messageHeader) >= ProtocolVersion{3, 1})
+        {
+            buffer >> participants.registryCapabilities;
+        }
     }
     return buffer;
 }
@@ -282,6 +323,42 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, ProxyMessage& out)
     return buffer;
 }
 
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const CompactProxyMessageHeader& msg)
+{
+    buffer
+        << msg.version
+        << msg.source
+        << msg.destination
+        ;
+    return buffer;
+}
+inline MessageBuffer& operator>>(MessageBuffer& buffer, CompactProxyMessageHeader& out)
+{
+    buffer
+        >> out.version
+        >> out.source
+        >> out.destination
+        ;
+    return buffer;
+}
+
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SharedMemoryTransportMessage& msg)
+{
+    buffer
+        << msg.kind
+        << msg.segmentName
+        ;
+    return buffer;
+}
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SharedMemoryTransportMessage& out)
+{
+    buffer
+        >> out.kind
+        >> out.segmentName
+        ;
+    return buffer;
+}
+
 //////////////////////////////////////////////////////////////////////
 // Public Functions
 //////////////////////////////////////////////////////////////////////
@@ -317,6 +394,18 @@ auto PeekProxyMessageHeader(MessageBuffer& buffer) -> ProxyMessageHeader
     return header;
 }
 
+auto ExtractCompactProxyMessageHeader(MessageBuffer& buffer) -> CompactProxyMessageHeader
+{
+    CompactProxyMessageHeader header{};
+    buffer >> header;
+    return header;
+}
+
+void SerializeCompactProxyMessageHeader(MessageBuffer& buffer, const CompactProxyMessageHeader& header)
+{
+    buffer << header;
+}
+
 auto PeekRegistryMessageHeader(MessageBuffer& buffer) -> RegistryMsgHeader
 {
     // NB: At the moment using the MessageBufferPeeker here -although correct- leads to an issue in the
@@ -407,5 +496,23 @@ void Deserialize(MessageBuffer& buffer, ProxyMessage& out)
     buffer >> out;
 }
 
+void Serialize(MessageBuffer& buffer, const SubscriptionFilter& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SubscriptionFilter& out)
+{
+    buffer >> out;
+}
+
+void Serialize(MessageBuffer& buffer, const SharedMemoryTransportMessage& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SharedMemoryTransportMessage& out)
+{
+    buffer >> out;
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -42,6 +42,9 @@ auto ExtractRegistryMessageKind(MessageBuffer& buffer) -> RegistryMessageKind;
 
 auto PeekRegistryMessageHeader(MessageBuffer& buffer) -> RegistryMsgHeader;
 auto PeekProxyMessageHeader(MessageBuffer& buffer) -> ProxyMessageHeader;
+// The compact proxy message header is followed by the bytes of the proxied message, which are not deserialized
+auto ExtractCompactProxyMessageHeader(MessageBuffer& buffer) -> CompactProxyMessageHeader;
+void SerializeCompactProxyMessageHeader(MessageBuffer& buffer, const CompactProxyMessageHeader& header);
 
 auto ExtractEndpointId(MessageBuffer& buffer) ->EndpointId;
 auto ExtractEndpointAddress(MessageBuffer& buffer) ->EndpointAddress;
@@ -52,15 +55,19 @@ void Serialize(MessageBuffer& buffer, const ParticipantAnnouncement& announcemen
 void Serialize(MessageBuffer& buffer, const ParticipantAnnouncementReply& reply);
 void Serialize(MessageBuffer& buffer, const VAsioMsgSubscriber& subscriber);
 void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledge& msg);
+void Serialize(MessageBuffer& buffer, const SubscriptionFilter& msg);
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg);
 void Serialize(MessageBuffer& buffer, const ProxyMessage& msg);
+void Serialize(MessageBuffer& buffer, const SharedMemoryTransportMessage& msg);
 
 void Deserialize(MessageBuffer& buffer, ParticipantAnnouncement& out);
 void Deserialize(MessageBuffer& buffer,ParticipantAnnouncementReply& out);
 void Deserialize(MessageBuffer&, VAsioMsgSubscriber&);
 void Deserialize(MessageBuffer&, SubscriptionAcknowledge&);
+void Deserialize(MessageBuffer&, SubscriptionFilter&);
 void Deserialize(MessageBuffer& buffer,KnownParticipants& out);
 void Deserialize(MessageBuffer& buffer, ProxyMessage& out);
+void Deserialize(MessageBuffer& buffer, SharedMemoryTransportMessage& out);
 
 } // namespace Core
 } // namespace SilKit
@@ -21,11 +21,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "VAsioTcpPeer.hpp"
 
 #include <iomanip>
+#include <limits>
 #include <sstream>
 #include <thread>
 
 #include "ILogger.hpp"
 #include "VAsioMsgKind.hpp"
+#include "VAsioCapabilities.hpp"
 #include "VAsioConnection.hpp"
 #include "Uri.hpp"
 #include "Assert.hpp"
@@ -112,12 +114,27 @@ static void EnableQuickAck(SilKit::Services::Logging::ILogger* ,
 namespace SilKit {
 namespace Core {
 
+namespace {
+constexpr size_t ReceiveBufferDefaultSize = 4096;
+} // namespace
+
 // Private constructor
 VAsioTcpPeer::VAsioTcpPeer(asio::any_io_executor executor, VAsioConnection* connection, Services::Logging::ILogger* logger)
     : _socket{executor}
     , _connection{connection}
     , _logger{logger}
 {
+    const auto& middleware = _connection->Config().middleware;
+    if (middleware.enableSendCoalescing)
+    {
+        // non-positive values disable the respective limit
+        _sendCoalescingMaxMessages = middleware.sendCoalescingMaxMessages > 0
+                                         ? static_cast<std::size_t>(middleware.sendCoalescingMaxMessages)
+                                         : std::numeric_limits<std::size_t>::max();
+        _sendCoalescingMaxBytes = middleware.sendCoalescingMaxBytes > 0
+                                      ? static_cast<std::size_t>(middleware.sendCoalescingMaxBytes)
+                                      : std::numeric_limits<std::size_t>::max();
+    }
 }
 
 VAsioTcpPeer::~VAsioTcpPeer()
@@ -149,7 +166,7 @@ void VAsioTcpPeer::DrainAllBuffers()
     // Wait for incoming Msg 
     for (waitMs = 100; waitMs >= 0; waitMs--)
     {
-        if (_currentMsgSize == 0)
+        if (_socketReceiveBuffer.currentMsgSize == 0 && _sharedMemoryReceiveBuffer.currentMsgSize == 0)
             break;
         std::this_thread::sleep_for(1ms);
     }
@@ -282,7 +299,6 @@ bool VAsioTcpPeer::ConnectTcp(const std::string& host, uint16_t port)
         SilKit::Services::Logging::Warn(_logger, "Unable to resolve hostname \"{}:{}\"", host, port);
         return false;
     }
-    auto config = _connection->Config();
     for (auto&& resolverEntry : resolverResults)
     {
         try
@@ -298,27 +314,7 @@ bool VAsioTcpPeer::ConnectTcp(const std::string& host, uint16_t port)
 
             _socket.connect(resolverEntry.endpoint());
 
-            if (config.middleware.tcpNoDelay)
-            {
-                _socket.set_option(asio::ip::tcp::no_delay{true});
-            }
-
-            if (config.middleware.tcpQuickAck)
-            {
-                _enableQuickAck = true;
-                EnableQuickAck(_logger, _socket);
-            }
-
-            if(config.middleware.tcpReceiveBufferSize > 0)
-            {
-                _socket.set_option(asio::socket_base::receive_buffer_size{config.middleware.tcpReceiveBufferSize});
-            }
-
-            if (config.middleware.tcpSendBufferSize > 0)
-            {
-                _socket.set_option(asio::socket_base::send_buffer_size{config.middleware.tcpSendBufferSize});
-            }
-
+            SetTcpOptions();
 
             return true;
         }
@@ -332,6 +328,33 @@ bool VAsioTcpPeer::ConnectTcp(const std::string& host, uint16_t port)
     }
     return false;
 }
+
+void VAsioTcpPeer::SetTcpOptions()
+{
+    const auto& middleware = _connection->Config().middleware;
+
+    if (middleware.tcpNoDelay)
+    {
+        _socket.set_option(asio::ip::tcp::no_delay{true});
+    }
+
+    if (middleware.tcpQuickAck)
+    {
+        _enableQuickAck = true;
+        EnableQuickAck(_logger, _socket);
+    }
+
+    if (middleware.tcpReceiveBufferSize > 0)
+    {
+        _socket.set_option(asio::socket_base::receive_buffer_size{middleware.tcpReceiveBufferSize});
+    }
+
+    if (middleware.tcpSendBufferSize > 0)
+    {
+        _socket.set_option(asio::socket_base::send_buffer_size{middleware.tcpSendBufferSize});
+    }
+}
+
 void VAsioTcpPeer::Connect(VAsioPeerInfo peerInfo)
 {
     _info = std::move(peerInfo);
@@ -404,6 +427,243 @@ void VAsioTcpPeer::Connect(VAsioPeerInfo peerInfo)
     }
 }
 
+// ----------------------------------------
+// Asynchronous connection setup
+//
+// All candidate endpoints are collected in the order of preference: local-domain sockets first, followed by the
+// resolved TCP endpoints in the order of the acceptor URIs. An attempt is started for the first endpoint, and the next
+// one is started as soon as the previous attempt failed, or after the attempt delay has passed. The first established
+// connection wins and all other attempts are cancelled.
+
+namespace {
+// Delay before racing the next endpoint, see RFC 8305 (Happy Eyeballs Version 2)
+constexpr auto ConnectAttemptDelay = std::chrono::milliseconds{250};
+} // namespace
+
+struct VAsioTcpPeer::ConnectState
+{
+    ConnectState(const asio::any_io_executor& executor, ConnectHandler connectHandler)
+        : handler{std::move(connectHandler)}
+        , attemptDelayTimer{executor}
+    {
+    }
+
+    ConnectHandler handler;
+    asio::steady_timer attemptDelayTimer;
+    // incremented whenever the timer is re-armed, to ignore expirations which were already queued
+    std::size_t attemptDelayGeneration{0};
+    bool isAttemptDelayPending{false};
+
+    struct Endpoint
+    {
+        asio::generic::stream_protocol::endpoint endpoint;
+        std::string description;
+    };
+    std::vector<Endpoint> endpoints;
+    std::size_t nextEndpoint{0};
+    std::vector<std::shared_ptr<asio::generic::stream_protocol::socket>> sockets;
+    std::size_t activeAttempts{0};
+    std::size_t pendingResolves{0};
+    std::string attemptedUris;
+    bool isDone{false};
+};
+
+void VAsioTcpPeer::ConnectAsync(VAsioPeerInfo peerInfo, ConnectHandler handler)
+{
+    _info = std::move(peerInfo);
+
+    auto state = std::make_shared<ConnectState>(_socket.get_executor(), std::move(handler));
+
+    std::vector<Uri> tcpUris;
+    for (const auto& uriString : _info.acceptorUris)
+    {
+        try
+        {
+            auto uri = Uri::Parse(uriString);
+            if (uri.Type() == Uri::UriType::Local && _connection->Config().middleware.enableDomainSockets)
+            {
+                state->endpoints.push_back({asio::local::stream_protocol::endpoint{uri.Path()}, uri.EncodedString()});
+                state->attemptedUris += uri.EncodedString() + ",";
+            }
+            else if (uri.Type() == Uri::UriType::Tcp)
+            {
+                state->attemptedUris += uri.EncodedString() + ",";
+                tcpUris.emplace_back(std::move(uri));
+            }
+        }
+        catch (const std::exception& error)
+        {
+            SilKit::Services::Logging::Debug(_logger, "ConnectAsync: Ignoring invalid URI '{}': {}", uriString,
+                                             error.what());
+        }
+    }
+
+    // the handler must never be invoked from within this function
+    asio::post(_socket.get_executor(), [self = this->shared_from_this(), state, tcpUris = std::move(tcpUris)] {
+        state->pendingResolves = tcpUris.size();
+        for (const auto& uri : tcpUris)
+        {
+            self->ResolveConnectEndpoints(state, uri.Host(), uri.Port());
+        }
+        self->StartNextConnectAttempt(state);
+    });
+}
+
+void VAsioTcpPeer::ResolveConnectEndpoints(const std::shared_ptr<ConnectState>& state, const std::string& host,
+                                           uint16_t port)
+{
+    auto resolver = std::make_shared<asio::ip::tcp::resolver>(_socket.get_executor());
+    resolver->async_resolve(
+        StripHostForResolver(host), std::to_string(port),
+        [self = this->shared_from_this(), state, resolver, host, port](
+            const asio::error_code& error, asio::ip::tcp::resolver::results_type results) {
+            state->pendingResolves -= 1;
+            if (error)
+            {
+                SilKit::Services::Logging::Warn(self->_logger, "Unable to resolve hostname \"{}:{}\": {}", host, port,
+                                                error.message());
+            }
+            else
+            {
+                for (auto&& resolverEntry : results)
+                {
+                    const auto& endpoint = resolverEntry.endpoint();
+                    state->endpoints.push_back(
+                        {endpoint, fmt::format("[{}]:{} ({})", endpoint.address().to_string(), endpoint.port(),
+                                               endpoint.protocol() == asio::ip::tcp::v4() ? "TCPv4" : "TCPv6")});
+                }
+            }
+
+            // start an attempt immediately, unless one was started recently
+            if (!state->isAttemptDelayPending)
+            {
+                self->StartNextConnectAttempt(state);
+            }
+        });
+}
+
+void VAsioTcpPeer::StartNextConnectAttempt(const std::shared_ptr<ConnectState>& state)
+{
+    if (state->isDone)
+    {
+        return;
+    }
+
+    if (state->nextEndpoint == state->endpoints.size())
+    {
+        if (state->activeAttempts == 0 && state->pendingResolves == 0)
+        {
+            FinishConnect(state, nullptr);
+        }
+        return;
+    }
+
+    const auto candidate = state->endpoints[state->nextEndpoint++];
+    const auto& endpoint = candidate.endpoint;
+    const auto& description = candidate.description;
+    const bool isLocal = endpoint.protocol().family() == asio::local::stream_protocol{}.family();
+
+    auto socket = std::make_shared<asio::generic::stream_protocol::socket>(_socket.get_executor());
+    asio::error_code error;
+    socket->open(endpoint.protocol(), error);
+    if (error)
+    {
+        SilKit::Services::Logging::Debug(_logger, "ConnectAsync: Cannot open socket: {}", error.message());
+        StartNextConnectAttempt(state);
+        return;
+    }
+    if (!isLocal)
+    {
+        // Set pre-connection platform options
+        SetConnectOptions(_logger, *socket);
+    }
+
+    SilKit::Services::Logging::Debug(_logger, "ConnectAsync: Connecting to {}", description);
+
+    state->activeAttempts += 1;
+    state->sockets.push_back(socket);
+    socket->async_connect(endpoint, [self = this->shared_from_this(), state, socket, description](
+                                        const asio::error_code& error) {
+        state->activeAttempts -= 1;
+        if (state->isDone)
+        {
+            return;
+        }
+
+        if (error)
+        {
+            SilKit::Services::Logging::Debug(self->_logger, "ConnectAsync: Error while connecting to {}: {}",
+                                             description, error.message());
+            asio::error_code ignored;
+            socket->close(ignored);
+
+            // do not wait for the attempt delay, if the attempt failed early
+            state->isAttemptDelayPending = false;
+            state->attemptDelayTimer.cancel();
+            self->StartNextConnectAttempt(state);
+            return;
+        }
+
+        self->FinishConnect(state, socket);
+    });
+
+    // race the next endpoint, if this attempt does not finish in time
+    const auto generation = ++state->attemptDelayGeneration;
+    state->isAttemptDelayPending = true;
+    state->attemptDelayTimer.expires_after(ConnectAttemptDelay);
+    state->attemptDelayTimer.async_wait(
+        [self = this->shared_from_this(), state, generation](const asio::error_code& error) {
+            if (error || generation != state->attemptDelayGeneration)
+            {
+                return;
+            }
+            state->isAttemptDelayPending = false;
+            self->StartNextConnectAttempt(state);
+        });
+}
+
+void VAsioTcpPeer::FinishConnect(const std::shared_ptr<ConnectState>& state,
+                                 std::shared_ptr<asio::generic::stream_protocol::socket> socket)
+{
+    state->isDone = true;
+    state->attemptDelayTimer.cancel();
+
+    // abort all other attempts
+    for (auto& attempt : state->sockets)
+    {
+        if (attempt != socket)
+        {
+            asio::error_code ignored;
+            attempt->close(ignored);
+        }
+    }
+    state->sockets.clear();
+
+    auto handler = std::move(state->handler);
+    if (!socket)
+    {
+        SilKit::Services::Logging::Debug(_logger, "Tried the following URIs: {}", state->attemptedUris);
+        handler(false, fmt::format("Failed to connect to host URIs: \"{}\"", state->attemptedUris));
+        return;
+    }
+
+    _socket = std::move(*socket);
+    try
+    {
+        if (!IsLocalDomainSocket())
+        {
+            SetTcpOptions();
+        }
+    }
+    catch (const std::exception& error)
+    {
+        _socket = decltype(_socket){_socket.get_executor()};
+        handler(false, fmt::format("Failed to set the socket options: {}", error.what()));
+        return;
+    }
+    handler(true, {});
+}
+
 void VAsioTcpPeer::SendSilKitMsg(SerializedMessage buffer)
 {
     // Prevent sending when shutting down
@@ -411,7 +671,22 @@ void VAsioTcpPeer::SendSilKitMsg(SerializedMessage buffer)
     {
         std::unique_lock<std::mutex> lock{_sendingQueueLock};
 
-        _sendingQueue.push_back(buffer.ReleaseStorage());
+        _sendingQueue.push_back(buffer.ReleaseStorageParts());
+
+        if (SendBatchScope::IsActive())
+        {
+            // Defer the write until the whole batch is queued, the scope starts it when it is left
+            ++_batchedMessagesInQueue;
+            if (_isBatchWritePending)
+            {
+                return;
+            }
+            _isBatchWritePending = true;
+            lock.unlock();
+
+            SendBatchScope::AddPeer(shared_from_this());
+            return;
+        }
 
         lock.unlock();
 
@@ -421,30 +696,131 @@ void VAsioTcpPeer::SendSilKitMsg(SerializedMessage buffer)
     }
 }
 
+namespace {
+thread_local unsigned int sendBatchScopeDepth{0};
+// the peers with messages queued inside the outermost scope on this thread, whose writes have not been started
+thread_local std::vector<std::shared_ptr<VAsioTcpPeer>> sendBatchScopePeers;
+} // namespace
+
+VAsioTcpPeer::SendBatchScope::SendBatchScope()
+{
+    ++sendBatchScopeDepth;
+}
+
+VAsioTcpPeer::SendBatchScope::~SendBatchScope()
+{
+    if (--sendBatchScopeDepth > 0)
+    {
+        return;
+    }
+
+    // Starting the writes only now ensures that each of them sees the whole batch, even if the write of a peer runs
+    // on another I/O worker thread
+    auto peers = std::move(sendBatchScopePeers);
+    sendBatchScopePeers.clear();
+    for (auto& peer : peers)
+    {
+        {
+            std::unique_lock<std::mutex> lock{peer->_sendingQueueLock};
+            peer->_isBatchWritePending = false;
+        }
+
+        auto* executorPeer = peer.get();
+        asio::dispatch(executorPeer->_socket.get_executor(), [peer = std::move(peer)]() {
+            peer->StartAsyncWrite();
+        });
+    }
+}
+
+bool VAsioTcpPeer::SendBatchScope::IsActive()
+{
+    return sendBatchScopeDepth > 0;
+}
+
+void VAsioTcpPeer::SendBatchScope::AddPeer(std::shared_ptr<VAsioTcpPeer> peer)
+{
+    sendBatchScopePeers.emplace_back(std::move(peer));
+}
+
 void VAsioTcpPeer::StartAsyncWrite()
 {
     if (_sending)
         return;
 
-    std::unique_lock<std::mutex> lock{ _sendingQueueLock };
-    if (_sendingQueue.empty())
+    if (_isSendingToSharedMemory)
+    {
+        WriteSharedMemory();
+        return;
+    }
+
+    if (!TakeQueuedMessages())
     {
         return;
     }
 
     _sending = true;
+    WriteSomeAsync();
+}
+
+bool VAsioTcpPeer::TakeQueuedMessages()
+{
+    std::unique_lock<std::mutex> lock{ _sendingQueueLock };
+    if (_sendingQueue.empty())
+    {
+        return false;
+    }
+
+    // Messages queued inside a send batch are always written together
+    auto maxMessages = (std::max)(_sendCoalescingMaxMessages, _batchedMessagesInQueue);
+    const auto maxBytes =
+        _batchedMessagesInQueue > 0 ? (std::numeric_limits<std::size_t>::max)() : _sendCoalescingMaxBytes;
+
+    // Messages queued after the marker of a pending switch to shared memory must not be sent via the socket
+    if (_isSwitchToSharedMemoryPending)
+    {
+        maxMessages = (std::min)(maxMessages, _socketMessagesBeforeSharedMemory);
+    }
 
-    _currentSendingBufferData = std::move(_sendingQueue.front());
-    _sendingQueue.pop_front();
+    // Move as many queued messages as the coalescing limits allow into the current write. The first message is
+    // always taken, even if it exceeds the byte limit on its own.
+    _currentSendingBufferData.clear();
+    std::size_t totalBytes{0};
+    do
+    {
+        totalBytes += _sendingQueue.front().Size();
+        _currentSendingBufferData.emplace_back(std::move(_sendingQueue.front()));
+        _sendingQueue.pop_front();
+    } while (!_sendingQueue.empty() && _currentSendingBufferData.size() < maxMessages
+             && totalBytes + _sendingQueue.front().Size() <= maxBytes);
+    _batchedMessagesInQueue -= (std::min)(_batchedMessagesInQueue, _currentSendingBufferData.size());
+
+    if (_isSwitchToSharedMemoryPending)
+    {
+        _socketMessagesBeforeSharedMemory -= _currentSendingBufferData.size();
+        if (_socketMessagesBeforeSharedMemory == 0)
+        {
+            _isSwitchToSharedMemoryPending = false;
+            _switchToSharedMemoryAfterWrite = true;
+        }
+    }
     lock.unlock();
 
-    _currentSendingBuffer = asio::buffer(_currentSendingBufferData.data(), _currentSendingBufferData.size());
-    WriteSomeAsync();
+    _currentSendingBuffers.clear();
+    for (const auto& parts : _currentSendingBufferData)
+    {
+        _currentSendingBuffers.emplace_back(asio::buffer(parts.head.data(), parts.head.size()));
+        const auto body = parts.body.AsSpan();
+        if (body.size() > 0)
+        {
+            _currentSendingBuffers.emplace_back(asio::buffer(body.data(), body.size()));
+        }
+    }
+    return true;
 }
 
 void VAsioTcpPeer::WriteSomeAsync()
 {
-    _socket.async_write_some(_currentSendingBuffer,
+    _socket.async_write_some(_currentSendingBuffers,
         [self=this->shared_from_this()](const asio::error_code& error, std::size_t bytesWritten) {
             if (error && !IsErrorToTryAgain(error))
             {
@@ -453,19 +829,45 @@ void VAsioTcpPeer::WriteSomeAsync()
                 return;
             }
 
-            if (bytesWritten < self->_currentSendingBuffer.size())
+            self->ConsumeSendingBuffers(bytesWritten);
+            if (!self->_currentSendingBuffers.empty())
             {
-                self->_currentSendingBuffer += bytesWritten;
                 self->WriteSomeAsync();
                 return;
             }
 
+            // release the (possibly pooled) message buffers before starting the next write
+            self->_currentSendingBufferData.clear();
             self->_sending = false;
+            if (self->_switchToSharedMemoryAfterWrite)
+            {
+                self->_switchToSharedMemoryAfterWrite = false;
+                self->_isSendingToSharedMemory = true;
+                if (self->_isNotifyPending)
+                {
+                    self->_isNotifyPending = false;
+                    self->NotifySharedMemoryPeer();
+                }
+            }
             self->StartAsyncWrite();
         }
     );
 }
 
+void VAsioTcpPeer::ConsumeSendingBuffers(std::size_t bytesWritten)
+{
+    auto it = _currentSendingBuffers.begin();
+    for (; it != _currentSendingBuffers.end() && bytesWritten >= it->size(); ++it)
+    {
+        bytesWritten -= it->size();
+    }
+    if (it != _currentSendingBuffers.end())
+    {
+        *it += bytesWritten;
+    }
+    _currentSendingBuffers.erase(_currentSendingBuffers.begin(), it);
+}
+
 void VAsioTcpPeer::Subscribe(VAsioMsgSubscriber subscriber)
 {
     SilKit::Services::Logging::Debug(_logger, "Announcing subscription for [{}] {}", subscriber.networkName, subscriber.msgTypeName); 
@@ -474,25 +876,37 @@ void VAsioTcpPeer::Subscribe(VAsioMsgSubscriber subscriber)
 
 void VAsioTcpPeer::StartAsyncRead()
 {
-    _currentMsgSize = 0u;
+    // the socket must only be used on the executor of the peer, which might be a strand
+    asio::dispatch(_socket.get_executor(), [self = this->shared_from_this()] {
+        self->_socketReceiveBuffer.currentMsgSize = 0u;
 
-    _msgBuffer.resize(4096);
-    _wPos = {0u};
+        self->_socketReceiveBuffer.data = std::make_shared<std::vector<uint8_t>>(ReceiveBufferDefaultSize);
+        self->_socketReceiveBuffer.rPos = {0u};
+        self->_socketReceiveBuffer.wPos = {0u};
 
-    ReadSomeAsync();
+        self->ReadSomeAsync();
+    });
 }
 
 void VAsioTcpPeer::ReadSomeAsync()
 {
-    SILKIT_ASSERT(_msgBuffer.size() > 0);
-    auto* wPtr = _msgBuffer.data() + _wPos;
-    auto  size = _msgBuffer.size() - _wPos;
+    auto& receiveBuffer = _socketReceiveBuffer;
+    PrepareReceiveBuffer(receiveBuffer);
+
+    SILKIT_ASSERT(receiveBuffer.data->size() > receiveBuffer.wPos);
+    auto* wPtr = receiveBuffer.data->data() + receiveBuffer.wPos;
+    auto  size = receiveBuffer.data->size() - receiveBuffer.wPos;
 
     _socket.async_read_some(asio::buffer(wPtr, size),
         [self=this->shared_from_this()](const asio::error_code& error, std::size_t bytesRead)
         {
             if (error && !IsErrorToTryAgain(error))
             {
+                if (self->_isReceivingFromSharedMemory)
+                {
+                    // the remote side wrote its last messages into the ring before closing the socket
+                    self->ReadSharedMemory();
+                }
                 self->Shutdown();
                 return;
             }
@@ -502,78 +916,351 @@ void VAsioTcpPeer::ReadSomeAsync()
                 // On Linux, the TCP_QUICKACK might be reset after a read/recvmsg syscall.
                 EnableQuickAck(self->_logger, self->_socket);
             }
-            self->_wPos += bytesRead;
-            self->DispatchBuffer();
-
+            self->_socketReceiveBuffer.wPos += bytesRead;
+            if (self->DispatchBuffer(self->_socketReceiveBuffer))
+            {
+                self->ReadSomeAsync();
+            }
         }
     );
 }
 
-void VAsioTcpPeer::DispatchBuffer()
+void VAsioTcpPeer::PrepareReceiveBuffer(ReceiveBuffer& receiveBuffer)
 {
-    if (_currentMsgSize == 0)
+    // Move the bytes of a partially received message to the front of the receive buffer. If dispatched messages
+    // still refer to the current buffer, or if it has the wrong size, a new buffer is allocated instead.
+    auto& buffer = receiveBuffer.data;
+    const auto pendingBytes = receiveBuffer.wPos - receiveBuffer.rPos;
+    const auto requiredSize =
+        (std::max)(ReceiveBufferDefaultSize, static_cast<size_t>(receiveBuffer.currentMsgSize));
+
+    if (buffer.use_count() == 1 && buffer->size() == requiredSize)
     {
-        if (_isShuttingDown)
+        if (receiveBuffer.rPos != 0 && pendingBytes != 0)
         {
-            return;
+            memmove(buffer->data(), buffer->data() + receiveBuffer.rPos, pendingBytes);
         }
-        if (_wPos >= sizeof(uint32_t))
+    }
+    else
+    {
+        auto newBuffer = std::make_shared<std::vector<uint8_t>>(requiredSize);
+        if (pendingBytes != 0)
         {
-            _currentMsgSize = *reinterpret_cast<uint32_t*>(_msgBuffer.data());
+            memcpy(newBuffer->data(), buffer->data() + receiveBuffer.rPos, pendingBytes);
         }
-        else
+        buffer = std::move(newBuffer);
+    }
+
+    receiveBuffer.rPos = 0u;
+    receiveBuffer.wPos = pendingBytes;
+}
+
+bool VAsioTcpPeer::DispatchBuffer(ReceiveBuffer& receiveBuffer)
+{
+    // dispatch all complete messages contained in the receive buffer
+    for (;;)
+    {
+        const auto pendingBytes = receiveBuffer.wPos - receiveBuffer.rPos;
+
+        if (receiveBuffer.currentMsgSize == 0)
+        {
+            if (_isShuttingDown)
+            {
+                return false;
+            }
+            if (pendingBytes < sizeof(uint32_t))
+            {
+                // not enough data to even determine the message size
+                break;
+            }
+
+            uint32_t msgSize{0u};
+            memcpy(&msgSize, receiveBuffer.data->data() + receiveBuffer.rPos, sizeof msgSize);
+            receiveBuffer.currentMsgSize = msgSize;
+        }
+
+        // validate the received size
+        const uint32_t currentMsgSize = receiveBuffer.currentMsgSize;
+        if (currentMsgSize < sizeof(uint32_t) || currentMsgSize > 1024 * 1024 * 1024)
+        {
+            SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", currentMsgSize);
+            Shutdown();
+            return false;
+        }
+
+        if (pendingBytes < currentMsgSize)
+        {
+            // wait until we have more data
+            break;
+        }
+
+        // the message shares the ownership of the receive buffer, no bytes are copied
+        std::shared_ptr<const uint8_t> messageData{receiveBuffer.data,
+                                                   receiveBuffer.data->data() + receiveBuffer.rPos};
+        SerializedMessage message{std::move(messageData), currentMsgSize};
+        receiveBuffer.rPos += currentMsgSize;
+        receiveBuffer.currentMsgSize = 0u;
+
+        message.SetProtocolVersion(GetProtocolVersion());
+        if (message.GetMessageKind() == VAsioMsgKind::SharedMemoryTransport)
+        {
+            OnSharedMemoryTransportMessage(std::move(message));
+            continue;
+        }
+        _connection->OnSocketData(this, std::move(message));
+    }
+
+    return true;
+}
+
+// ----------------------------------------
+// Shared-memory transport
+//
+// The connecting peer creates the segment and sends a Request. The accepting peer attaches to the segment and replies
+// with Accept (or Reject), which is the last message it sends via the socket. The connecting peer starts reading the
+// ring after the Accept and sends Start as its last message via the socket. Afterwards, the socket only carries
+// Notify messages, which wake up a peer that waits for data or free space in a ring.
+
+bool VAsioTcpPeer::IsLocalDomainSocket() const
+{
+    return _socket.is_open() && _socket.local_endpoint().protocol().family() == asio::local::stream_protocol{}.family();
+}
+
+void VAsioTcpPeer::RequestSharedMemoryTransport()
+{
+    const auto& middleware = _connection->Config().middleware;
+    if (!middleware.enableSharedMemory || !SharedMemoryPipe::IsSupported() || !IsLocalDomainSocket()
+        || !VAsioCapabilities{_info.capabilities}.HasCapability("shared-memory"))
+    {
+        return;
+    }
+
+    const auto ringCapacity = static_cast<std::size_t>((std::max)(middleware.sharedMemoryBufferSize, 0));
+    asio::dispatch(_socket.get_executor(), [self = this->shared_from_this(), ringCapacity] {
+        try
         {
-            // not enough data to even determine the message size...
-            // make sure the buffer can store some data
-            if (_msgBuffer.size() < sizeof(uint32_t))
-                _msgBuffer.resize(4096); 
-            // and restart the async read operation
-            ReadSomeAsync();
+            self->_sharedMemory = SharedMemoryPipe::Create(SharedMemoryPipe::MakeUniqueName(), ringCapacity);
+        }
+        catch (const std::exception& error)
+        {
+            SilKit::Services::Logging::Warn(self->_logger, "VAsioTcpPeer: Cannot use shared memory for {}: {}",
+                                            self->GetRemoteAddress(), error.what());
             return;
         }
+
+        SharedMemoryTransportMessage request;
+        request.kind = SharedMemoryTransportMessage::Kind::Request;
+        request.segmentName = self->_sharedMemory->Name();
+        self->SendSilKitMsg(SerializedMessage{request});
+    });
+}
+
+void VAsioTcpPeer::AcceptSharedMemoryTransport(const std::string& segmentName)
+{
+    const auto& middleware = _connection->Config().middleware;
+    if (middleware.enableSharedMemory && SharedMemoryPipe::IsSupported() && IsLocalDomainSocket() && !_sharedMemory)
+    {
+        try
+        {
+            _sharedMemory = SharedMemoryPipe::Open(segmentName);
+        }
+        catch (const std::exception& error)
+        {
+            SilKit::Services::Logging::Warn(_logger, "VAsioTcpPeer: Cannot use shared memory for {}: {}",
+                                            GetRemoteAddress(), error.what());
+        }
     }
 
-    // validate the received size
-    if (_currentMsgSize == 0 || _currentMsgSize > 1024 * 1024 * 1024)
+    if (!_sharedMemory)
     {
-        SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", _currentMsgSize);
-        Shutdown();
+        SharedMemoryTransportMessage reject;
+        reject.kind = SharedMemoryTransportMessage::Kind::Reject;
+        SendSilKitMsg(SerializedMessage{reject});
+        return;
     }
 
+    SilKit::Services::Logging::Debug(_logger, "VAsioTcpPeer: Using shared memory for {}", GetRemoteAddress());
+    SwitchSendingToSharedMemory(SharedMemoryTransportMessage::Kind::Accept);
+}
+
+void VAsioTcpPeer::OnSharedMemoryTransportMessage(SerializedMessage&& message)
+{
+    const auto msg = message.Deserialize<SharedMemoryTransportMessage>();
+    switch (msg.kind)
+    {
+    case SharedMemoryTransportMessage::Kind::Request:
+        AcceptSharedMemoryTransport(msg.segmentName);
+        break;
+    case SharedMemoryTransportMessage::Kind::Accept:
+        if (_sharedMemory)
+        {
+            SilKit::Services::Logging::Debug(_logger, "VAsioTcpPeer: Using shared memory for {}",
+                                             GetRemoteAddress());
+            // both sides are attached, the name is no longer required
+            _sharedMemory->Unlink();
+            SwitchSendingToSharedMemory(SharedMemoryTransportMessage::Kind::Start);
+            _isReceivingFromSharedMemory = true;
+            ReadSharedMemory();
+        }
+        break;
+    case SharedMemoryTransportMessage::Kind::Reject:
+        SilKit::Services::Logging::Debug(_logger, "VAsioTcpPeer: {} rejected the use of shared memory",
+                                         GetRemoteAddress());
+        _sharedMemory.reset();
+        break;
+    case SharedMemoryTransportMessage::Kind::Start:
+        if (_sharedMemory)
+        {
+            _isReceivingFromSharedMemory = true;
+            ReadSharedMemory();
+        }
+        break;
+    case SharedMemoryTransportMessage::Kind::Notify:
+        if (_isReceivingFromSharedMemory)
+        {
+            ReadSharedMemory();
+        }
+        StartAsyncWrite();
+        break;
+    case SharedMemoryTransportMessage::Kind::Invalid:
+        SilKit::Services::Logging::Warn(_logger, "VAsioTcpPeer: Received invalid shared-memory transport message");
+        break;
+    }
+}
 
-    if (_wPos < _currentMsgSize)
+void VAsioTcpPeer::SwitchSendingToSharedMemory(SharedMemoryTransportMessage::Kind lastSocketMessage)
+{
+    if (_isShuttingDown || !_socket.is_open())
     {
-        // Make the buffer large enough and wait until we have more data.
-        _msgBuffer.resize(_currentMsgSize);
-        ReadSomeAsync();
         return;
     }
-    else
+
+    SharedMemoryTransportMessage marker;
+    marker.kind = lastSocketMessage;
+    SerializedMessage markerMessage{marker};
+
+    std::unique_lock<std::mutex> lock{_sendingQueueLock};
+    _sendingQueue.push_back(markerMessage.ReleaseStorageParts());
+    _socketMessagesBeforeSharedMemory = _sendingQueue.size();
+    _isSwitchToSharedMemoryPending = true;
+    lock.unlock();
+
+    StartAsyncWrite();
+}
+
+void VAsioTcpPeer::WriteSharedMemory()
+{
+    for (;;)
     {
-        auto newBuffer = std::vector<uint8_t>{_msgBuffer.begin() + _currentMsgSize, _msgBuffer.end()};
-        auto newWPos = _wPos - _currentMsgSize;
+        if (_currentSendingBuffers.empty())
+        {
+            // release the (possibly pooled) message buffers of the previous batch
+            _currentSendingBufferData.clear();
+            if (!TakeQueuedMessages())
+            {
+                return;
+            }
+        }
 
-        // manually extract the message size so we can adjust the MessageBuffer size
-        uint32_t msgSize{0u};
-        if (_msgBuffer.size() < sizeof msgSize)
+        std::size_t bytesWritten{0};
+        for (const auto& buffer : _currentSendingBuffers)
         {
-            throw SilKitError{ "DispatchBuffer: Received message is too small to contain message size header" };
+            const auto count = _sharedMemory->Write(static_cast<const uint8_t*>(buffer.data()), buffer.size());
+            bytesWritten += count;
+            if (count < buffer.size())
+            {
+                break;
+            }
         }
-        memcpy(&msgSize, _msgBuffer.data(), sizeof msgSize);
-        //ensure buffer does not contain data from contiguous messages
-        _msgBuffer.resize(msgSize);
-        SerializedMessage message{std::move(_msgBuffer)};
-        message.SetProtocolVersion(GetProtocolVersion());
-        _connection->OnSocketData(this, std::move(message));
+        ConsumeSendingBuffers(bytesWritten);
 
-        // keep trailing data in the buffer
-        _msgBuffer = std::move(newBuffer);
-        _wPos = newWPos;
-        _currentMsgSize = 0u;
+        if (bytesWritten != 0 && _sharedMemory->TakeRemoteReaderWaiting())
+        {
+            NotifySharedMemoryPeer();
+        }
 
-        DispatchBuffer();
+        // the ring is full, continue after the remote side notifies us about free space
+        if (!_currentSendingBuffers.empty() && _sharedMemory->WaitForSpace())
+        {
+            return;
+        }
     }
 }
 
+void VAsioTcpPeer::ReadSharedMemory()
+{
+    auto& receiveBuffer = _sharedMemoryReceiveBuffer;
+    if (!receiveBuffer.data)
+    {
+        receiveBuffer.data = std::make_shared<std::vector<uint8_t>>(ReceiveBufferDefaultSize);
+    }
+
+    for (;;)
+    {
+        PrepareReceiveBuffer(receiveBuffer);
+
+        const auto bytesRead = _sharedMemory->Read(receiveBuffer.data->data() + receiveBuffer.wPos,
+                                                   receiveBuffer.data->size() - receiveBuffer.wPos);
+        if (bytesRead == 0)
+        {
+            // the ring is empty, continue after the remote side notifies us about new data
+            if (_sharedMemory->WaitForData())
+            {
+                return;
+            }
+            continue;
+        }
+        receiveBuffer.wPos += bytesRead;
+
+        if (_sharedMemory->TakeRemoteWriterWaiting())
+        {
+            NotifySharedMemoryPeer();
+        }
+
+        if (!DispatchBuffer(receiveBuffer))
+        {
+            return;
+        }
+    }
+}
+
+void VAsioTcpPeer::NotifySharedMemoryPeer()
+{
+    if (!_isSendingToSharedMemory)
+    {
+        // regular messages are still sent via the socket, notify after the switch
+        _isNotifyPending = true;
+        return;
+    }
+    if (_isNotifyInFlight)
+    {
+        _isNotifyPending = true;
+        return;
+    }
+
+    if (_notifyMessage.empty())
+    {
+        SharedMemoryTransportMessage notify;
+        notify.kind = SharedMemoryTransportMessage::Kind::Notify;
+        _notifyMessage = SerializedMessage{notify}.ReleaseStorage();
+    }
+
+    _isNotifyInFlight = true;
+    asio::async_write(_socket, asio::buffer(_notifyMessage),
+        [self = this->shared_from_this()](const asio::error_code& error, std::size_t) {
+            self->_isNotifyInFlight = false;
+            if (error && !IsErrorToTryAgain(error))
+            {
+                self->Shutdown();
+                return;
+            }
+            if (self->_isNotifyPending)
+            {
+                self->_isNotifyPending = false;
+                self->NotifySharedMemoryPeer();
+            }
+        });
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -22,6 +22,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <vector>
 #include <queue>
 #include <mutex>
@@ -32,9 +35,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "EndpointAddress.hpp"
 #include "MessageBuffer.hpp"
+#include "VAsioDatatypes.hpp"
 #include "VAsioPeerInfo.hpp"
 #include "ProtocolVersion.hpp"
 #include "IVAsioConnectionPeer.hpp"
+#include "SharedMemoryPipe.hpp"
 
 
 namespace SilKit {
@@ -50,6 +55,19 @@ public:
     // ----------------------------------------
     // Public Data Types
 
+    //! State of a receive direction. Received messages refer to slices of the buffer, which is reused as long as no
+    //! dispatched message is alive.
+    struct ReceiveBuffer
+    {
+        std::shared_ptr<std::vector<uint8_t>> data;
+        size_t rPos{0};
+        size_t wPos{0};
+        std::atomic<uint32_t> currentMsgSize{0u};
+    };
+
+    //! Invoked on the executor of the peer, when a connection was established or all attempts failed
+    using ConnectHandler = std::function<void(bool connected, const std::string& errorMessage)>;
+
 public:
     // ----------------------------------------
     // Constructors and Destructor
@@ -91,6 +109,9 @@ public:
     auto GetLocalAddress() const -> std::string override;
 
     void Connect(VAsioPeerInfo info);
+    //! Connects without blocking. Local-domain sockets are preferred, the remaining endpoints are raced with a
+    //! staggered start, i.e., the next attempt starts if the previous one failed or did not finish in time.
+    void ConnectAsync(VAsioPeerInfo info, ConnectHandler handler);
 
     inline auto Socket() -> asio::generic::stream_protocol::socket& { return _socket; }
 
@@ -105,22 +126,61 @@ public:
     
     void DrainAllBuffers() override;
 
+    //! Offers the shared-memory transport to the peer, if both sides support it and share the host. Must be called
+    //! after the ParticipantAnnouncement was sent.
+    void RequestSharedMemoryTransport();
+
+    //! While an instance exists, the messages sent on the current thread are written by a single (gather-)write per
+    //! peer. The writes are started when the outermost scope is left.
+    class SendBatchScope
+    {
+    public:
+        SendBatchScope();
+        ~SendBatchScope();
+        SendBatchScope(const SendBatchScope&) = delete;
+        SendBatchScope& operator=(const SendBatchScope&) = delete;
+
+        static bool IsActive();
+
+    private:
+        friend class VAsioTcpPeer;
+        //! Records a peer whose write is started when the outermost scope is left
+        static void AddPeer(std::shared_ptr<VAsioTcpPeer> peer);
+    };
+
 private:
     // ----------------------------------------
     // Private Methods
     static bool IsErrorToTryAgain(const asio::error_code & ec);
     void StartAsyncWrite();
+    bool TakeQueuedMessages();
     void WriteSomeAsync();
+    void ConsumeSendingBuffers(std::size_t bytesWritten);
     void ReadSomeAsync();
-    void DispatchBuffer();
+    void PrepareReceiveBuffer(ReceiveBuffer& receiveBuffer);
+    bool DispatchBuffer(ReceiveBuffer& receiveBuffer);
+    bool IsLocalDomainSocket() const;
+    void OnSharedMemoryTransportMessage(SerializedMessage&& message);
+    void AcceptSharedMemoryTransport(const std::string& segmentName);
+    void SwitchSendingToSharedMemory(SharedMemoryTransportMessage::Kind lastSocketMessage);
+    void WriteSharedMemory();
+    void ReadSharedMemory();
+    void NotifySharedMemoryPeer();
     void Shutdown();
     bool ConnectLocal(const std::string& path);
     bool ConnectTcp(const std::string& host, uint16_t port);
+    void SetTcpOptions();
+    struct ConnectState;
+    void ResolveConnectEndpoints(const std::shared_ptr<ConnectState>& state, const std::string& host, uint16_t port);
+    void StartNextConnectAttempt(const std::shared_ptr<ConnectState>& state);
+    void FinishConnect(const std::shared_ptr<ConnectState>& state,
+                       std::shared_ptr<asio::generic::stream_protocol::socket> socket);
 
 private:
     // ----------------------------------------
     // Private Members
-    ProtocolVersion _protocolVersion{};
+    // set by the connection, read on the executor of the peer
+    std::atomic<ProtocolVersion> _protocolVersion{ProtocolVersion{}};
     asio::generic::stream_protocol::socket _socket;
     VAsioConnection* _connection{nullptr};
     VAsioPeerInfo _info;
@@ -128,18 +188,37 @@ private:
     Services::Logging::ILogger* _logger;
 
     // receiving
-    std::atomic<uint32_t> _currentMsgSize{0u};
-    std::vector<uint8_t> _msgBuffer;
-    size_t _wPos{0};
+    ReceiveBuffer _socketReceiveBuffer;
 
     // sending
     std::atomic_bool _isShuttingDown{false};
-    std::deque<std::vector<uint8_t>> _sendingQueue;
-    asio::mutable_buffer _currentSendingBuffer;
-    std::vector<uint8_t> _currentSendingBufferData;
+    std::deque<SerializedMessageParts> _sendingQueue;
+    // the messages of the current (gather-)write and the buffer sequence referring to their unsent bytes
+    std::vector<SerializedMessageParts> _currentSendingBufferData;
+    std::vector<asio::const_buffer> _currentSendingBuffers;
     mutable std::mutex _sendingQueueLock;
     std::atomic_bool _sending{false};
     bool _enableQuickAck{false};
+    // limits for coalescing multiple queued messages into a single gather-write
+    std::size_t _sendCoalescingMaxMessages{1};
+    std::size_t _sendCoalescingMaxBytes{0};
+    // number of queued messages sent inside a SendBatchScope, which are written together regardless of the limits
+    std::size_t _batchedMessagesInQueue{0};
+    bool _isBatchWritePending{false};
+
+    // shared-memory transport, only accessed on the I/O thread (except for the counter guarded by the queue lock)
+    std::unique_ptr<SharedMemoryPipe> _sharedMemory;
+    ReceiveBuffer _sharedMemoryReceiveBuffer;
+    bool _isReceivingFromSharedMemory{false};
+    bool _isSendingToSharedMemory{false};
+    // the queued messages up to the Accept/Start marker are still sent via the socket
+    bool _isSwitchToSharedMemoryPending{false};
+    std::size_t _socketMessagesBeforeSharedMemory{0};
+    bool _switchToSharedMemoryAfterWrite{false};
+    // notifications are written to the socket directly, after all regular messages went out
+    std::vector<uint8_t> _notifyMessage;
+    bool _isNotifyInFlight{false};
+    bool _isNotifyPending{false};
     Core::ServiceDescriptor _serviceDescriptor;
 };
 
@@ -158,12 +237,12 @@ auto VAsioTcpPeer::GetServiceDescriptor() const -> const Core::ServiceDescriptor
 
 void VAsioTcpPeer::SetProtocolVersion(ProtocolVersion v)
 {
-    _protocolVersion = std::move(v);
+    _protocolVersion.store(v);
 }
 
 auto VAsioTcpPeer::GetProtocolVersion() const -> ProtocolVersion
 {
-    return _protocolVersion;
+    return _protocolVersion.load();
 }
 
 } // namespace Core
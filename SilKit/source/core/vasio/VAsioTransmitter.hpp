@@ -22,15 +22,18 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <sstream>
+#include <unordered_map>
 
 #include "IVAsioPeer.hpp"
 #include <type_traits>
 
 #include "IMessageReceiver.hpp"
 #include "IServiceEndpoint.hpp"
+#include "AcceptanceKey.hpp"
 #include "traits/SilKitMsgTraits.hpp"
 
 #include "SerializedMessage.hpp"
+#include "MessageBufferPool.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -78,9 +81,15 @@ private:
 };
 
 
+// Limits of the buffer pool used for the payloads which are shared between multiple remote receivers
+constexpr std::size_t TransmitterPoolMaxBuffers = 32;
+constexpr std::size_t TransmitterPoolMaxBufferCapacity = 64 * 1024;
+
 struct RemoteReceiver {
     IVAsioPeer* peer;
     EndpointId remoteIdx;
+    AcceptanceFilter filter; //!< Announced by the remote receiver, messages it rejects are not sent to it
+    EncodedSimMessageHeaders headers; //!< Encoded when the receiver is added, immutable afterwards
 };
 
 template <class MsgT>
@@ -95,7 +104,7 @@ public:
     // Public methods
     void AddRemoteReceiver(IVAsioPeer* peer, EndpointId remoteIdx)
     {
-        RemoteReceiver remoteReceiver;
+        RemoteReceiver remoteReceiver{};
         remoteReceiver.peer = peer;
         remoteReceiver.remoteIdx = remoteIdx;
 
@@ -103,21 +112,50 @@ public:
             return;
 
 
-        _serviceDescriptor.SetParticipantNameAndComputeId(peer->GetInfo().participantName);
-        _remoteReceivers.push_back(remoteReceiver);
+        remoteReceiver.headers = SerializedMessage::EncodeSimMessageHeaders(messageKind<MsgT>(), remoteIdx);
+
+        const auto& participantName = peer->GetInfo().participantName;
+        _serviceDescriptor.SetParticipantNameAndComputeId(participantName);
+        _receiverIndexByParticipantName.emplace(participantName, _remoteReceivers.size());
+        _remoteReceivers.push_back(std::move(remoteReceiver));
         _hist.NotifyPeer(peer, remoteIdx);
     }
 
     void RemoveRemoteReceiver(IVAsioPeer* peer)
     {
-        auto it = std::find_if(_remoteReceivers.begin(), _remoteReceivers.end(), [peer](auto&& remoteReceiver) {
-            auto localPeerInfo = remoteReceiver.peer->GetInfo();
-            auto peerToRemove = peer->GetInfo();
-            return localPeerInfo.participantId == peerToRemove.participantId;
+        const auto participantIdToRemove = peer->GetInfo().participantId;
+        auto it = std::find_if(_remoteReceivers.begin(), _remoteReceivers.end(), [participantIdToRemove](auto&& remoteReceiver) {
+            return remoteReceiver.peer->GetInfo().participantId == participantIdToRemove;
         });
         if (it != _remoteReceivers.end())
         {
+            if (!it->filter.AcceptsAll())
+            {
+                --_numFilteredReceivers;
+            }
             _remoteReceivers.erase(it);
+            RebuildReceiverIndex();
+        }
+    }
+
+    //! \brief Only messages accepted by the filter are sent to the remote receiver, except for targeted messages
+    void SetRemoteReceiverFilter(IVAsioPeer* peer, EndpointId remoteIdx, AcceptanceFilter filter)
+    {
+        auto it = std::find_if(_remoteReceivers.begin(), _remoteReceivers.end(), [peer, remoteIdx](auto&& receiver) {
+            return receiver.peer == peer && receiver.remoteIdx == remoteIdx;
+        });
+        if (it == _remoteReceivers.end())
+        {
+            return;
+        }
+        if (!it->filter.AcceptsAll())
+        {
+            --_numFilteredReceivers;
+        }
+        it->filter = std::move(filter);
+        if (!it->filter.AcceptsAll())
+        {
+            ++_numFilteredReceivers;
         }
     }
 
@@ -139,11 +177,8 @@ public:
     void SendMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName, const MsgT& msg)
     {
         _hist.Save(from, msg);
-        auto&& receiverIter = std::find_if(_remoteReceivers.begin(), _remoteReceivers.end(), [targetParticipantName](auto&& receiver) 
-            {
-                return receiver.peer->GetInfo().participantName == targetParticipantName;
-            });
-        if (receiverIter == _remoteReceivers.end())
+        const auto indexIter = _receiverIndexByParticipantName.find(targetParticipantName);
+        if (indexIter == _receiverIndexByParticipantName.end())
         {
             std::stringstream ss;
             ss << "Error: Attempt to send targeted message to participant '"
@@ -151,8 +186,9 @@ public:
                 << "', which is not a valid remote receiver.";
             throw SilKitError{ss.str()};
         }
-        auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiverIter->remoteIdx);
-        receiverIter->peer->SendSilKitMsg(std::move(buffer));
+        auto&& receiver = _remoteReceivers[indexIter->second];
+        receiver.peer->SendSilKitMsg(
+            SerializedMessage(receiver.headers, to_endpointAddress(from->GetServiceDescriptor()), msg));
     }
 
     void SetHistoryLength(size_t historyLength)
@@ -166,10 +202,30 @@ public:
     void ReceiveMsg(const IServiceEndpoint* from, const MsgT& msg) override
     {
         _hist.Save(from, msg);
+        if (AcceptanceKey<MsgT>::IsFilterable() && _numFilteredReceivers > 0)
+        {
+            SendToAcceptingReceivers(from, msg);
+            return;
+        }
+        if (_remoteReceivers.size() == 1)
+        {
+            auto&& receiver = _remoteReceivers.front();
+            receiver.peer->SendSilKitMsg(
+                SerializedMessage(receiver.headers, to_endpointAddress(from->GetServiceDescriptor()), msg));
+            return;
+        }
+        if (_remoteReceivers.empty())
+        {
+            return;
+        }
+
+        // Serialize the payload only once and share it between all remote receivers, which only differ in the
+        // remote index of the network headers
+        auto body = _bufferPool->Share(SerializedMessage::SerializeBody(msg, _bufferPool->Acquire()));
+        const auto endpointAddress = to_endpointAddress(from->GetServiceDescriptor());
         for (auto& receiver : _remoteReceivers)
         {
-            auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver.remoteIdx);
-            receiver.peer->SendSilKitMsg(std::move(buffer));
+            receiver.peer->SendSilKitMsg(SerializedMessage(receiver.headers, endpointAddress, body));
         }
     }
 
@@ -182,11 +238,59 @@ public:
     {
         return _serviceDescriptor;
     }
+private:
+    // ----------------------------------------
+    // private methods
+    void SendToAcceptingReceivers(const IServiceEndpoint* from, const MsgT& msg)
+    {
+        const auto key = AcceptanceKey<MsgT>::Get(msg);
+        const auto numAccepting = std::count_if(_remoteReceivers.begin(), _remoteReceivers.end(), [key](auto&& receiver) {
+            return receiver.filter.Accepts(key);
+        });
+        if (numAccepting == 0)
+        {
+            return;
+        }
+
+        const auto endpointAddress = to_endpointAddress(from->GetServiceDescriptor());
+        if (numAccepting == 1)
+        {
+            auto&& receiver = *std::find_if(_remoteReceivers.begin(), _remoteReceivers.end(), [key](auto&& receiver) {
+                return receiver.filter.Accepts(key);
+            });
+            receiver.peer->SendSilKitMsg(SerializedMessage(receiver.headers, endpointAddress, msg));
+            return;
+        }
+
+        auto body = _bufferPool->Share(SerializedMessage::SerializeBody(msg, _bufferPool->Acquire()));
+        for (auto& receiver : _remoteReceivers)
+        {
+            if (receiver.filter.Accepts(key))
+            {
+                receiver.peer->SendSilKitMsg(SerializedMessage(receiver.headers, endpointAddress, body));
+            }
+        }
+    }
+
+    void RebuildReceiverIndex()
+    {
+        _receiverIndexByParticipantName.clear();
+        for (std::size_t index = 0; index < _remoteReceivers.size(); ++index)
+        {
+            _receiverIndexByParticipantName.emplace(_remoteReceivers[index].peer->GetInfo().participantName, index);
+        }
+    }
+
 private:
     // ----------------------------------------
     // private members
     std::vector<RemoteReceiver> _remoteReceivers;
+    //! Position of the (first) receiver of a participant in _remoteReceivers, for targeted messages
+    std::unordered_map<std::string, std::size_t> _receiverIndexByParticipantName;
+    std::size_t _numFilteredReceivers{0};
     ServiceDescriptor _serviceDescriptor;
+    std::shared_ptr<MessageBufferPool> _bufferPool{
+        std::make_shared<MessageBufferPool>(TransmitterPoolMaxBuffers, TransmitterPoolMaxBufferCapacity)};
 };
 
 // ================================================================================
@@ -32,6 +32,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "RpcClientDto.hpp"
 #include "RpcServerDto.hpp"
 #include "SimulationEndDto.hpp"
+#include "BulkSimulationDto.hpp"
 
 #include OATPP_CODEGEN_BEGIN(ApiClient)
 
@@ -159,6 +160,10 @@ class DashboardSystemApiClient : public oatpp::web::client::ApiClient
                    updateSystemStatusForSimulation, PATH(UInt64, simulationId),
                    BODY_DTO(Object<SystemStatusDto>, systemStatus))
 
+    // notify all updates of an event batch for a given simulation
+    API_CALL("POST", "system-service/v1.0/simulations/{simulationId}/bulk", addBulkUpdateToSimulation,
+                   PATH(UInt64, simulationId), BODY_DTO(Object<BulkSimulationDto>, bulkSimulation))
+
     // notify the end of a simulation
     API_CALL("POST", "system-service/v1.0/simulations/{simulationId}", setSimulationEnd,
                    PATH(UInt64, simulationId), BODY_DTO(Object<SimulationEndDto>, simulation))
@@ -203,6 +203,24 @@ void DashboardSystemServiceClient::UpdateSystemStatusForSimulation(oatpp::UInt64
     Log(response, "updating system status");
 }
 
+BulkUpdateResult DashboardSystemServiceClient::AddBulkUpdateToSimulation(
+    oatpp::UInt64 simulationId, oatpp::Object<BulkSimulationDto> bulkSimulation)
+{
+    auto response = _dashboardSystemApiClient->addBulkUpdateToSimulation(simulationId, bulkSimulation);
+    if (response
+        && (response->getStatusCode() == 404 || response->getStatusCode() == 405 || response->getStatusCode() == 501))
+    {
+        Services::Logging::Debug(_logger, "Dashboard: adding bulk update returned {}", response->getStatusCode());
+        return BulkUpdateResult::Unsupported;
+    }
+    Log(response, "adding bulk update");
+    if (!response || response->getStatusCode() >= 400)
+    {
+        return BulkUpdateResult::Failed;
+    }
+    return BulkUpdateResult::Ok;
+}
+
 void DashboardSystemServiceClient::SetSimulationEnd(oatpp::UInt64 simulationId,
                                                     oatpp::Object<SimulationEndDto> simulation)
 {
@@ -104,6 +104,9 @@ public:
     void UpdateSystemStatusForSimulation(oatpp::UInt64 simulationId,
                                          oatpp::Object<SystemStatusDto> systemStatus) override;
 
+    BulkUpdateResult AddBulkUpdateToSimulation(oatpp::UInt64 simulationId,
+                                               oatpp::Object<BulkSimulationDto> bulkSimulation) override;
+
     void SetSimulationEnd(oatpp::UInt64 simulationId, oatpp::Object<SimulationEndDto> simulation) override;
 
 private:
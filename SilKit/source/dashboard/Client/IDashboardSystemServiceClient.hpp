@@ -31,10 +31,18 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "RpcClientDto.hpp"
 #include "RpcServerDto.hpp"
 #include "SimulationEndDto.hpp"
+#include "BulkSimulationDto.hpp"
 
 namespace SilKit {
 namespace Dashboard {
 
+enum class BulkUpdateResult
+{
+    Ok,
+    Unsupported, //!< the server does not support bulk updates
+    Failed
+};
+
 class IDashboardSystemServiceClient
 {
 public:
@@ -104,6 +112,9 @@ public:
     virtual void UpdateSystemStatusForSimulation(oatpp::UInt64 simulationId,
                                                  oatpp::Object<SystemStatusDto> systemStatus) = 0;
 
+    virtual BulkUpdateResult AddBulkUpdateToSimulation(oatpp::UInt64 simulationId,
+                                                       oatpp::Object<BulkSimulationDto> bulkSimulation) = 0;
+
     virtual void SetSimulationEnd(oatpp::UInt64 simulationId, oatpp::Object<SimulationEndDto> simulation) = 0;
 };
 
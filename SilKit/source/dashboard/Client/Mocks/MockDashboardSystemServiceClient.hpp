@@ -82,6 +82,8 @@ public:
 
     MOCK_METHOD(void, UpdateSystemStatusForSimulation, (oatpp::UInt64, oatpp::Object<SystemStatusDto>), (override));
 
+    MOCK_METHOD(BulkUpdateResult, AddBulkUpdateToSimulation, (oatpp::UInt64, oatpp::Object<BulkSimulationDto>), (override));
+
     MOCK_METHOD(void, SetSimulationEnd, (oatpp::UInt64, oatpp::Object<SimulationEndDto>), (override));
 };
 } // namespace Dashboard
@@ -192,5 +192,71 @@ TEST_F(TestDashboardSystemServiceClient, SetSimulationEnd_Failure)
     ASSERT_STREQ(actualPath->c_str(), "system-service/v1.0/simulations/123");
 }
 
+TEST_F(TestDashboardSystemServiceClient, AddBulkUpdateToSimulation_Success)
+{
+    // Arrange
+    EXPECT_CALL(*_mockObjectMapper, write);
+    oatpp::String actualPath;
+    oatpp::String actualMethod;
+    SetupExecuteRequest(Status::CODE_204,
+                        [&actualPath, &actualMethod](auto currentMethod, auto pathTemplate, auto map) {
+                            actualMethod = currentMethod;
+                            actualPath = pathTemplate.format(map);
+                        });
+    EXPECT_CALL(_dummyLogger, Log(Services::Logging::Level::Debug, "Dashboard: adding bulk update returned 204"));
+
+    // Act
+    auto result = BulkUpdateResult::Failed;
+    {
+        const auto service = CreateService();
+        const oatpp::UInt64 expectedSimulationId = 123;
+        auto request = BulkSimulationDto::createShared();
+        result = service->AddBulkUpdateToSimulation(expectedSimulationId, request);
+    }
+
+    // Assert
+    ASSERT_EQ(result, BulkUpdateResult::Ok);
+    ASSERT_STREQ(actualMethod->c_str(), "POST");
+    ASSERT_STREQ(actualPath->c_str(), "system-service/v1.0/simulations/123/bulk");
+}
+
+TEST_F(TestDashboardSystemServiceClient, AddBulkUpdateToSimulation_NotSupported)
+{
+    // Arrange
+    EXPECT_CALL(*_mockObjectMapper, write);
+    SetupExecuteRequest(Status::CODE_404, [](auto, auto, auto) {});
+    EXPECT_CALL(_dummyLogger, Log(Services::Logging::Level::Debug, "Dashboard: adding bulk update returned 404"));
+
+    // Act
+    auto result = BulkUpdateResult::Ok;
+    {
+        const auto service = CreateService();
+        auto request = BulkSimulationDto::createShared();
+        result = service->AddBulkUpdateToSimulation(123, request);
+    }
+
+    // Assert
+    ASSERT_EQ(result, BulkUpdateResult::Unsupported);
+}
+
+TEST_F(TestDashboardSystemServiceClient, AddBulkUpdateToSimulation_Failure)
+{
+    // Arrange
+    EXPECT_CALL(*_mockObjectMapper, write);
+    SetupExecuteRequest(Status::CODE_500, [](auto, auto, auto) {});
+    EXPECT_CALL(_dummyLogger, Log(Services::Logging::Level::Error, "Dashboard: adding bulk update returned 500"));
+
+    // Act
+    auto result = BulkUpdateResult::Ok;
+    {
+        const auto service = CreateService();
+        auto request = BulkSimulationDto::createShared();
+        result = service->AddBulkUpdateToSimulation(123, request);
+    }
+
+    // Assert
+    ASSERT_EQ(result, BulkUpdateResult::Failed);
+}
+
 } // namespace Dashboard
 } // namespace SilKit
@@ -67,6 +67,8 @@ auto RunDashboardTest(std::shared_ptr<SilKit::Config::IParticipantConfiguration>
 
         testResult.dataBySimulation = controller->GetData();
         testResult.allSimulationsFinished = controller->AllSimulationsFinished();
+        testResult.eventCount = controller->GetEventCount();
+        testResult.eventsPerSecond = controller->GetEventsPerSecond();
     }
     catch (oatpp::web::protocol::http::HttpError& error)
     {
@@ -0,0 +1,113 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include "DataPublisherDto.hpp"
+#include "DataSubscriberDto.hpp"
+#include "ParticipantStatusDto.hpp"
+#include "RpcClientDto.hpp"
+#include "RpcServerDto.hpp"
+#include "ServiceDto.hpp"
+#include "SystemStatusDto.hpp"
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+namespace SilKit {
+namespace Dashboard {
+
+class ServiceInternalDto : public ServiceDto
+{
+    DTO_INIT(ServiceInternalDto, ServiceDto)
+
+    DTO_FIELD_INFO(parentServiceId) { info->description = "Service id of the parent service"; }
+    DTO_FIELD(String, parentServiceId);
+};
+
+class BulkParticipantDto : public oatpp::DTO
+{
+    DTO_INIT(BulkParticipantDto, DTO)
+
+    DTO_FIELD_INFO(name) { info->description = "Name of the participant"; }
+    DTO_FIELD(String, name);
+
+    DTO_FIELD_INFO(statuses) { info->description = "Participant statuses in order of occurrence"; }
+    DTO_FIELD(List<Object<ParticipantStatusDto>>, statuses) = {};
+
+    DTO_FIELD_INFO(canControllers) { info->description = "CAN controllers by service id"; }
+    DTO_FIELD(Fields<Object<ServiceDto>>, canControllers) = {};
+
+    DTO_FIELD_INFO(ethernetControllers) { info->description = "Ethernet controllers by service id"; }
+    DTO_FIELD(Fields<Object<ServiceDto>>, ethernetControllers) = {};
+
+    DTO_FIELD_INFO(flexrayControllers) { info->description = "FlexRay controllers by service id"; }
+    DTO_FIELD(Fields<Object<ServiceDto>>, flexrayControllers) = {};
+
+    DTO_FIELD_INFO(linControllers) { info->description = "LIN controllers by service id"; }
+    DTO_FIELD(Fields<Object<ServiceDto>>, linControllers) = {};
+
+    DTO_FIELD_INFO(dataPublishers) { info->description = "Data publishers by service id"; }
+    DTO_FIELD(Fields<Object<DataPublisherDto>>, dataPublishers) = {};
+
+    DTO_FIELD_INFO(dataSubscribers) { info->description = "Data subscribers by service id"; }
+    DTO_FIELD(Fields<Object<DataSubscriberDto>>, dataSubscribers) = {};
+
+    DTO_FIELD_INFO(dataSubscriberInternals) { info->description = "Data subscriber internals by service id"; }
+    DTO_FIELD(Fields<Object<ServiceInternalDto>>, dataSubscriberInternals) = {};
+
+    DTO_FIELD_INFO(rpcClients) { info->description = "Rpc clients by service id"; }
+    DTO_FIELD(Fields<Object<RpcClientDto>>, rpcClients) = {};
+
+    DTO_FIELD_INFO(rpcServers) { info->description = "Rpc servers by service id"; }
+    DTO_FIELD(Fields<Object<RpcServerDto>>, rpcServers) = {};
+
+    DTO_FIELD_INFO(rpcServerInternals) { info->description = "Rpc server internals by service id"; }
+    DTO_FIELD(Fields<Object<ServiceInternalDto>>, rpcServerInternals) = {};
+
+    DTO_FIELD_INFO(canNetworks) { info->description = "Names of the simulated CAN networks"; }
+    DTO_FIELD(List<String>, canNetworks) = {};
+
+    DTO_FIELD_INFO(ethernetNetworks) { info->description = "Names of the simulated Ethernet networks"; }
+    DTO_FIELD(List<String>, ethernetNetworks) = {};
+
+    DTO_FIELD_INFO(flexrayNetworks) { info->description = "Names of the simulated FlexRay networks"; }
+    DTO_FIELD(List<String>, flexrayNetworks) = {};
+
+    DTO_FIELD_INFO(linNetworks) { info->description = "Names of the simulated LIN networks"; }
+    DTO_FIELD(List<String>, linNetworks) = {};
+};
+
+// All updates of one dequeued event batch, grouped by participant
+class BulkSimulationDto : public oatpp::DTO
+{
+    DTO_INIT(BulkSimulationDto, DTO)
+
+    DTO_FIELD_INFO(participants) { info->description = "Connected participants and their updates"; }
+    DTO_FIELD(List<Object<BulkParticipantDto>>, participants) = {};
+
+    DTO_FIELD_INFO(systemStatuses) { info->description = "System statuses in order of occurrence"; }
+    DTO_FIELD(List<Object<SystemStatusDto>>, systemStatuses) = {};
+};
+
+} // namespace Dashboard
+} // namespace SilKit
+
+#include OATPP_CODEGEN_END(DTO)
@@ -37,6 +37,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "oatpp/web/protocol/http/Http.hpp"
 #include "oatpp/web/server/api/ApiController.hpp"
 
+#include "BulkSimulationDto.hpp"
 #include "DataPublisherDto.hpp"
 #include "DataSubscriberDto.hpp"
 #include "ParticipantStatusDto.hpp"
@@ -84,6 +85,9 @@ private:
     std::promise<void> _allSimulationsFinishedPromise;
     std::future<void> _allSimulationsFinishedFuture;
     std::future_status _allSimulationsFinishedStatus;
+    uint64_t _eventCount{0};
+    std::chrono::steady_clock::time_point _firstEventTime;
+    std::chrono::steady_clock::time_point _lastEventTime;
 
 public:
     static std::shared_ptr<DashboardSystemApiController> createShared(
@@ -104,6 +108,7 @@ public:
         auto body = SilKit::Dashboard::SimulationCreationResponseDto::createShared();
         body->id = ++_simulationId;
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[body->id] = {};
         return createDtoResponse(Status::CODE_201, body);
     }
@@ -114,6 +119,7 @@ public:
         std::this_thread::sleep_for(_updateTimeout);
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].participants.insert(participantName);
         return createResponse(Status::CODE_204, "");
     }
@@ -126,6 +132,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(participantStatus, Status::CODE_400, "participantStatus not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].statesByParticipant[participantName].insert(
             oatpp::Enum<ParticipantState>::getEntryByValue(participantStatus->state).name.toString());
         return createResponse(Status::CODE_204, "");
@@ -140,6 +147,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(canController, Status::CODE_400, "canController not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].servicesByParticipant[participantName].insert(std::pair<uint64_t, Service>(
             serviceId, {"", "cancontroller", canController->name, canController->networkName, {}}));
         return createResponse(Status::CODE_204, "");
@@ -155,6 +163,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(ethernetController, Status::CODE_400, "ethernetController not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].servicesByParticipant[participantName].insert(std::pair<uint64_t, Service>(
             serviceId, {"", "ethernetcontroller", ethernetController->name, ethernetController->networkName, {}}));
         return createResponse(Status::CODE_204, "");
@@ -170,6 +179,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(flexrayController, Status::CODE_400, "flexrayController not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].servicesByParticipant[participantName].insert(std::pair<uint64_t, Service>(
             serviceId, {"", "flexraycontroller", flexrayController->name, flexrayController->networkName, {}}));
         return createResponse(Status::CODE_204, "");
@@ -184,6 +194,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(linController, Status::CODE_400, "linController not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].servicesByParticipant[participantName].insert(std::pair<uint64_t, Service>(
             serviceId, {"", "lincontroller", linController->name, linController->networkName, {}}));
         return createResponse(Status::CODE_204, "");
@@ -198,6 +209,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(dataPublisher, Status::CODE_400, "dataPublisher not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].servicesByParticipant[participantName].insert(
             std::pair<uint64_t, Service>(serviceId, {"",
                                                      "datapublisher",
@@ -218,6 +230,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(dataSubscriber, Status::CODE_400, "dataSubscriber not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].servicesByParticipant[participantName].insert(
             std::pair<uint64_t, Service>(serviceId, {"",
                                                      "datasubscriber",
@@ -239,6 +252,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(dataSubscriberInternal, Status::CODE_400, "dataSubscriberInternal not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].servicesByParticipant[participantName].insert(
             std::pair<uint64_t, Service>(serviceId, {parentServiceId,
                                                      "datasubscriberinternal",
@@ -257,6 +271,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(rpcClient, Status::CODE_400, "rpcClient not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].servicesByParticipant[participantName].insert(std::pair<uint64_t, Service>(
             serviceId,
             {"",
@@ -276,6 +291,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(rpcServer, Status::CODE_400, "rpcServer not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].servicesByParticipant[participantName].insert(std::pair<uint64_t, Service>(
             serviceId,
             {"",
@@ -297,6 +313,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(rpcServerInternal, Status::CODE_400, "rpcServerInternal not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].servicesByParticipant[participantName].insert(std::pair<uint64_t, Service>(
             serviceId,
             {parentServiceId, "rpcserverinternal", rpcServerInternal->name, rpcServerInternal->networkName, {}}));
@@ -311,6 +328,7 @@ public:
         std::this_thread::sleep_for(_updateTimeout);
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].linksByParticipant[participantName].insert({"can", networkName});
         return createResponse(Status::CODE_204, "");
     }
@@ -324,6 +342,7 @@ public:
         std::this_thread::sleep_for(_updateTimeout);
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].linksByParticipant[participantName].insert({"ethernet", networkName});
         return createResponse(Status::CODE_204, "");
     }
@@ -337,6 +356,7 @@ public:
         std::this_thread::sleep_for(_updateTimeout);
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].linksByParticipant[participantName].insert({"flexray", networkName});
         return createResponse(Status::CODE_204, "");
     }
@@ -349,6 +369,7 @@ public:
         std::this_thread::sleep_for(_updateTimeout);
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].linksByParticipant[participantName].insert({"lin", networkName});
         return createResponse(Status::CODE_204, "");
     }
@@ -360,11 +381,101 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(systemStatus, Status::CODE_400, "systemStatus not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].systemStates.insert(
             oatpp::Enum<SystemState>::getEntryByValue(systemStatus->state).name.toString());
         return createResponse(Status::CODE_204, "");
     }
 
+    ENDPOINT("POST", "system-service/v1.0/simulations/{simulationId}/bulk", addBulkUpdateToSimulation,
+             PATH(UInt64, simulationId), BODY_DTO(Object<SilKit::Dashboard::BulkSimulationDto>, bulkSimulation))
+    {
+        std::this_thread::sleep_for(_updateTimeout);
+        OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
+        OATPP_ASSERT_HTTP(bulkSimulation, Status::CODE_400, "bulkSimulation not set");
+        std::unique_lock<decltype(_mutex)> lock(_mutex);
+        auto& simulation = _data[simulationId];
+        uint64_t eventCount = bulkSimulation->systemStatuses->size();
+        for (auto& systemStatus : *bulkSimulation->systemStatuses)
+        {
+            simulation.systemStates.insert(
+                oatpp::Enum<SystemState>::getEntryByValue(systemStatus->state).name.toString());
+        }
+        for (auto& participant : *bulkSimulation->participants)
+        {
+            const std::string participantName = participant->name;
+            simulation.participants.insert(participantName);
+            for (auto& participantStatus : *participant->statuses)
+            {
+                simulation.statesByParticipant[participantName].insert(
+                    oatpp::Enum<ParticipantState>::getEntryByValue(participantStatus->state).name.toString());
+            }
+            auto& services = simulation.servicesByParticipant[participantName];
+            eventCount += 1 + participant->statuses->size();
+            eventCount += AddServices(services, participant->canControllers, [](const Object<ServiceDto>& dto) {
+                return Service{"", "cancontroller", dto->name, dto->networkName, {}};
+            });
+            eventCount += AddServices(services, participant->ethernetControllers, [](const Object<ServiceDto>& dto) {
+                return Service{"", "ethernetcontroller", dto->name, dto->networkName, {}};
+            });
+            eventCount += AddServices(services, participant->flexrayControllers, [](const Object<ServiceDto>& dto) {
+                return Service{"", "flexraycontroller", dto->name, dto->networkName, {}};
+            });
+            eventCount += AddServices(services, participant->linControllers, [](const Object<ServiceDto>& dto) {
+                return Service{"", "lincontroller", dto->name, dto->networkName, {}};
+            });
+            eventCount +=
+                AddServices(services, participant->dataPublishers, [this](const Object<DataPublisherDto>& dto) {
+                    return Service{"",
+                                   "datapublisher",
+                                   dto->name,
+                                   dto->networkName,
+                                   {dto->spec->topic, "", dto->spec->mediaType, GetLabels(dto->spec->labels)}};
+                });
+            eventCount +=
+                AddServices(services, participant->dataSubscribers, [this](const Object<DataSubscriberDto>& dto) {
+                    return Service{"",
+                                   "datasubscriber",
+                                   dto->name,
+                                   "",
+                                   {dto->spec->topic, "", dto->spec->mediaType, GetLabels(dto->spec->labels)}};
+                });
+            eventCount += AddServices(services, participant->dataSubscriberInternals,
+                                      [](const Object<ServiceInternalDto>& dto) {
+                                          return Service{dto->parentServiceId,
+                                                         "datasubscriberinternal",
+                                                         dto->name,
+                                                         dto->networkName,
+                                                         {}};
+                                      });
+            eventCount += AddServices(services, participant->rpcClients, [this](const Object<RpcClientDto>& dto) {
+                return Service{"",
+                               "rpcclient",
+                               dto->name,
+                               dto->networkName,
+                               {"", dto->spec->functionName, dto->spec->mediaType, GetLabels(dto->spec->labels)}};
+            });
+            eventCount += AddServices(services, participant->rpcServers, [this](const Object<RpcServerDto>& dto) {
+                return Service{"",
+                               "rpcserver",
+                               dto->name,
+                               "",
+                               {"", dto->spec->functionName, dto->spec->mediaType, GetLabels(dto->spec->labels)}};
+            });
+            eventCount +=
+                AddServices(services, participant->rpcServerInternals, [](const Object<ServiceInternalDto>& dto) {
+                    return Service{dto->parentServiceId, "rpcserverinternal", dto->name, dto->networkName, {}};
+                });
+            auto& links = simulation.linksByParticipant[participantName];
+            eventCount += AddLinks(links, "can", participant->canNetworks);
+            eventCount += AddLinks(links, "ethernet", participant->ethernetNetworks);
+            eventCount += AddLinks(links, "flexray", participant->flexrayNetworks);
+            eventCount += AddLinks(links, "lin", participant->linNetworks);
+        }
+        CountEvents(eventCount);
+        return createResponse(Status::CODE_204, "");
+    }
+
     ENDPOINT("POST", "system-service/v1.0/simulations/{simulationId}", setSimulationEnd, PATH(UInt64, simulationId),
              BODY_DTO(Object<SilKit::Dashboard::SimulationEndDto>, simulation))
     {
@@ -372,6 +483,7 @@ public:
         OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
         OATPP_ASSERT_HTTP(simulation, Status::CODE_400, "simulation not set");
         std::unique_lock<decltype(_mutex)> lock(_mutex);
+        CountEvents(1);
         _data[simulationId].stopped = true;
         if (CountFinishedSimulations() == _expectedSimulationsCount)
         {
@@ -401,7 +513,53 @@ public:
         return _allSimulationsFinishedStatus == std::future_status::ready; 
     }
 
+    uint64_t GetEventCount()
+    {
+        std::unique_lock<decltype(_mutex)> lock(_mutex);
+        return _eventCount;
+    }
+
+    // events received per second between the first and the last handled request
+    double GetEventsPerSecond()
+    {
+        std::unique_lock<decltype(_mutex)> lock(_mutex);
+        const auto duration = std::chrono::duration<double>(_lastEventTime - _firstEventTime).count();
+        return duration > 0.0 ? _eventCount / duration : 0.0;
+    }
+
 private:
+    // must be called with _mutex held
+    void CountEvents(uint64_t count)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (_eventCount == 0)
+        {
+            _firstEventTime = now;
+        }
+        _lastEventTime = now;
+        _eventCount += count;
+    }
+
+    template <typename DtosByServiceId, typename CreateService>
+    uint64_t AddServices(std::map<uint64_t, Service>& services, const DtosByServiceId& dtosByServiceId,
+                         CreateService createService)
+    {
+        for (auto& entry : *dtosByServiceId)
+        {
+            services.insert(std::pair<uint64_t, Service>(std::stoull(*entry.first), createService(entry.second)));
+        }
+        return dtosByServiceId->size();
+    }
+
+    uint64_t AddLinks(std::set<Link>& links, const std::string& type, const oatpp::List<oatpp::String>& networkNames)
+    {
+        for (auto& networkName : *networkNames)
+        {
+            links.insert({type, networkName});
+        }
+        return networkNames->size();
+    }
+
     std::vector<SilKit::Services::MatchingLabel> GetLabels(oatpp::Vector<Object<MatchingLabelDto>> labels)
     {
         std::vector<SilKit::Services::MatchingLabel> res;
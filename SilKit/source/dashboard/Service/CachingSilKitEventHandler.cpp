@@ -47,6 +47,15 @@ CachingSilKitEventHandler::CachingSilKitEventHandler(const std::string& connectU
         SilKit::Util::SetThreadName("SK-Dash-Cons");
         uint64_t simulationId = 0;
         std::vector<SilKitEvent> events;
+        // updates between simulation start and end are sent as one bulk update per dequeued batch
+        std::vector<SilKitEvent> updates;
+        auto flushUpdates = [this, &simulationId, &updates]() {
+            if (simulationId > 0 && !updates.empty())
+            {
+                _eventHandler->OnBulkUpdate(simulationId, updates);
+            }
+            updates.clear();
+        };
         while (_eventQueue->DequeueAllInto(events))
         {
             for (SilKitEvent& evt : events)
@@ -59,47 +68,24 @@ CachingSilKitEventHandler::CachingSilKitEventHandler(const std::string& connectU
                 {
                 case SilKitEventType::OnSimulationStart:
                 {
+                    flushUpdates();
                     const SimulationStart& simulationStart = evt.GetSimulationStart();
                     simulationId = _eventHandler->OnSimulationStart(simulationStart.connectUri, simulationStart.time);
                 }
                 break;
 
                 case SilKitEventType::OnParticipantConnected:
-                    if (simulationId > 0)
-                    {
-                        const Services::Orchestration::ParticipantConnectionInformation&
-                            participantConnectionInformation = evt.GetParticipantConnectionInformation();
-                        _eventHandler->OnParticipantConnected(simulationId, participantConnectionInformation);
-                    }
-                    break;
-
                 case SilKitEventType::OnSystemStateChanged:
-                    if (simulationId > 0)
-                    {
-                        const Services::Orchestration::SystemState& systemState = evt.GetSystemState();
-                        _eventHandler->OnSystemStateChanged(simulationId, systemState);
-                    }
-                    break;
-
                 case SilKitEventType::OnParticipantStatusChanged:
-                    if (simulationId > 0)
-                    {
-                        const Services::Orchestration::ParticipantStatus& participantStatus =
-                            evt.GetParticipantStatus();
-                        _eventHandler->OnParticipantStatusChanged(simulationId, participantStatus);
-                    }
-                    break;
-
                 case SilKitEventType::OnServiceDiscoveryEvent:
                     if (simulationId > 0)
                     {
-                        const ServiceData& serviceData = evt.GetServiceData();
-                        _eventHandler->OnServiceDiscoveryEvent(simulationId, serviceData.discoveryType,
-                                                               serviceData.serviceDescriptor);
+                        updates.push_back(std::move(evt));
                     }
                     break;
 
                 case SilKitEventType::OnSimulationEnd:
+                    flushUpdates();
                     if (simulationId > 0)
                     {
                         const SimulationEnd& simulationEnd = evt.GetSimulationEnd();
@@ -110,6 +96,7 @@ CachingSilKitEventHandler::CachingSilKitEventHandler(const std::string& connectU
                 default: _logger->Error("Dashboard: unexpected SilKitEventType");
                 }
             }
+            flushUpdates();
             events.clear();
         }
     });
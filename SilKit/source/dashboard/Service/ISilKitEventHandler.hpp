@@ -21,9 +21,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <vector>
+
 #include "silkit/services/orchestration/OrchestrationDatatypes.hpp"
 #include "ServiceDatatypes.hpp"
 
+#include "SilKitEvent.hpp"
+
 namespace SilKit {
 namespace Dashboard {
 class ISilKitEventHandler
@@ -41,6 +45,7 @@ public:
     virtual void OnServiceDiscoveryEvent(uint64_t simulationId,
                                          Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
                                          const Core::ServiceDescriptor& serviceDescriptor) = 0;
+    virtual void OnBulkUpdate(uint64_t simulationId, const std::vector<SilKitEvent>& events) = 0;
 };
 } // namespace Dashboard
 } // namespace SilKit
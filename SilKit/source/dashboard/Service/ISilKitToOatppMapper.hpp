@@ -22,11 +22,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include "oatpp/core/Types.hpp"
 
 #include "silkit/services/orchestration/OrchestrationDatatypes.hpp"
 
+#include "BulkSimulationDto.hpp"
 #include "DataPublisherDto.hpp"
 #include "DataSubscriberDto.hpp"
 #include "ParticipantStatusDto.hpp"
@@ -34,6 +36,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "RpcServerDto.hpp"
 #include "ServiceDescriptor.hpp"
 #include "ServiceDto.hpp"
+#include "SilKitEvent.hpp"
 #include "SimulationCreationRequestDto.hpp"
 #include "SimulationEndDto.hpp"
 #include "SystemStatusDto.hpp"
@@ -55,6 +58,7 @@ public:
     virtual oatpp::Object<RpcClientDto> CreateRpcClientDto(const Core::ServiceDescriptor& serviceDescriptor) = 0;
     virtual oatpp::Object<RpcServerDto> CreateRpcServerDto(const Core::ServiceDescriptor& serviceDescriptor) = 0;
     virtual oatpp::Object<SimulationEndDto> CreateSimulationEndDto(uint64_t stop) = 0;
+    virtual oatpp::Object<BulkSimulationDto> CreateBulkSimulationDto(const std::vector<SilKitEvent>& events) = 0;
 };
 } // namespace Dashboard
 } // namespace SilKit
@@ -42,6 +42,8 @@ public:
     MOCK_METHOD(oatpp::Object<SilKit::Dashboard::RpcServerDto>, CreateRpcServerDto,
                 (const SilKit::Core::ServiceDescriptor&), (override));
     MOCK_METHOD(oatpp::Object<SimulationEndDto>, CreateSimulationEndDto, (uint64_t), (override));
+    MOCK_METHOD(oatpp::Object<BulkSimulationDto>, CreateBulkSimulationDto, (const std::vector<SilKitEvent>&),
+                (override));
 };
 } // namespace Dashboard
 } // namespace SilKit
\ No newline at end of file
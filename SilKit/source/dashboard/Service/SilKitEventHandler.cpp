@@ -101,6 +101,48 @@ void SilKitEventHandler::OnServiceDiscoveryEvent(uint64_t simulationId,
     }
 }
 
+void SilKitEventHandler::OnBulkUpdate(uint64_t simulationId, const std::vector<SilKitEvent>& events)
+{
+    if (_bulkUpdateSupported)
+    {
+        Services::Logging::Debug(_logger, "Dashboard: adding bulk update for simulation {} with {} events",
+                                 simulationId, events.size());
+        switch (_dashboardSystemServiceClient->AddBulkUpdateToSimulation(
+            simulationId, _silKitToOatppMapper->CreateBulkSimulationDto(events)))
+        {
+        case BulkUpdateResult::Ok: return;
+        case BulkUpdateResult::Unsupported:
+            _logger->Info("Dashboard: bulk updates are not supported by the server, sending single updates");
+            _bulkUpdateSupported = false;
+            break;
+        case BulkUpdateResult::Failed:
+            // the next batch tries the bulk update again
+            _logger->Warn("Dashboard: bulk update failed, sending single updates");
+            break;
+        }
+    }
+    for (const auto& evt : events)
+    {
+        switch (evt.Type())
+        {
+        case SilKitEventType::OnParticipantConnected:
+            OnParticipantConnected(simulationId, evt.GetParticipantConnectionInformation());
+            break;
+        case SilKitEventType::OnSystemStateChanged: OnSystemStateChanged(simulationId, evt.GetSystemState()); break;
+        case SilKitEventType::OnParticipantStatusChanged:
+            OnParticipantStatusChanged(simulationId, evt.GetParticipantStatus());
+            break;
+        case SilKitEventType::OnServiceDiscoveryEvent:
+        {
+            const ServiceData& serviceData = evt.GetServiceData();
+            OnServiceDiscoveryEvent(simulationId, serviceData.discoveryType, serviceData.serviceDescriptor);
+        }
+        break;
+        default: _logger->Error("Dashboard: unexpected SilKitEventType in bulk update");
+        }
+    }
+}
+
 void SilKitEventHandler::OnControllerCreated(uint64_t simulationId, const Core::ServiceDescriptor& serviceDescriptor)
 {
     Services::Logging::Debug(_logger, "Dashboard: adding service for simulation {} {}", simulationId,
@@ -52,6 +52,7 @@ public: //methods
     void OnSystemStateChanged(uint64_t simulationId, Services::Orchestration::SystemState systemState) override;
     void OnServiceDiscoveryEvent(uint64_t simulationId, Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
                                  const Core::ServiceDescriptor& serviceDescriptor) override;
+    void OnBulkUpdate(uint64_t simulationId, const std::vector<SilKitEvent>& events) override;
 
 private: //methods
     void OnControllerCreated(uint64_t simulationId, const Core::ServiceDescriptor& serviceDescriptor);
@@ -61,6 +62,7 @@ private: //member
     Services::Logging::ILogger* _logger;
     std::shared_ptr<IDashboardSystemServiceClient> _dashboardSystemServiceClient;
     std::shared_ptr<ISilKitToOatppMapper> _silKitToOatppMapper;
+    bool _bulkUpdateSupported{true};
 };
 
 } // namespace Dashboard
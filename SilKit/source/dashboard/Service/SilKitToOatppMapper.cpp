@@ -21,6 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "SilKitToOatppMapper.hpp"
 
+#include <map>
+#include <string>
+
 #include "YamlParser.hpp"
 
 namespace SilKit {
@@ -236,5 +239,142 @@ oatpp::Object<SimulationEndDto> SilKitToOatppMapper::CreateSimulationEndDto(uint
     return simulationEnd;
 }
 
+oatpp::Object<ServiceInternalDto> CreateServiceInternalDto(const Core::ServiceDescriptor& serviceDescriptor,
+                                                           const std::string& parentServiceIdKey)
+{
+    auto serviceInternal = ServiceInternalDto::createShared();
+    serviceInternal->name = serviceDescriptor.GetServiceName();
+    serviceInternal->networkName = serviceDescriptor.GetNetworkName();
+    serviceInternal->parentServiceId = GetSupplementalDataValue(serviceDescriptor, parentServiceIdKey);
+    return serviceInternal;
+}
+
+void SilKitToOatppMapper::AddController(const oatpp::Object<BulkParticipantDto>& participant,
+                                        const Core::ServiceDescriptor& serviceDescriptor)
+{
+    std::string controllerType;
+    if (!serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, controllerType))
+    {
+        throw SilKitError{"Missing key " + Core::Discovery::controllerType + " in supplementalData"};
+    }
+    const oatpp::String serviceId = std::to_string(serviceDescriptor.GetServiceId());
+    if (controllerType == Core::Discovery::controllerTypeCan)
+    {
+        participant->canControllers->push_back({serviceId, CreateServiceDto(serviceDescriptor)});
+    }
+    else if (controllerType == Core::Discovery::controllerTypeEthernet)
+    {
+        participant->ethernetControllers->push_back({serviceId, CreateServiceDto(serviceDescriptor)});
+    }
+    else if (controllerType == Core::Discovery::controllerTypeFlexray)
+    {
+        participant->flexrayControllers->push_back({serviceId, CreateServiceDto(serviceDescriptor)});
+    }
+    else if (controllerType == Core::Discovery::controllerTypeLin)
+    {
+        participant->linControllers->push_back({serviceId, CreateServiceDto(serviceDescriptor)});
+    }
+    else if (controllerType == Core::Discovery::controllerTypeDataPublisher)
+    {
+        participant->dataPublishers->push_back({serviceId, CreateDataPublisherDto(serviceDescriptor)});
+    }
+    else if (controllerType == Core::Discovery::controllerTypeDataSubscriber)
+    {
+        participant->dataSubscribers->push_back({serviceId, CreateDataSubscriberDto(serviceDescriptor)});
+    }
+    else if (controllerType == Core::Discovery::controllerTypeDataSubscriberInternal)
+    {
+        participant->dataSubscriberInternals->push_back(
+            {serviceId, CreateServiceInternalDto(serviceDescriptor,
+                                                 Core::Discovery::supplKeyDataSubscriberInternalParentServiceID)});
+    }
+    else if (controllerType == Core::Discovery::controllerTypeRpcClient)
+    {
+        participant->rpcClients->push_back({serviceId, CreateRpcClientDto(serviceDescriptor)});
+    }
+    else if (controllerType == Core::Discovery::controllerTypeRpcServer)
+    {
+        participant->rpcServers->push_back({serviceId, CreateRpcServerDto(serviceDescriptor)});
+    }
+    else if (controllerType == Core::Discovery::controllerTypeRpcServerInternal)
+    {
+        participant->rpcServerInternals->push_back(
+            {serviceId, CreateServiceInternalDto(serviceDescriptor,
+                                                 Core::Discovery::supplKeyRpcServerInternalParentServiceID)});
+    }
+}
+
+void SilKitToOatppMapper::AddLink(const oatpp::Object<BulkParticipantDto>& participant,
+                                  const Core::ServiceDescriptor& serviceDescriptor)
+{
+    switch (serviceDescriptor.GetNetworkType())
+    {
+    case Config::NetworkType::CAN: participant->canNetworks->push_back(serviceDescriptor.GetNetworkName()); break;
+    case Config::NetworkType::Ethernet:
+        participant->ethernetNetworks->push_back(serviceDescriptor.GetNetworkName());
+        break;
+    case Config::NetworkType::FlexRay:
+        participant->flexrayNetworks->push_back(serviceDescriptor.GetNetworkName());
+        break;
+    case Config::NetworkType::LIN: participant->linNetworks->push_back(serviceDescriptor.GetNetworkName()); break;
+    default: break;
+    }
+}
+
+oatpp::Object<BulkSimulationDto> SilKitToOatppMapper::CreateBulkSimulationDto(const std::vector<SilKitEvent>& events)
+{
+    auto bulkSimulation = BulkSimulationDto::createShared();
+    std::map<std::string, oatpp::Object<BulkParticipantDto>> participantsByName;
+    auto getParticipant = [&bulkSimulation, &participantsByName](const std::string& participantName) {
+        auto it = participantsByName.find(participantName);
+        if (it != participantsByName.end())
+        {
+            return it->second;
+        }
+        auto participant = BulkParticipantDto::createShared();
+        participant->name = participantName;
+        bulkSimulation->participants->push_back(participant);
+        participantsByName.emplace(participantName, participant);
+        return participant;
+    };
+
+    for (const auto& evt : events)
+    {
+        switch (evt.Type())
+        {
+        case SilKitEventType::OnParticipantConnected:
+            getParticipant(evt.GetParticipantConnectionInformation().participantName);
+            break;
+        case SilKitEventType::OnParticipantStatusChanged:
+        {
+            const auto& participantStatus = evt.GetParticipantStatus();
+            getParticipant(participantStatus.participantName)
+                ->statuses->push_back(CreateParticipantStatusDto(participantStatus));
+        }
+        break;
+        case SilKitEventType::OnSystemStateChanged:
+            bulkSimulation->systemStatuses->push_back(CreateSystemStatusDto(evt.GetSystemState()));
+            break;
+        case SilKitEventType::OnServiceDiscoveryEvent:
+        {
+            const auto& serviceDescriptor = evt.GetServiceData().serviceDescriptor;
+            switch (serviceDescriptor.GetServiceType())
+            {
+            case Core::ServiceType::Controller:
+                AddController(getParticipant(serviceDescriptor.GetParticipantName()), serviceDescriptor);
+                break;
+            case Core::ServiceType::Link:
+                AddLink(getParticipant(serviceDescriptor.GetParticipantName()), serviceDescriptor);
+                break;
+            default: break;
+            }
+        }
+        break;
+        default: throw SilKitError{"Unexpected event in bulk update"};
+        }
+    }
+    return bulkSimulation;
+}
+
 } // namespace Dashboard
 } // namespace SilKit
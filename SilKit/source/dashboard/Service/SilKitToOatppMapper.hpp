@@ -39,6 +39,13 @@ public:
     oatpp::Object<RpcClientDto> CreateRpcClientDto(const Core::ServiceDescriptor& serviceDescriptor) override;
     oatpp::Object<RpcServerDto> CreateRpcServerDto(const Core::ServiceDescriptor& serviceDescriptor) override;
     oatpp::Object<SimulationEndDto> CreateSimulationEndDto(uint64_t stop) override;
+    oatpp::Object<BulkSimulationDto> CreateBulkSimulationDto(const std::vector<SilKitEvent>& events) override;
+
+private:
+    void AddController(const oatpp::Object<BulkParticipantDto>& participant,
+                       const Core::ServiceDescriptor& serviceDescriptor);
+    void AddLink(const oatpp::Object<BulkParticipantDto>& participant,
+                 const Core::ServiceDescriptor& serviceDescriptor);
 };
 
 } // namespace Dashboard
@@ -178,9 +178,10 @@ TEST_F(TestDashboardCachingSilKitEventHandler, OnParticipantConnected_CreateSimu
                         Return(_simulationId)));
     uint64_t actualSimulationId = 0;
     Services::Orchestration::ParticipantConnectionInformation actualInfo;
-    EXPECT_CALL(*_mockEventHandler, OnParticipantConnected).WillOnce(WithArgs<0, 1>([&](auto simulationId, auto info) {
+    EXPECT_CALL(*_mockEventHandler, OnBulkUpdate).WillOnce(WithArgs<0, 1>([&](auto simulationId, const auto& evts) {
         actualSimulationId = simulationId;
-        actualInfo = info;
+        ASSERT_EQ(evts.size(), 1u);
+        actualInfo = evts[0].GetParticipantConnectionInformation();
     }));
     EXPECT_CALL(*_mockEventQueue, Stop);
 
@@ -199,6 +200,43 @@ TEST_F(TestDashboardCachingSilKitEventHandler, OnParticipantConnected_CreateSimu
     ASSERT_EQ(actualInfo, participantConnectionInformation) << "Wrong ParticipantConnectionInformation!";
 }
 
+TEST_F(TestDashboardCachingSilKitEventHandler, DequeuedBatch_SendsOneBulkUpdateBeforeSimulationEnd)
+{
+    // Arrange
+    Services::Orchestration::ParticipantConnectionInformation participantConnectionInformation;
+    Services::Orchestration::ParticipantStatus participantStatus;
+    EXPECT_CALL(*_mockEventQueue, DequeueAllInto)
+        .WillOnce(DoAll(WithArgs<0>([&](auto& evts) {
+                            std::vector<SilKitEvent> events;
+                            events.emplace_back(SimulationStart{"silkit://localhost:8500", 123456});
+                            events.emplace_back(participantConnectionInformation);
+                            events.emplace_back(participantStatus);
+                            events.emplace_back(Services::Orchestration::SystemState::Running);
+                            events.emplace_back(SimulationEnd{456789});
+                            events.emplace_back(participantStatus);
+                            evts.swap(events);
+                        }),
+                        Return(true)))
+        .WillOnce(DoAll(WithArgs<0>([&](auto& evts) {
+                            evts.clear();
+                        }),
+                        Return(false)));
+    {
+        InSequence seq;
+        EXPECT_CALL(*_mockEventHandler, OnSimulationStart).WillOnce(Return(_simulationId));
+        EXPECT_CALL(*_mockEventHandler, OnBulkUpdate(_simulationId, SizeIs(3)));
+        EXPECT_CALL(*_mockEventHandler, OnSimulationEnd(_simulationId, 456789));
+    }
+    EXPECT_CALL(*_mockEventQueue, Stop);
+
+    // Act
+    {
+        const auto service = CreateService();
+    }
+
+    // Assert
+}
+
 TEST_F(TestDashboardCachingSilKitEventHandler, OnLastParticipantDisconnected_CreateSimulationSuccess)
 {
     // Arrange
@@ -693,5 +693,73 @@ TEST_F(TestDashboardSilKitEventHandler, OnServiceDiscoveryEvent_Invalid_Ignore)
                                      descriptor);
 }
 
+TEST_F(TestDashboardSilKitEventHandler, OnBulkUpdate_BulkUpdateRequestSent)
+{
+    // Arrange
+    const oatpp::UInt64 expectedSimulationId = 123;
+    const auto service = CreateService();
+    std::vector<SilKitEvent> events;
+    events.emplace_back(Services::Orchestration::ParticipantConnectionInformation{"my Participant"});
+    events.emplace_back(Services::Orchestration::SystemState::Running);
+    auto bulkSimulation = BulkSimulationDto::createShared();
+    EXPECT_CALL(*_mockSilKitToOatppMapper, CreateBulkSimulationDto(SizeIs(2))).WillOnce(Return(bulkSimulation));
+    EXPECT_CALL(*_mockDashboardSystemServiceClient, AddBulkUpdateToSimulation(expectedSimulationId, bulkSimulation))
+        .WillOnce(Return(BulkUpdateResult::Ok));
+
+    // Act
+    service->OnBulkUpdate(expectedSimulationId, events);
+
+    // Assert
+}
+
+TEST_F(TestDashboardSilKitEventHandler, OnBulkUpdate_BulkUpdateNotSupported_SingleRequestsSent)
+{
+    // Arrange
+    const oatpp::UInt64 expectedSimulationId = 123;
+    const auto service = CreateService();
+    std::vector<SilKitEvent> events;
+    events.emplace_back(Services::Orchestration::ParticipantConnectionInformation{"my Participant"});
+    events.emplace_back(Services::Orchestration::SystemState::Running);
+    auto bulkSimulation = BulkSimulationDto::createShared();
+    auto systemStatus = SystemStatusDto::createShared();
+    EXPECT_CALL(*_mockSilKitToOatppMapper, CreateBulkSimulationDto).WillOnce(Return(bulkSimulation));
+    EXPECT_CALL(*_mockDashboardSystemServiceClient, AddBulkUpdateToSimulation)
+        .WillOnce(Return(BulkUpdateResult::Unsupported));
+    EXPECT_CALL(*_mockDashboardSystemServiceClient, AddParticipantToSimulation(expectedSimulationId, _)).Times(2);
+    EXPECT_CALL(*_mockSilKitToOatppMapper, CreateSystemStatusDto(Services::Orchestration::SystemState::Running))
+        .Times(2)
+        .WillRepeatedly(Return(systemStatus));
+    EXPECT_CALL(*_mockDashboardSystemServiceClient, UpdateSystemStatusForSimulation(expectedSimulationId, systemStatus))
+        .Times(2);
+
+    // Act
+    service->OnBulkUpdate(expectedSimulationId, events);
+    service->OnBulkUpdate(expectedSimulationId, events);
+
+    // Assert
+}
+
+TEST_F(TestDashboardSilKitEventHandler, OnBulkUpdate_BulkUpdateFailed_SingleRequestsSentForThisBatch)
+{
+    // Arrange
+    const oatpp::UInt64 expectedSimulationId = 123;
+    const auto service = CreateService();
+    std::vector<SilKitEvent> events;
+    events.emplace_back(Services::Orchestration::ParticipantConnectionInformation{"my Participant"});
+    auto bulkSimulation = BulkSimulationDto::createShared();
+    EXPECT_CALL(*_mockSilKitToOatppMapper, CreateBulkSimulationDto).Times(2).WillRepeatedly(Return(bulkSimulation));
+    EXPECT_CALL(*_mockDashboardSystemServiceClient, AddBulkUpdateToSimulation)
+        .WillOnce(Return(BulkUpdateResult::Failed))
+        .WillOnce(Return(BulkUpdateResult::Ok));
+    EXPECT_CALL(_dummyLogger, Warn("Dashboard: bulk update failed, sending single updates"));
+    EXPECT_CALL(*_mockDashboardSystemServiceClient, AddParticipantToSimulation(expectedSimulationId, _)).Times(1);
+
+    // Act
+    service->OnBulkUpdate(expectedSimulationId, events);
+    service->OnBulkUpdate(expectedSimulationId, events);
+
+    // Assert
+}
+
 } // namespace Dashboard
 } // namespace SilKit
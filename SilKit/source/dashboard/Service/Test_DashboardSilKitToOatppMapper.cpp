@@ -279,5 +279,54 @@ TEST_F(TestSilKitToOatppMapper, CreateSimulationEndDto)
     ASSERT_EQ(dto->stopped, expectedStopTime);
 }
 
+TEST_F(TestSilKitToOatppMapper, CreateBulkSimulationDto_GroupByParticipant)
+{
+    // Arrange
+    Services::Orchestration::ParticipantStatus participantStatus;
+    participantStatus.participantName = "P1";
+    participantStatus.state = Services::Orchestration::ParticipantState::Running;
+
+    Core::ServiceDescriptor controller;
+    controller.SetParticipantNameAndComputeId("P1");
+    controller.SetServiceType(Core::ServiceType::Controller);
+    controller.SetServiceId(5);
+    controller.SetServiceName("CanController1");
+    controller.SetNetworkName("CAN1");
+    controller.SetSupplementalDataItem(Core::Discovery::controllerType, Core::Discovery::controllerTypeCan);
+
+    Core::ServiceDescriptor link;
+    link.SetParticipantNameAndComputeId("P2");
+    link.SetServiceType(Core::ServiceType::Link);
+    link.SetNetworkType(Config::NetworkType::CAN);
+    link.SetNetworkName("CAN1");
+
+    std::vector<SilKitEvent> events;
+    events.emplace_back(Services::Orchestration::ParticipantConnectionInformation{"P1"});
+    events.emplace_back(participantStatus);
+    events.emplace_back(ServiceData{Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated, controller});
+    events.emplace_back(ServiceData{Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated, link});
+    events.emplace_back(Services::Orchestration::SystemState::Running);
+
+    // Act
+    const auto dataMapper = CreateService();
+    const auto dto = dataMapper->CreateBulkSimulationDto(events);
+
+    // Assert
+    ASSERT_EQ(dto->participants->size(), 2u);
+    const auto& p1 = dto->participants->front();
+    ASSERT_STREQ(p1->name->c_str(), "P1");
+    ASSERT_EQ(p1->statuses->size(), 1u);
+    ASSERT_EQ(p1->statuses->front()->state, ParticipantState::Running);
+    ASSERT_EQ(p1->canControllers->size(), 1u);
+    ASSERT_STREQ(p1->canControllers->front().first->c_str(), "5");
+    ASSERT_STREQ(p1->canControllers->front().second->name->c_str(), "CanController1");
+    const auto& p2 = dto->participants->back();
+    ASSERT_STREQ(p2->name->c_str(), "P2");
+    ASSERT_EQ(p2->canNetworks->size(), 1u);
+    ASSERT_STREQ(p2->canNetworks->front()->c_str(), "CAN1");
+    ASSERT_EQ(dto->systemStatuses->size(), 1u);
+    ASSERT_EQ(dto->systemStatuses->front()->state, SystemState::Running);
+}
+
 } // namespace Dashboard
 } // namespace SilKit
@@ -72,6 +72,8 @@ struct TestResult
     int64_t objectCount{-1};
     std::map<uint64_t, SimulationData> dataBySimulation;
     bool allSimulationsFinished{true};
+    uint64_t eventCount{0};
+    double eventsPerSecond{0.0};
 };
 
 } // namespace Dashboard
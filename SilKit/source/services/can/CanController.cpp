@@ -44,6 +44,16 @@ CanController::CanController(Core::IParticipantInternal* participant, SilKit::Co
 // Trivial or detailed
 //------------------------
 
+auto CanController::GetAcceptanceFilter() const -> Core::AcceptanceFilter
+{
+    Core::AcceptanceFilter acceptanceFilter;
+    for (auto&& filter : _config.acceptanceFilters)
+    {
+        acceptanceFilter.rules.push_back(Core::AcceptanceRule{filter.id, filter.mask});
+    }
+    return acceptanceFilter;
+}
+
 void CanController::RegisterServiceDiscovery()
 {
     Core::Discovery::IServiceDiscovery* disc = _participant->GetServiceDiscovery();
@@ -167,6 +177,16 @@ void CanController::SendFrame(const CanFrame& frame, void* userContext)
     SendMsg(wireCanFrameEvent);
 }
 
+void CanController::SendFrames(Util::Span<const CanFrame> frames, void* userContext)
+{
+    _participant->SendMsgBatch([this, frames, userContext]() {
+        for (const auto& frame : frames)
+        {
+            SendFrame(frame, userContext);
+        }
+    });
+}
+
 //------------------------
 // ReceiveMsg
 //------------------------
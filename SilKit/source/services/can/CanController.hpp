@@ -34,6 +34,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ITraceMessageSource.hpp"
 #include "IReplayDataController.hpp"
 #include "ParticipantConfiguration.hpp"
+#include "AcceptanceFilter.hpp"
 
 #include "SimBehavior.hpp"
 
@@ -83,6 +84,7 @@ public:
     void Sleep() override;
 
     void SendFrame(const CanFrame& msg, void* userContext = nullptr) override;
+    void SendFrames(Util::Span<const CanFrame> msgs, void* userContext = nullptr) override;
 
     HandlerId AddFrameHandler(FrameHandler handler,
                               DirectionMask directionMask = (DirectionMask)TransmitDirection::RX
@@ -121,6 +123,9 @@ public:
 
     void RegisterServiceDiscovery();
 
+    //! \brief Senders may skip frames which are rejected by the configured acceptance filters
+    auto GetAcceptanceFilter() const -> Core::AcceptanceFilter;
+
     // Expose the simulated/trivial mode for unit tests
     void SetDetailedBehavior(const Core::ServiceDescriptor& remoteServiceDescriptor);
     void SetTrivialBehavior();
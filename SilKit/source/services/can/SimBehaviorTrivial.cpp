@@ -36,7 +36,7 @@ SimBehaviorTrivial::SimBehaviorTrivial(Core::IParticipantInternal* participant,
                     Services::Orchestration::ITimeProvider* timeProvider)
     : _participant{participant}
     , _parentController{canController}
-    , _parentServiceEndpoint{dynamic_cast<Core::IServiceEndpoint*>(canController)}
+    , _parentServiceEndpoint{static_cast<Core::IServiceEndpoint*>(canController)}
     , _timeProvider{timeProvider}
 {
     (void)_parentController;
@@ -45,8 +45,7 @@ SimBehaviorTrivial::SimBehaviorTrivial(Core::IParticipantInternal* participant,
 template <typename MsgT>
 void SimBehaviorTrivial::ReceiveMsg(const MsgT& msg)
 {
-    auto receivingController = dynamic_cast<Core::IMessageReceiver<MsgT>*>(_parentController);
-    SILKIT_ASSERT(receivingController);
+    auto receivingController = static_cast<Core::IMessageReceiver<MsgT>*>(_parentController);
     receivingController->ReceiveMsg(_parentServiceEndpoint, msg);
 }
 
@@ -89,4 +89,25 @@ TEST(CanControllerConfigTest, create_controller_configured_with_network)
     EXPECT_EQ(serviceDescr.GetNetworkName(), expectedNetworkName);
 }
 
+TEST(CanControllerConfigTest, create_controller_with_acceptance_filters)
+{
+    auto&& config = PrepareParticipantConfiguration();
+    SilKit::Config::CanController controllerWithFilterCfg;
+    controllerWithFilterCfg.name = "ControllerWithFilter";
+    controllerWithFilterCfg.acceptanceFilters.push_back(SilKit::Config::CanAcceptanceFilter{0x100, 0x7F0});
+    config->canControllers.push_back(controllerWithFilterCfg);
+
+    auto participant = SilKit::Core::CreateNullConnectionParticipantImpl(config, "TestParticipant");
+
+    auto controller =
+        dynamic_cast<CanController*>(participant->CreateCanController("ControllerWithFilter", "TestNetwork"));
+    auto acceptanceFilter = controller->GetAcceptanceFilter();
+    EXPECT_TRUE(acceptanceFilter.Accepts(0x10F));
+    EXPECT_FALSE(acceptanceFilter.Accepts(0x110));
+
+    auto unfilteredController =
+        dynamic_cast<CanController*>(participant->CreateCanController("ControllerWithoutNetwork", "TestNetwork"));
+    EXPECT_TRUE(unfilteredController->GetAcceptanceFilter().AcceptsAll());
+}
+
 }  // anonymous namespace
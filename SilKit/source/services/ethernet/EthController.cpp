@@ -20,17 +20,64 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "EthController.hpp"
+
+#include <array>
+#include <cctype>
+
 #include "silkit/services/logging/ILogger.hpp"
 
 #include "IServiceDiscovery.hpp"
 #include "ServiceDatatypes.hpp"
 #include "Tracing.hpp"
+#include "AcceptanceKey.hpp"
 
 
 namespace SilKit {
 namespace Services {
 namespace Ethernet {
 
+namespace {
+auto ParseMacAddress(const std::string& mac) -> std::array<uint8_t, Core::EthernetMacAcceptanceKeySize>
+{
+    std::array<uint8_t, Core::EthernetMacAcceptanceKeySize> bytes{};
+    const auto isHexDigit = [](char c) { return std::isxdigit(static_cast<unsigned char>(c)) != 0; };
+    bool isValid = mac.size() == 3 * bytes.size() - 1;
+    for (std::size_t i = 0; isValid && i < bytes.size(); ++i)
+    {
+        const auto pos = 3 * i;
+        isValid = isHexDigit(mac[pos]) && isHexDigit(mac[pos + 1]) && (pos + 2 == mac.size() || mac[pos + 2] == ':');
+        if (isValid)
+        {
+            bytes[i] = static_cast<uint8_t>(std::stoul(mac.substr(pos, 2), nullptr, 16));
+        }
+    }
+    if (!isValid)
+    {
+        throw SilKit::ConfigurationError{"Invalid MAC address in AcceptedDestinationMacs: '" + mac
+                                         + "', expected the format 'xx:xx:xx:xx:xx:xx'"};
+    }
+    return bytes;
+}
+
+auto MakeAcceptanceFilter(const std::vector<std::string>& acceptedDestinationMacs) -> Core::AcceptanceFilter
+{
+    Core::AcceptanceFilter acceptanceFilter;
+    if (acceptedDestinationMacs.empty())
+    {
+        return acceptanceFilter;
+    }
+
+    constexpr uint64_t macMask = (uint64_t{1} << 48) - 1;
+    acceptanceFilter.rules.push_back(Core::MakeEthernetGroupMacAcceptanceRule());
+    for (auto&& mac : acceptedDestinationMacs)
+    {
+        const auto bytes = ParseMacAddress(mac);
+        acceptanceFilter.rules.push_back(Core::AcceptanceRule{Core::MakeEthernetMacAcceptanceKey(bytes.data()), macMask});
+    }
+    return acceptanceFilter;
+}
+} // namespace
+
 EthController::EthController(Core::IParticipantInternal* participant, Config::EthernetController config,
                                Services::Orchestration::ITimeProvider* timeProvider)
     : _participant(participant)
@@ -38,6 +85,7 @@ EthController::EthController(Core::IParticipantInternal* participant, Config::Et
     , _simulationBehavior{participant, this, timeProvider}
     , _timeProvider{timeProvider}
     , _replayActive{Tracing::IsValidReplayConfig(_config.replay)}
+    , _acceptanceFilter{MakeAcceptanceFilter(_config.acceptedDestinationMacs)}
     , _logger{participant->GetLogger()}
 {
 }
@@ -46,6 +94,11 @@ EthController::EthController(Core::IParticipantInternal* participant, Config::Et
 // Trivial or detailed
 //------------------------
 
+auto EthController::GetAcceptanceFilter() const -> Core::AcceptanceFilter
+{
+    return _acceptanceFilter;
+}
+
 void EthController::RegisterServiceDiscovery()
 {
     Core::Discovery::IServiceDiscovery* disc = _participant->GetServiceDiscovery();
@@ -138,6 +191,17 @@ void EthController::SendFrame(EthernetFrame frame, void* userContext)
     }
     return SendFrameInternal(frame, userContext);
 }
+
+void EthController::SendFrames(Util::Span<const EthernetFrame> frames, void* userContext)
+{
+    _participant->SendMsgBatch([this, frames, userContext]() {
+        for (const auto& frame : frames)
+        {
+            SendFrame(frame, userContext);
+        }
+    });
+}
+
 void EthController::SendFrameInternal(EthernetFrame frame, void* userContext)
 {
     WireEthernetFrameEvent msg{};
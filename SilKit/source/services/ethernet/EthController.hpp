@@ -30,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ITraceMessageSource.hpp"
 #include "IReplayDataController.hpp"
 #include "ParticipantConfiguration.hpp"
+#include "AcceptanceFilter.hpp"
 #include "IMsgForEthController.hpp"
 #include "SimBehavior.hpp"
 
@@ -76,6 +77,7 @@ public:
     void Deactivate() override;
 
     void SendFrame(EthernetFrame frame, void* userContext = nullptr) override;
+    void SendFrames(Util::Span<const EthernetFrame> frames, void* userContext = nullptr) override;
 
     HandlerId AddFrameHandler(FrameHandler handler, DirectionMask directionMask = 0xFF) override;
     HandlerId AddFrameTransmitHandler(FrameTransmitHandler handler, EthernetTransmitStatusMask transmitStatusMask = 0xFFFF'FFFF) override;
@@ -108,6 +110,9 @@ public:
 
     void RegisterServiceDiscovery();
 
+    //! \brief Senders may skip unicast frames to destination MACs which are not configured as accepted
+    auto GetAcceptanceFilter() const -> Core::AcceptanceFilter;
+
     // Expose for unit tests
     void SetDetailedBehavior(const Core::ServiceDescriptor& remoteServiceDescriptor);
     void SetTrivialBehavior();
@@ -153,6 +158,7 @@ private:
     Orchestration::ITimeProvider* _timeProvider{ nullptr };
     Tracer _tracer;
     bool _replayActive{false};
+    Core::AcceptanceFilter _acceptanceFilter;
     Services::Logging::ILogger* _logger;
     Services::Logging::LogOnceFlag _logOnce;
 
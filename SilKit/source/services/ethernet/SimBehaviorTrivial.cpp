@@ -51,7 +51,7 @@ SimBehaviorTrivial::SimBehaviorTrivial(Core::IParticipantInternal* participant,
                     Services::Orchestration::ITimeProvider* timeProvider)
     : _participant{participant}
     , _parentController{ethController}
-    , _parentServiceEndpoint{dynamic_cast<Core::IServiceEndpoint*>(ethController)}
+    , _parentServiceEndpoint{static_cast<Core::IServiceEndpoint*>(ethController)}
     , _timeProvider{timeProvider}
 {
     (void)_parentController;
@@ -91,4 +91,36 @@ TEST(EthernetControllerConfigTest, create_controller_configured_with_network)
     EXPECT_EQ(serviceDescr.GetNetworkName(), expectedNetworkName);
 }
 
+TEST(EthernetControllerConfigTest, create_controller_with_accepted_destination_macs)
+{
+    auto&& config = PrepareParticipantConfiguration();
+    SilKit::Config::EthernetController controllerWithFilterCfg;
+    controllerWithFilterCfg.name = "ControllerWithFilter";
+    controllerWithFilterCfg.acceptedDestinationMacs.push_back("02:00:00:00:00:01");
+    config->ethernetControllers.push_back(controllerWithFilterCfg);
+
+    auto participant = SilKit::Core::CreateNullConnectionParticipantImpl(config, "TestParticipant");
+
+    auto controller =
+        dynamic_cast<EthController*>(participant->CreateEthernetController("ControllerWithFilter", "TestNetwork"));
+    auto acceptanceFilter = controller->GetAcceptanceFilter();
+    EXPECT_TRUE(acceptanceFilter.Accepts(0x02'00'00'00'00'01));
+    EXPECT_TRUE(acceptanceFilter.Accepts(0xFF'FF'FF'FF'FF'FF));
+    EXPECT_FALSE(acceptanceFilter.Accepts(0x02'00'00'00'00'02));
+}
+
+TEST(EthernetControllerConfigTest, create_controller_with_invalid_accepted_destination_mac)
+{
+    auto&& config = PrepareParticipantConfiguration();
+    SilKit::Config::EthernetController controllerWithFilterCfg;
+    controllerWithFilterCfg.name = "ControllerWithFilter";
+    controllerWithFilterCfg.acceptedDestinationMacs.push_back("02:00:00:00:00");
+    config->ethernetControllers.push_back(controllerWithFilterCfg);
+
+    auto participant = SilKit::Core::CreateNullConnectionParticipantImpl(config, "TestParticipant");
+
+    EXPECT_THROW(participant->CreateEthernetController("ControllerWithFilter", "TestNetwork"),
+                 SilKit::ConfigurationError);
+}
+
 }  // anonymous namespace
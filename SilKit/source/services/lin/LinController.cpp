@@ -50,6 +50,24 @@ LinController::LinController(Core::IParticipantInternal* participant, SilKit::Co
 // Trivial or detailed
 //------------------------
 
+auto LinController::GetAcceptanceFilter() const -> Core::AcceptanceFilter
+{
+    constexpr uint64_t idMask = 0xFF;
+    Core::AcceptanceFilter acceptanceFilter;
+    if (_config.acceptedIds.empty())
+    {
+        return acceptanceFilter;
+    }
+
+    // GoToSleep commands must reach all slaves
+    acceptanceFilter.rules.push_back(Core::AcceptanceRule{GoToSleepFrame().id, idMask});
+    for (auto&& id : _config.acceptedIds)
+    {
+        acceptanceFilter.rules.push_back(Core::AcceptanceRule{id, idMask});
+    }
+    return acceptanceFilter;
+}
+
 void LinController::RegisterServiceDiscovery()
 {
     _participant->GetServiceDiscovery()->RegisterServiceDiscoveryHandler(
@@ -32,6 +32,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ITraceMessageSource.hpp"
 #include "IReplayDataController.hpp"
 #include "ParticipantConfiguration.hpp"
+#include "AcceptanceFilter.hpp"
 #include "IMsgForLinController.hpp"
 #include "SimBehavior.hpp"
 #include "SynchronizedHandlers.hpp"
@@ -146,6 +147,9 @@ public:
     void CallLinFrameStatusEventHandler(const LinFrameStatusEvent& msg);
 
     void RegisterServiceDiscovery();
+
+    //! \brief Senders may skip transmissions of LIN IDs which are not configured as accepted, except GoToSleep frames
+    auto GetAcceptanceFilter() const -> Core::AcceptanceFilter;
     // Expose the simulated/trivial mode for unit tests
     void SetDetailedBehavior(const Core::ServiceDescriptor& remoteServiceDescriptor);
     void SetTrivialBehavior();
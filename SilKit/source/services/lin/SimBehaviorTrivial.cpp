@@ -66,7 +66,7 @@ SimBehaviorTrivial::SimBehaviorTrivial(Core::IParticipantInternal* participant,
                                        Services::Orchestration::ITimeProvider* timeProvider)
     : _participant{participant}
     , _parentController{linController}
-    , _parentServiceEndpoint{dynamic_cast<Core::IServiceEndpoint*>(linController)}
+    , _parentServiceEndpoint{static_cast<Core::IServiceEndpoint*>(linController)}
     , _timeProvider{timeProvider}
 {
 }
@@ -74,8 +74,7 @@ SimBehaviorTrivial::SimBehaviorTrivial(Core::IParticipantInternal* participant,
 template <typename MsgT>
 void SimBehaviorTrivial::ReceiveMsg(const MsgT& msg)
 {
-    auto receivingController = dynamic_cast<Core::IMessageReceiver<MsgT>*>(_parentController);
-    SILKIT_ASSERT(receivingController);
+    auto receivingController = static_cast<Core::IMessageReceiver<MsgT>*>(_parentController);
     receivingController->ReceiveMsg(_parentServiceEndpoint, msg);
 }
 
@@ -0,0 +1,235 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "AsyncSink.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include "SetThreadName.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Logging {
+
+AsyncSink::AsyncSink(std::vector<spdlog::sink_ptr> sinks, spdlog::level::level_enum flushLevel, size_t queueCapacity)
+    : _sinks{std::move(sinks)}
+    , _flushLevel{flushLevel}
+    , _queue{queueCapacity}
+{
+    auto lowestLevel = spdlog::level::off;
+    for (const auto& sink : _sinks)
+    {
+        lowestLevel = (std::min)(lowestLevel, sink->level());
+    }
+    set_level(lowestLevel);
+
+    _writerThread = std::thread{[this] { WriterLoop(); }};
+}
+
+AsyncSink::~AsyncSink()
+{
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _stopWriter = true;
+        _wakeUp.notify_one();
+        _spaceAvailable.notify_all();
+    }
+    _writerThread.join();
+}
+
+void AsyncSink::log(const spdlog::details::log_msg& msg)
+{
+    // NB: the log_msg only refers to the payload, the buffer owns a copy of it
+    Enqueue(Entry{spdlog::details::log_msg_buffer{msg}, 0});
+}
+
+void AsyncSink::flush()
+{
+    uint64_t ticket;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        ticket = _nextFlushTicket++;
+    }
+
+    // The request is queued behind all messages logged before, the writer flushes the sinks when it reaches it
+    Enqueue(Entry{{}, ticket});
+
+    std::unique_lock<std::mutex> lock{_mutex};
+    _flushDone.wait(lock, [this, ticket] { return _flushedTicket >= ticket || _stopWriter; });
+}
+
+void AsyncSink::set_pattern(const std::string& pattern)
+{
+    for (auto& sink : _sinks)
+    {
+        sink->set_pattern(pattern);
+    }
+}
+
+void AsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter)
+{
+    for (auto& sink : _sinks)
+    {
+        sink->set_formatter(sinkFormatter->clone());
+    }
+}
+
+void AsyncSink::Enqueue(Entry entry)
+{
+    if (_queue.TryPush(std::move(entry)))
+    {
+        WakeUpWriter();
+        return;
+    }
+
+    // Block until the writer drained some entries. The push is retried with the lock held and the writer notifies
+    // with the lock held, so the notification cannot get lost.
+    std::unique_lock<std::mutex> lock{_mutex};
+    ++_numBlockedProducers;
+    _spaceAvailable.wait(lock, [this, &entry] { return _queue.TryPush(std::move(entry)) || _stopWriter; });
+    --_numBlockedProducers;
+    _wakeUp.notify_one();
+}
+
+void AsyncSink::WakeUpWriter()
+{
+    // NB: pairs with the fence in WriterLoop: either the writer sees the pushed entry before it goes to sleep, or this
+    //     thread sees that the writer is idle
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_writerIdle)
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _wakeUp.notify_one();
+    }
+}
+
+void AsyncSink::WriterLoop()
+{
+    Util::SetThreadName("SilKit-Logger");
+
+    Entry entry;
+    bool hasEntry = false;
+    while (true)
+    {
+        // NB: read the flag before draining, such that all messages logged before the destruction are written
+        const bool stopping = _stopWriter;
+
+        if (hasEntry)
+        {
+            Process(entry);
+            hasEntry = false;
+        }
+        bool poppedEntries = false;
+        while (_queue.TryPop(entry))
+        {
+            Process(entry);
+            poppedEntries = true;
+        }
+
+        if (poppedEntries)
+        {
+            // NB: pairs with the increment in Enqueue, which happens before the blocked producer retries its push
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_numBlockedProducers > 0)
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _spaceAvailable.notify_all();
+            }
+        }
+
+        if (stopping)
+        {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock{_mutex};
+        _writerIdle = true;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        _wakeUp.wait(lock, [this, &entry, &hasEntry] {
+            hasEntry = _queue.TryPop(entry);
+            return hasEntry || _stopWriter;
+        });
+        _writerIdle = false;
+    }
+
+    FlushSinks();
+
+    // release the threads waiting in flush
+    std::lock_guard<std::mutex> lock{_mutex};
+    _flushDone.notify_all();
+}
+
+void AsyncSink::Process(const Entry& entry)
+{
+    if (entry.flushTicket == 0)
+    {
+        Write(entry.msg);
+        return;
+    }
+
+    FlushSinks();
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    _flushedTicket = (std::max)(_flushedTicket, entry.flushTicket);
+    _flushDone.notify_all();
+}
+
+void AsyncSink::FlushSinks()
+{
+    for (auto& sink : _sinks)
+    {
+        try
+        {
+            sink->flush();
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+}
+
+void AsyncSink::Write(const spdlog::details::log_msg& msg)
+{
+    const bool flush = msg.level >= _flushLevel && msg.level != spdlog::level::off;
+    for (auto& sink : _sinks)
+    {
+        // NB: like spdlog::logger, a failing sink must not take down the logging thread
+        try
+        {
+            if (sink->should_log(msg.level))
+            {
+                sink->log(msg);
+            }
+            if (flush)
+            {
+                sink->flush();
+            }
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+}
+
+} // namespace Logging
+} // namespace Services
+} // namespace SilKit
@@ -0,0 +1,105 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "spdlog/sinks/sink.h"
+#include "spdlog/details/log_msg_buffer.h"
+
+#include "BoundedQueue.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Logging {
+
+/*! \brief Writes log messages to other sinks from a background thread
+ *
+ *  log() copies the message into a bounded lock-free queue and only waits if the queue is full. The background thread
+ *  writes the messages to the sinks in order and flushes the sinks after each message at or above the flush level.
+ *  flush() enqueues a flush request and waits until the writer wrote all messages before it and flushed the sinks.
+ *  The writer sleeps while the queue is empty, it is woken up by the producers.
+ */
+class AsyncSink : public spdlog::sinks::sink
+{
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    AsyncSink(std::vector<spdlog::sink_ptr> sinks, spdlog::level::level_enum flushLevel,
+              size_t queueCapacity = 2048);
+    ~AsyncSink() override;
+
+    // ----------------------------------------
+    // Public methods
+    void log(const spdlog::details::log_msg& msg) override;
+    //! Waits until the messages logged before were written and the sinks were flushed
+    void flush() override;
+    void set_pattern(const std::string& pattern) override;
+    void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override;
+
+private:
+    struct Entry
+    {
+        spdlog::details::log_msg_buffer msg;
+        uint64_t flushTicket{0}; //!< if not 0, the entry is a flush request instead of a message
+    };
+
+private:
+    // ----------------------------------------
+    // Private methods
+    void Enqueue(Entry entry);
+    void WakeUpWriter();
+    void WriterLoop();
+    void Process(const Entry& entry);
+    void Write(const spdlog::details::log_msg& msg);
+    void FlushSinks();
+
+private:
+    // ----------------------------------------
+    // Private members
+    std::vector<spdlog::sink_ptr> _sinks;
+    spdlog::level::level_enum _flushLevel;
+
+    Util::BoundedQueue<Entry> _queue;
+
+    // NB: the flags are changed with the _mutex locked, such that notifications of the condition variables are not lost
+    std::mutex _mutex;
+    std::condition_variable _wakeUp; //!< signaled by the producers if the writer is idle
+    std::condition_variable _spaceAvailable; //!< signaled by the writer after draining, if producers are blocked
+    std::condition_variable _flushDone;
+    std::atomic<bool> _stopWriter{false};
+    std::atomic<bool> _writerIdle{false};
+    std::atomic<size_t> _numBlockedProducers{0};
+    uint64_t _nextFlushTicket{1};
+    uint64_t _flushedTicket{0};
+
+    std::thread _writerThread;
+};
+
+} // namespace Logging
+} // namespace Services
+} // namespace SilKit
@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <atomic>
+#include <type_traits>
 
 #include "silkit/services/logging/ILogger.hpp"
 
@@ -49,12 +50,35 @@ public:
     }
 };
 
+namespace Detail {
+
+// Arguments with a fmt::formatter are formatted directly, all others through their operator<<.
+// NB: unscoped enums are formattable as integers, but their operator<< prints the name.
+template <typename T>
+using IsNativelyFormattable = std::integral_constant<bool, fmt::is_formattable<T>::value
+                                                               && !(std::is_enum<T>::value && std::is_convertible<T, int>::value)>;
+
+template <typename T, typename std::enable_if<IsNativelyFormattable<T>::value, int>::type = 0>
+auto MakeFormattable(const T& arg) -> const T&
+{
+    return arg;
+}
+
+template <typename T, typename std::enable_if<!IsNativelyFormattable<T>::value, int>::type = 0>
+auto MakeFormattable(const T& arg) -> decltype(fmt::streamed(arg))
+{
+    return fmt::streamed(arg);
+}
+
+} // namespace Detail
+
 template<typename... Args>
 void Log(ILogger* logger, Level level, const char* fmt, const Args&... args)
 {
+    // NB: the message is only formatted if it passes the log level of the logger
     if (logger && (logger->GetLogLevel() <= level))
     {
-        const std::string msg = fmt::format(fmt, fmt::streamed(args)...);
+        const std::string msg = fmt::format(fmt, Detail::MakeFormattable(args)...);
         logger->Log(level, msg);
     }
 
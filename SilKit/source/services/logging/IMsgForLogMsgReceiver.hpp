@@ -21,7 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
-#include "silkit/services/logging/LoggingDatatypes.hpp"
+#include "LoggingDatatypesInternal.hpp"
 
 #include "IReceiver.hpp"
 #include "ISender.hpp"
@@ -31,7 +31,7 @@ namespace Services {
 namespace Logging {
 
 class IMsgForLogMsgReceiver
-    : public Core::IReceiver<LogMsg>
+    : public Core::IReceiver<LogMsg, LogMsgBatch>
     , public Core::ISender<>
 {
 };
@@ -31,7 +31,7 @@ namespace Logging {
 
 class IMsgForLogMsgSender
     : public Core::IReceiver<>
-    , public Core::ISender<LogMsg>
+    , public Core::ISender<LogMsg, LogMsgBatch>
 {
 };
 
@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "LogMsgReceiver.hpp"
 
+#include <string>
+
 namespace SilKit {
 namespace Services {
 namespace Logging {
@@ -37,6 +39,35 @@ void LogMsgReceiver::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const Lo
     _logger->LogReceivedMsg(msg);
 }
 
+void LogMsgReceiver::ReceiveMsg(const Core::IServiceEndpoint* from, const LogMsgBatch& msg)
+{
+    for (const auto& entry : msg.entries)
+    {
+        if (entry.repeatCount <= 1)
+        {
+            _logger->LogReceivedMsg(entry.msg);
+            continue;
+        }
+
+        auto repeatedMsg = entry.msg;
+        repeatedMsg.payload += " (repeated " + std::to_string(entry.repeatCount) + " times)";
+        _logger->LogReceivedMsg(repeatedMsg);
+    }
+
+    if (msg.droppedCount > 0)
+    {
+        const auto& participantName = from->GetServiceDescriptor().GetParticipantName();
+
+        LogMsg droppedMsg{};
+        droppedMsg.logger_name = participantName;
+        droppedMsg.level = Level::Warn;
+        droppedMsg.time = log_clock::now();
+        droppedMsg.payload = "Participant " + participantName + " dropped " + std::to_string(msg.droppedCount)
+                             + " log messages due to its remote log rate limit";
+        _logger->LogReceivedMsg(droppedMsg);
+    }
+}
+
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
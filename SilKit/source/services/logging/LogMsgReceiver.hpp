@@ -42,6 +42,7 @@ public:
 
 public:
     void ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const LogMsg& msg) override;
+    void ReceiveMsg(const Core::IServiceEndpoint* from, const LogMsgBatch& msg) override;
 
     // IServiceEndpoint
     inline void SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor) override;
@@ -21,23 +21,185 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "LogMsgSender.hpp"
 
+#include <algorithm>
+
+#include "SetThreadName.hpp"
+
 namespace SilKit {
 namespace Services {
 namespace Logging {
 
+namespace {
+
+// Messages are coalesced if they only differ by their timestamp
+bool IsRepetition(const LogMsg& lhs, const LogMsg& rhs)
+{
+    return lhs.level == rhs.level && lhs.payload == rhs.payload && lhs.logger_name == rhs.logger_name
+           && lhs.source == rhs.source;
+}
+
+} // namespace
+
 LogMsgSender::LogMsgSender(Core::IParticipantInternal* participant)
+    : LogMsgSender{participant, Config::RemoteLogBatching{}}
+{
+}
+
+LogMsgSender::LogMsgSender(Core::IParticipantInternal* participant, Config::RemoteLogBatching batching)
     : _participant{participant}
+    , _batching{std::move(batching)}
 {
+    if (!_batching.enabled)
+    {
+        return;
+    }
+
+    _batch.entries.reserve(_batching.maxBatchSize);
+    _rateTokens = static_cast<double>(_batching.maxMessagesPerSecond);
+    _lastRefill = std::chrono::steady_clock::now();
+    _flushThread = std::thread{&LogMsgSender::FlushThreadMain, this};
+}
+
+LogMsgSender::~LogMsgSender()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _stopped = true;
+        // the connection might already be gone, pending entries are discarded
+        _batch = LogMsgBatch{};
+    }
+    _flushRequested.notify_all();
+
+    if (_flushThread.joinable())
+    {
+        _flushThread.join();
+    }
 }
 
 void LogMsgSender::SendLogMsg(const LogMsg& msg)
 {
-    _participant->SendMsg(this, msg);
+    if (!_batching.enabled)
+    {
+        _participant->SendMsg(this, msg);
+        return;
+    }
+
+    AddToBatch(LogMsg{msg});
 }
 
 void LogMsgSender::SendLogMsg(LogMsg&& msg)
 {
-    _participant->SendMsg(this, std::move(msg));
+    if (!_batching.enabled)
+    {
+        _participant->SendMsg(this, std::move(msg));
+        return;
+    }
+
+    AddToBatch(std::move(msg));
+}
+
+void LogMsgSender::Shutdown()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        if (_stopped)
+        {
+            return;
+        }
+        _stopped = true;
+    }
+    _flushRequested.notify_all();
+
+    // the flush thread sends the remaining batch before it terminates
+    if (_flushThread.joinable())
+    {
+        _flushThread.join();
+    }
+}
+
+void LogMsgSender::AddToBatch(LogMsg&& msg)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    if (_stopped)
+    {
+        return;
+    }
+
+    // repetitions are cheap and do not count against the rate limit
+    if (!_batch.entries.empty() && IsRepetition(_batch.entries.back().msg, msg))
+    {
+        ++_batch.entries.back().repeatCount;
+        return;
+    }
+
+    if (!TryConsumeRateToken())
+    {
+        ++_batch.droppedCount;
+        return;
+    }
+
+    _batch.entries.push_back(LogMsgBatchEntry{std::move(msg), 1});
+
+    if (_batch.entries.size() >= _batching.maxBatchSize)
+    {
+        lock.unlock();
+        _flushRequested.notify_one();
+    }
+}
+
+bool LogMsgSender::TryConsumeRateToken()
+{
+    if (_batching.maxMessagesPerSecond == 0)
+    {
+        return true;
+    }
+
+    const auto maxTokens = static_cast<double>(_batching.maxMessagesPerSecond);
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = now - _lastRefill;
+    _lastRefill = now;
+    _rateTokens = std::min(maxTokens, _rateTokens + elapsed.count() * maxTokens);
+
+    if (_rateTokens < 1.0)
+    {
+        return false;
+    }
+    _rateTokens -= 1.0;
+    return true;
+}
+
+void LogMsgSender::FlushThreadMain()
+{
+    Util::SetThreadName("SilKit-LogBatch");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    while (true)
+    {
+        const auto stopped = _stopped;
+        if (!stopped)
+        {
+            _flushRequested.wait_for(lock, _batching.flushInterval, [this] {
+                return _stopped || _batch.entries.size() >= _batching.maxBatchSize;
+            });
+        }
+
+        if (!_batch.entries.empty() || _batch.droppedCount > 0)
+        {
+            LogMsgBatch batch;
+            batch.entries.reserve(_batching.maxBatchSize);
+            std::swap(batch, _batch);
+
+            // sending might log, which must not happen while holding the lock
+            lock.unlock();
+            _participant->SendMsg(this, std::move(batch));
+            lock.lock();
+        }
+
+        if (stopped)
+        {
+            return;
+        }
+    }
 }
 
 } // namespace Logging
@@ -21,9 +21,15 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "IMsgForLogMsgSender.hpp"
 #include "IParticipantInternal.hpp"
 #include "IServiceEndpoint.hpp"
+#include "Configuration.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -37,11 +43,19 @@ public:
     // ----------------------------------------
     // Constructors and Destructor
     LogMsgSender(Core::IParticipantInternal* participant);
+    LogMsgSender(Core::IParticipantInternal* participant, Config::RemoteLogBatching batching);
+    ~LogMsgSender();
 
 public:
     void SendLogMsg(const LogMsg& msg);
     void SendLogMsg(LogMsg&& msg);
 
+    //! \brief Send the pending batch and stop the flush thread.
+    //!
+    //! Must be called while the participant's connection is still alive. Log messages
+    //! passed to SendLogMsg afterwards are discarded.
+    void Shutdown();
+
     // IServiceEndpoint
     inline void SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor) override;
     inline auto GetServiceDescriptor() const -> const Core::ServiceDescriptor & override;
@@ -49,12 +63,28 @@ public:
 private:
     // ----------------------------------------
     // private methods
+    void AddToBatch(LogMsg&& msg);
+    bool TryConsumeRateToken();
+    void FlushThreadMain();
 
 private:
     // ----------------------------------------
     // private members
     Core::IParticipantInternal* _participant{nullptr};
     Core::ServiceDescriptor _serviceDescriptor{};
+
+    Config::RemoteLogBatching _batching;
+
+    std::mutex _mutex;
+    std::condition_variable _flushRequested;
+    LogMsgBatch _batch;
+    bool _stopped{false};
+
+    // token bucket for MaxMessagesPerSecond
+    double _rateTokens{0.0};
+    std::chrono::steady_clock::time_point _lastRefill;
+
+    std::thread _flushThread;
 };
 
 // ================================================================================
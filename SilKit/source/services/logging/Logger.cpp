@@ -36,6 +36,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "spdlog/sinks/basic_file_sink.h"
 
 #include "SpdlogTypeConversion.hpp"
+#include "AsyncSink.hpp"
 
 
 namespace SilKit {
@@ -101,6 +102,8 @@ Logger::Logger(const std::string& participantName, Config::Logging config)
     localtime_r(&timeNow, &tmBuffer);
 #endif
 
+    // The Stdout and File sinks, which are wrapped by an AsyncSink in asynchronous mode
+    std::vector<spdlog::sink_ptr> localSinks;
     for (auto sink : _config.sinks)
     {
         auto log_level = to_spdlog(sink.level);
@@ -122,7 +125,7 @@ Logger::Logger(const std::string& participantName, Config::Logging config)
             auto stdoutSink = std::make_shared<spdlog::sinks::ansicolor_stdout_sink_mt>();
 #endif
             stdoutSink->set_level(log_level);
-            _logger->sinks().emplace_back(std::move(stdoutSink));
+            localSinks.emplace_back(std::move(stdoutSink));
             break;
         }
         case Config::Sink::Type::File:
@@ -131,11 +134,20 @@ Logger::Logger(const std::string& participantName, Config::Logging config)
             auto filename = fmt::format("{}_{:%FT%H-%M-%S}.txt", sink.logName, tmBuffer);
             auto fileSink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(filename);
             fileSink->set_level(log_level);
-            _logger->sinks().push_back(fileSink);
+            localSinks.push_back(fileSink);
         }
         }
     }
 
+    if (_config.async && !localSinks.empty())
+    {
+        _logger->sinks().push_back(std::make_shared<AsyncSink>(std::move(localSinks), to_spdlog(_config.flushLevel)));
+    }
+    else
+    {
+        _logger->sinks().insert(_logger->sinks().end(), localSinks.begin(), localSinks.end());
+    }
+
     _logger->flush_on(to_spdlog(_config.flushLevel));
 }
 
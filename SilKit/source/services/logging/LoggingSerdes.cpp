@@ -62,6 +62,32 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, LogMsg& msg)
     return buffer;
 }
 
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const LogMsgBatchEntry& entry)
+{
+    buffer << entry.msg
+           << entry.repeatCount;
+    return buffer;
+}
+inline MessageBuffer& operator>>(MessageBuffer& buffer, LogMsgBatchEntry& entry)
+{
+    buffer >> entry.msg
+           >> entry.repeatCount;
+    return buffer;
+}
+
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const LogMsgBatch& msg)
+{
+    buffer << msg.entries
+           << msg.droppedCount;
+    return buffer;
+}
+inline MessageBuffer& operator>>(MessageBuffer& buffer, LogMsgBatch& msg)
+{
+    buffer >> msg.entries
+           >> msg.droppedCount;
+    return buffer;
+}
+
 
 void Serialize(MessageBuffer& buffer, const LogMsg& msg)
 {
@@ -73,6 +99,16 @@ void Deserialize(MessageBuffer& buffer, LogMsg& out)
 {
     buffer >> out;
 }
+
+void Serialize(MessageBuffer& buffer, const LogMsgBatch& msg)
+{
+    buffer << msg;
+}
+
+void Deserialize(MessageBuffer& buffer, LogMsgBatch& out)
+{
+    buffer >> out;
+}
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
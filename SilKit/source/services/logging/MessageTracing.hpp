@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include "ILogger.hpp"
+#include "LoggingDatatypesInternal.hpp"
 #include "IServiceEndpoint.hpp"
 #include "ServiceDescriptor.hpp"
 
@@ -42,8 +43,12 @@ void TraceTx(Logging::ILogger* logger, const Core::IServiceEndpoint* addr, const
 }
 
 // Don't trace LogMessages - this could cause cycles!
-inline void TraceRx(Logging::ILogger* /*logger*/, Core::IServiceEndpoint* /*addr*/, const Logging::LogMsg& /*msg*/) {}
-inline void TraceTx(Logging::ILogger* /*logger*/, Core::IServiceEndpoint* /*addr*/, const Logging::LogMsg& /*msg*/) {}
+inline void TraceRx(Logging::ILogger* /*logger*/, const Core::IServiceEndpoint* /*addr*/, const Logging::LogMsg& /*msg*/,
+                    const Core::ServiceDescriptor& /*from*/) {}
+inline void TraceTx(Logging::ILogger* /*logger*/, const Core::IServiceEndpoint* /*addr*/, const Logging::LogMsg& /*msg*/) {}
+inline void TraceRx(Logging::ILogger* /*logger*/, const Core::IServiceEndpoint* /*addr*/, const Logging::LogMsgBatch& /*msg*/,
+                    const Core::ServiceDescriptor& /*from*/) {}
+inline void TraceTx(Logging::ILogger* /*logger*/, const Core::IServiceEndpoint* /*addr*/, const Logging::LogMsgBatch& /*msg*/) {}
 
 } // namespace Services
 } // namespace SilKit
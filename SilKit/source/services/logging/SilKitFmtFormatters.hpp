@@ -50,18 +50,46 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IServiceEndpoint.hpp" // for operator<<(... ServiceDescriptor)
 
 
+namespace SilKit {
+namespace Services {
+namespace Logging {
+namespace Detail {
+
+//! Formats values with their to_string overload, without going through a std::ostream
+template <typename T>
+struct ToStringFormatter : fmt::formatter<fmt::string_view>
+{
+    template <typename FormatContext>
+    auto format(const T& value, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        const std::string str = to_string(value);
+        return fmt::formatter<fmt::string_view>::format(fmt::string_view{str}, ctx);
+    }
+};
+
+} // namespace Detail
+} // namespace Logging
+} // namespace Services
+} // namespace SilKit
+
+#define MAKE_TO_STRING_FORMATTER(TYPE) \
+    template<> struct fmt::formatter<TYPE> : SilKit::Services::Logging::Detail::ToStringFormatter<TYPE>{}
+MAKE_TO_STRING_FORMATTER( SilKit::Services::Logging::Level);
+MAKE_TO_STRING_FORMATTER( SilKit::Services::Lin::LinChecksumModel);
+MAKE_TO_STRING_FORMATTER( SilKit::Services::Lin::LinFrameResponseMode);
+MAKE_TO_STRING_FORMATTER( SilKit::Services::Lin::LinControllerStatus);
+MAKE_TO_STRING_FORMATTER( SilKit::Services::Orchestration::ParticipantState);
+MAKE_TO_STRING_FORMATTER( SilKit::Services::Orchestration::SystemCommand::Kind);
+MAKE_TO_STRING_FORMATTER( SilKit::Services::Orchestration::SystemCommand);
+MAKE_TO_STRING_FORMATTER( SilKit::Core::ServiceDescriptor);
+
 #define MAKE_FORMATTER(TYPE) template<> struct fmt::formatter<TYPE> : ostream_formatter{}
 MAKE_FORMATTER( SilKit::Core::Discovery::ServiceDiscoveryEvent);
-MAKE_FORMATTER( SilKit::Services::Lin::LinChecksumModel);
-MAKE_FORMATTER( SilKit::Services::Lin::LinFrameResponseMode);
 MAKE_FORMATTER( SilKit::Services::Rpc::FunctionCall);
 MAKE_FORMATTER( SilKit::Services::Rpc::FunctionCallResponse);
-MAKE_FORMATTER( SilKit::Services::Orchestration::ParticipantState);
-MAKE_FORMATTER( SilKit::Core::ServiceDescriptor);
 MAKE_FORMATTER( SilKit::Core::ProtocolVersion);
 MAKE_FORMATTER( SilKit::Core::Discovery::ParticipantDiscoveryEvent);
 MAKE_FORMATTER( SilKit::Services::PubSub::WireDataMessageEvent);
+MAKE_FORMATTER( SilKit::Services::PubSub::WireDataMessageBatchEvent);
 MAKE_FORMATTER( SilKit::Services::Logging::LogMsg);
 MAKE_FORMATTER( SilKit::Services::Orchestration::WorkflowConfiguration);
-MAKE_FORMATTER( SilKit::Services::Orchestration::SystemCommand);
-MAKE_FORMATTER( SilKit::Services::Lin::LinControllerStatus);
@@ -21,7 +21,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <chrono>
 #include <functional>
+#include <future>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -30,6 +34,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "MockParticipant.hpp"
 #include "Logger.hpp"
 #include "LogMsgSender.hpp"
+#include "AsyncSink.hpp"
+
+#include "spdlog/sinks/base_sink.h"
 
 namespace {
 
@@ -53,8 +60,18 @@ class MockParticipant : public DummyParticipant
 {
 public:
     MOCK_METHOD((void), SendMsg, (const IServiceEndpoint*, LogMsg&&));
+    MOCK_METHOD((void), SendMsg, (const IServiceEndpoint*, LogMsgBatch&&));
 };
 
+auto MakeLogMsg(std::string payload) -> LogMsg
+{
+    LogMsg msg{};
+    msg.logger_name = "Logger";
+    msg.level = Level::Warn;
+    msg.payload = std::move(payload);
+    return msg;
+}
+
 auto ALogMsgWith(std::string logger_name, Level level, std::string payload) -> Matcher<LogMsg&&>
 {
     return AllOf(
@@ -96,6 +113,87 @@ TEST(LoggerTest, send_log_message_with_sender)
     logMsgSender.SendLogMsg(std::move(msg));
 }
 
+TEST(LoggerTest, batched_sender_coalesces_repeated_messages)
+{
+    Config::RemoteLogBatching batching;
+    batching.enabled = true;
+    batching.maxBatchSize = 3;
+    batching.flushInterval = 1h;
+
+    MockParticipant mockParticipant;
+    LogMsgSender logMsgSender(&mockParticipant, batching);
+
+    std::promise<LogMsgBatch> sentBatch;
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, A<LogMsgBatch&&>()))
+        .WillOnce([&sentBatch](const IServiceEndpoint*, LogMsgBatch&& batch) { sentBatch.set_value(batch); });
+
+    for (const auto* payload : {"watchdog", "watchdog", "watchdog", "first", "second"})
+    {
+        logMsgSender.SendLogMsg(MakeLogMsg(payload));
+    }
+
+    // the third distinct entry fills the batch and triggers the flush
+    auto future = sentBatch.get_future();
+    ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+    auto batch = future.get();
+    ASSERT_EQ(batch.entries.size(), 3u);
+    EXPECT_EQ(batch.entries.at(0).msg.payload, "watchdog");
+    EXPECT_EQ(batch.entries.at(0).repeatCount, 3u);
+    EXPECT_EQ(batch.entries.at(1).msg.payload, "first");
+    EXPECT_EQ(batch.entries.at(1).repeatCount, 1u);
+    EXPECT_EQ(batch.entries.at(2).msg.payload, "second");
+    EXPECT_EQ(batch.droppedCount, 0u);
+
+    logMsgSender.Shutdown();
+}
+
+TEST(LoggerTest, batched_sender_flushes_on_interval_and_limits_rate)
+{
+    Config::RemoteLogBatching batching;
+    batching.enabled = true;
+    batching.flushInterval = 10ms;
+    batching.maxMessagesPerSecond = 2;
+
+    MockParticipant mockParticipant;
+    LogMsgSender logMsgSender(&mockParticipant, batching);
+
+    // a flush may happen between any two messages, so the batches are only checked in total
+    std::mutex mutex;
+    std::vector<LogMsgBatchEntry> sentEntries;
+    uint32_t droppedCount{0};
+    std::promise<void> firstBatchSent;
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, A<LogMsgBatch&&>()))
+        .WillRepeatedly([&](const IServiceEndpoint*, LogMsgBatch&& batch) {
+            std::unique_lock<std::mutex> lock{mutex};
+            const auto isFirstBatch = sentEntries.empty() && droppedCount == 0;
+            sentEntries.insert(sentEntries.end(), batch.entries.begin(), batch.entries.end());
+            droppedCount += batch.droppedCount;
+            if (isFirstBatch)
+            {
+                firstBatchSent.set_value();
+            }
+        });
+
+    for (auto i = 0; i < 5; ++i)
+    {
+        logMsgSender.SendLogMsg(MakeLogMsg("message " + std::to_string(i)));
+    }
+
+    // the batch is not full, so only the flush interval sends it
+    ASSERT_EQ(firstBatchSent.get_future().wait_for(5s), std::future_status::ready);
+
+    logMsgSender.Shutdown();
+
+    std::unique_lock<std::mutex> lock{mutex};
+    // The initial rate tokens let the first two messages pass. Further messages only pass if the tokens were
+    // refilled in between, which takes at least half a second per message.
+    ASSERT_GE(sentEntries.size(), 2u);
+    EXPECT_EQ(sentEntries.at(0).msg.payload, "message 0");
+    EXPECT_EQ(sentEntries.at(1).msg.payload, "message 1");
+    EXPECT_LT(sentEntries.size(), 5u);
+    EXPECT_EQ(sentEntries.size() + droppedCount, 5u);
+}
+
 TEST(LoggerTest, send_log_message_from_logger)
 {
     std::string loggerName{"ParticipantAndLogger"};
@@ -158,6 +256,120 @@ TEST(LoggerTest, get_log_level)
     EXPECT_EQ(logger.GetLogLevel(), Level::Debug);
 }
 
+class CollectingSink : public spdlog::sinks::base_sink<std::mutex>
+{
+public:
+    std::vector<std::string> payloads;
+    int numFlushes{0};
+
+protected:
+    void sink_it_(const spdlog::details::log_msg& msg) override
+    {
+        payloads.emplace_back(msg.payload.data(), msg.payload.size());
+    }
+    void flush_() override { ++numFlushes; }
+};
+
+TEST(LoggerTest, async_sink_writes_messages_in_order)
+{
+    auto collectingSink = std::make_shared<CollectingSink>();
+    collectingSink->set_level(spdlog::level::info);
+    {
+        // a small queue makes the logging threads wait for the writer
+        AsyncSink asyncSink{{collectingSink}, spdlog::level::err, 4};
+        EXPECT_EQ(asyncSink.level(), spdlog::level::info);
+
+        std::vector<std::thread> threads;
+        for (auto t = 0; t < 4; t++)
+        {
+            threads.emplace_back([&asyncSink, t] {
+                for (auto i = 0; i < 100; i++)
+                {
+                    const auto payload = std::to_string(t) + ":" + std::to_string(i);
+                    asyncSink.log(spdlog::details::log_msg{"Logger", spdlog::level::info, payload});
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        asyncSink.log(spdlog::details::log_msg{"Logger", spdlog::level::debug, "filtered"});
+        asyncSink.log(spdlog::details::log_msg{"Logger", spdlog::level::err, "flushed"});
+    } // the destructor writes the remaining messages
+
+    ASSERT_EQ(collectingSink->payloads.size(), 401u);
+    EXPECT_EQ(collectingSink->payloads.back(), "flushed");
+    EXPECT_GE(collectingSink->numFlushes, 1);
+
+    std::vector<int> nextIndex(4, 0);
+    for (auto i = 0u; i < 400; i++)
+    {
+        const auto& payload = collectingSink->payloads.at(i);
+        const auto thread = std::stoi(payload.substr(0, payload.find(':')));
+        EXPECT_EQ(std::stoi(payload.substr(payload.find(':') + 1)), nextIndex.at(thread)++);
+    }
+}
+
+TEST(LoggerTest, async_sink_flush_waits_for_queued_messages)
+{
+    auto collectingSink = std::make_shared<CollectingSink>();
+    collectingSink->set_level(spdlog::level::info);
+
+    AsyncSink asyncSink{{collectingSink}, spdlog::level::off, 4};
+
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 2; t++)
+    {
+        threads.emplace_back([&asyncSink, t] {
+            for (auto i = 0; i < 50; i++)
+            {
+                asyncSink.log(spdlog::details::log_msg{"Logger", spdlog::level::info, std::to_string(t)});
+                if (i % 10 == 0)
+                {
+                    asyncSink.flush();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    asyncSink.log(spdlog::details::log_msg{"Logger", spdlog::level::info, "last"});
+    asyncSink.flush();
+
+    // the sink is still alive, so the messages were written by flush
+    ASSERT_EQ(collectingSink->payloads.size(), 101u);
+    EXPECT_EQ(collectingSink->payloads.back(), "last");
+    EXPECT_EQ(collectingSink->numFlushes, 11);
+}
+
+struct OnlyStreamable
+{
+    int value;
+};
+
+std::ostream& operator<<(std::ostream& out, const OnlyStreamable& streamable)
+{
+    return out << "OnlyStreamable{" << streamable.value << "}";
+}
+
+TEST(LoggerTest, format_native_and_streamed_arguments)
+{
+    SilKit::Core::Tests::MockLogger logger;
+    EXPECT_CALL(logger, GetLogLevel()).WillRepeatedly(Return(Level::Info));
+
+    EXPECT_CALL(logger, Log(Level::Info, "1 two Running OnlyStreamable{3}")).Times(1);
+    Info(&logger, "{} {} {} {}", 1, std::string{"two"}, SilKit::Services::Orchestration::ParticipantState::Running,
+         OnlyStreamable{3});
+
+    // messages below the log level are not formatted
+    EXPECT_CALL(logger, Log(Level::Debug, _)).Times(0);
+    Debug(&logger, "{}", OnlyStreamable{4});
+}
+
 TEST(LogOnceFlag, check_setter)
 {
     LogOnceFlag  once;
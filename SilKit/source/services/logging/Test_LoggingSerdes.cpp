@@ -39,3 +39,23 @@ TEST(MwLoggingSerdes, LoggingSerdes)
     Deserialize(buffer, out);
     ASSERT_EQ(in, out);
 }
+
+TEST(MwLoggingSerdes, LogMsgBatchSerdes)
+{
+    SilKit::Core::MessageBuffer buffer;
+    SilKit::Services::Logging::LogMsgBatch in, out;
+    SilKit::Services::Logging::LogMsgBatchEntry entry;
+    entry.msg.level = SilKit::Services::Logging::Level::Warn;
+    entry.msg.source = SilKit::Services::Logging::SourceLoc{"somefile.txt", 15, "TEST(LogMsgBatchSerdes)"};
+    entry.msg.payload = "Hello, logger!";
+    entry.repeatCount = 7;
+    in.entries.push_back(entry);
+    entry.msg.payload = "Bye, logger!";
+    entry.repeatCount = 1;
+    in.entries.push_back(entry);
+    in.droppedCount = 42;
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+    ASSERT_EQ(in, out);
+}
@@ -0,0 +1,143 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+// Scaling benchmark of the time synchronization bookkeeping over the number of synchronized participants.
+//
+// Every round, each other participant announces its next time step and the grant decision is evaluated, as done by
+// the SynchronizedPolicy for every received NextSimTask. The TimeConfiguration is compared with a linear scan over a
+// std::map keyed by participant name. Usage: Bench_TimeConfiguration [rounds]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "TimeConfiguration.hpp"
+#include "Hash.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+using namespace SilKit::Services::Orchestration;
+
+//! The bookkeeping as it was done before the participants had dense indices
+struct LinearScanReference
+{
+    void OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep)
+    {
+        otherNextTasks[participantName] = std::move(nextStep);
+    }
+
+    bool OtherParticipantHasLowerTimepoint() const
+    {
+        for (const auto& otherTask : otherNextTasks)
+        {
+            if (myNextTimePoint > otherTask.second.timePoint)
+                return true;
+        }
+        return false;
+    }
+
+    std::chrono::nanoseconds myNextTimePoint{0ns};
+    std::map<std::string, NextSimTask> otherNextTasks;
+};
+
+size_t sink{0};
+
+template <typename Callable>
+auto MeasureNanosecondsPerMessage(size_t rounds, size_t numParticipants, Callable&& round) -> double
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < rounds; ++i)
+    {
+        round(i);
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>{duration}.count() / (rounds * numParticipants);
+}
+
+void RunBenchmark(size_t rounds, size_t numParticipants)
+{
+    std::vector<std::string> names;
+    std::vector<SilKit::Core::ParticipantId> ids;
+    for (size_t i = 0; i < numParticipants; ++i)
+    {
+        names.push_back("Participant" + std::to_string(i));
+        ids.push_back(SilKit::Util::Hash::Hash(names.back()));
+    }
+
+    NextSimTask task;
+    task.duration = 1us;
+
+    LinearScanReference reference;
+    const auto linearScan = MeasureNanosecondsPerMessage(rounds, numParticipants, [&](size_t round) {
+        task.timePoint = round * 1us;
+        reference.myNextTimePoint = task.timePoint;
+        for (const auto& name : names)
+        {
+            reference.OnReceiveNextSimStep(name, task);
+            sink += reference.OtherParticipantHasLowerTimepoint() ? 1 : 0;
+        }
+    });
+
+    TimeConfiguration configuration;
+    configuration.SetStepDuration(1us);
+    for (const auto& name : names)
+    {
+        configuration.SynchronizedParticipantAdded(name);
+    }
+    const auto tournamentTree = MeasureNanosecondsPerMessage(rounds, numParticipants, [&](size_t round) {
+        task.timePoint = round * 1us;
+        for (const auto id : ids)
+        {
+            configuration.OnReceiveNextSimStep(id, task);
+            sink += configuration.OtherParticipantHasLowerTimepoint() ? 1 : 0;
+        }
+        configuration.AdvanceTimeStep();
+    });
+
+    std::cout << std::setw(14) << numParticipants << std::fixed << std::setprecision(1) << std::setw(18) << linearScan
+              << std::setw(18) << tournamentTree << "\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    size_t rounds = 1000;
+    if (argc > 1)
+    {
+        rounds = std::stoul(argv[1]);
+    }
+
+    std::cout << std::setw(14) << "participants" << std::setw(18) << "map scan [ns]" << std::setw(18)
+              << "tree [ns]" << "\n";
+
+    for (const size_t numParticipants : {1, 2, 10, 50, 100, 500, 1000})
+    {
+        RunBenchmark(rounds, numParticipants);
+    }
+
+    return sink == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
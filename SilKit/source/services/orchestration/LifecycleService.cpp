@@ -453,6 +453,8 @@ void LifecycleService::ChangeParticipantState(ParticipantState newState, std::st
         _status = status;
     }
 
+    // messages held back for aggregation are delivered before the peers learn about the new state
+    _participant->FlushSendBuffers();
     SendMsg(status);
 }
 
@@ -0,0 +1,114 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+#include "TimeConfiguration.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using namespace SilKit::Services::Orchestration;
+
+auto MakeNextSimTask(std::chrono::nanoseconds timePoint) -> NextSimTask
+{
+    NextSimTask task;
+    task.timePoint = timePoint;
+    task.duration = 1ms;
+    return task;
+}
+
+TEST(TimeConfigurationTest, no_other_participants)
+{
+    TimeConfiguration configuration;
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+    configuration.AdvanceTimeStep();
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(TimeConfigurationTest, added_participant_blocks_until_it_sent_its_next_step)
+{
+    TimeConfiguration configuration;
+    configuration.SynchronizedParticipantAdded("P1");
+    configuration.SynchronizedParticipantAdded("P1");
+    // the other participant is at -1ns until it sent its first step
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(0ms));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.AdvanceTimeStep();
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(1ms));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(TimeConfigurationTest, lowest_time_point_of_many_participants)
+{
+    TimeConfiguration configuration;
+    constexpr int numParticipants = 37;
+    for (int i = 0; i < numParticipants; ++i)
+    {
+        configuration.OnReceiveNextSimStep("P" + std::to_string(i), MakeNextSimTask(0ms));
+    }
+
+    for (int step = 0; step < 5; ++step)
+    {
+        configuration.AdvanceTimeStep();
+        const auto next = configuration.NextSimStep().timePoint;
+
+        // the participants catch up one after the other, until then the remaining ones block
+        for (int i = 0; i < numParticipants; ++i)
+        {
+            EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+            configuration.OnReceiveNextSimStep("P" + std::to_string(i), MakeNextSimTask(next));
+        }
+        EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+    }
+
+    // a participant that is ahead does not block
+    configuration.OnReceiveNextSimStep("P3", MakeNextSimTask(1s));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(TimeConfigurationTest, removed_participant_does_not_block)
+{
+    TimeConfiguration configuration;
+    configuration.SynchronizedParticipantAdded("P1");
+    configuration.SynchronizedParticipantAdded("P2");
+    configuration.AdvanceTimeStep();
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(1ms));
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.SynchronizedParticipantRemoved("P2");
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+    EXPECT_THROW(configuration.SynchronizedParticipantRemoved("P2"), SilKit::SilKitError);
+
+    // the index of the removed participant is reused
+    configuration.SynchronizedParticipantAdded("P3");
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+} // anonymous namespace
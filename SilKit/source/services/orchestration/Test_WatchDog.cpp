@@ -19,8 +19,11 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <future>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -40,70 +43,22 @@ using namespace testing;
 using namespace SilKit;
 using namespace SilKit::Services::Orchestration;
 
-class LimitedMockClock : public WatchDog::IClock
+class ManualClock : public WatchDog::IClock
 {
 public:
-    explicit LimitedMockClock(std::chrono::nanoseconds limit, std::chrono::nanoseconds tick = 1ms)
-        : _limitRep{static_cast<std::chrono::nanoseconds>(limit).count()}
-        , _tick{tick}
-    {
-    }
-
     auto Now() const -> std::chrono::nanoseconds override
     {
-        _now += _tick;
-
-        // set the flag that the limit has been reached (but only _once_, otherwise an exception is thrown)
-        if (_now >= GetLimit())
-        {
-            if (!_limitReachedFlagged.exchange(true))
-            {
-                _limitReached.set_value();
-            }
-        }
-
-        return _now;
+        ++_readCount;
+        return std::chrono::nanoseconds{_now.load()};
     }
 
-    /// This function waits until either, the mock time has reached the current limit, or, the wall-clock timeout has
-    /// been reached.
-    ///
-    /// \param wallClockTimeout How long this function should wait for the limit to be reached
-    /// \return true if the limit was reached, false if the wall-clock timeout was reached
-    bool WaitUntilLimitReachedFor(std::chrono::nanoseconds wallClockTimeout)
-    {
-        const auto status = _limitReached.get_future().wait_for(wallClockTimeout);
-        return status == std::future_status::ready;
-    }
+    void AdvanceTo(std::chrono::nanoseconds now) { _now = now.count(); }
 
-    /// Advances the limit and resets the reached flag. Therefore WaitUntilLimitReachedFor can be called again
-    /// afterwards, even if the limit had been reached before.
-    ///
-    /// \param advance By how much the current limit should be advanced
-    void AdvanceLimitBy(std::chrono::nanoseconds advance)
-    {
-        _limitRep += static_cast<std::chrono::nanoseconds>(advance).count();
-
-        if (_limitReachedFlagged)
-        {
-            _limitReached = {};
-            _limitReachedFlagged = false;
-        }
-    }
+    auto ReadCount() const -> int { return _readCount; }
 
 private:
-    auto GetLimit() const -> std::chrono::nanoseconds { return std::chrono::nanoseconds{_limitRep}; }
-
-private:
-    std::atomic<std::chrono::nanoseconds::rep> _limitRep;
-    std::chrono::nanoseconds _tick;
-
-    // stores the current mock-time
-    mutable std::chrono::nanoseconds _now{};
-    // true if the promise has already been set
-    mutable std::atomic<bool> _limitReachedFlagged{false};
-    // will be set once (!) if _now is greater or equal to _limit
-    mutable std::promise<void> _limitReached{};
+    std::atomic<std::chrono::nanoseconds::rep> _now{0};
+    mutable std::atomic<int> _readCount{0};
 };
 
 class WatchDogTest : public testing::Test
@@ -124,10 +79,22 @@ protected:
     // ----------------------------------------
     // Helper Methods
 
+    /// Returns an action which fulfills the promise, so that the test can wait for the callback
+    static auto Notify(std::promise<void>& promise)
+    {
+        return InvokeWithoutArgs([&promise] { promise.set_value(); });
+    }
+
+    bool WaitFor(std::promise<void>& promise)
+    {
+        return promise.get_future().wait_for(WAIT_EXPECT_READY) == std::future_status::ready;
+    }
+
 protected:
     // ----------------------------------------
     // Members
     Callbacks callbacks;
+    ManualClock clock;
 
     const std::chrono::milliseconds WAIT_EXPECT_READY = 10s;
     const std::chrono::milliseconds WAIT_EXPECT_TIMEOUT = 50ms;
@@ -137,11 +104,9 @@ protected:
 // IMPORTANT: Set expectations (EXPECT_CALL) before the call to watchDog.Start()!
 // ================================================================================
 //
-// Note: The watchdog is running in a separate thread in the background and
-//       uses the wall clock for periodic checks. It is possible that
-//       scheduling might lead to test failures in rare cases. To make the
-//       tests entirely deterministic, this stepping must be refactored out
-//       of the watchdog into it's own interface as well.
+// Note: The timeouts are armed in a TimerService, which reads the injected clock
+//       periodically while a timeout is armed. The callbacks are invoked shortly
+//       after the clock was advanced past a deadline.
 
 TEST_F(WatchDogTest, throw_if_warn_timeout_is_zero)
 {
@@ -155,67 +120,71 @@ TEST_F(WatchDogTest, throw_if_error_timeout_is_zero)
 
 TEST_F(WatchDogTest, warn_after_timeout)
 {
-    LimitedMockClock mockClock{50ms, 2ms};
-
-    WatchDog watchDog{Config::HealthCheck{10ms, std::chrono::milliseconds::max()}, &mockClock};
+    WatchDog watchDog{Config::HealthCheck{10ms, std::chrono::milliseconds::max()}, &clock};
     watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
 
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
+    std::promise<void> warned;
+    EXPECT_CALL(callbacks, WarnHandler(Ge(10ms))).WillOnce(Notify(warned));
 
     watchDog.Start();
+    clock.AdvanceTo(11ms);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(WaitFor(warned));
 }
 
 TEST_F(WatchDogTest, error_after_timeout)
 {
-    LimitedMockClock mockClock{100ms, 5ms};
-
-    WatchDog watchDog{Config::HealthCheck{10ms, 50ms}, &mockClock};
+    WatchDog watchDog{Config::HealthCheck{10ms, 50ms}, &clock};
     watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1);
+    std::promise<void> failed;
+    EXPECT_CALL(callbacks, ErrorHandler(Ge(50ms))).WillOnce(Notify(failed));
 
     watchDog.Start();
+    clock.AdvanceTo(100ms);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(WaitFor(failed));
 }
 
 TEST_F(WatchDogTest, warn_only_once)
 {
-    LimitedMockClock mockClock{100ms, 10ms};
-
-    WatchDog watchDog{Config::HealthCheck{20ms, std::chrono::milliseconds::max()}, &mockClock};
+    WatchDog watchDog{Config::HealthCheck{20ms, std::chrono::milliseconds::max()}, &clock};
     watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
     watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
+    std::promise<void> warned;
+    EXPECT_CALL(callbacks, WarnHandler(_)).WillOnce(Notify(warned));
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
 
     watchDog.Start();
+    clock.AdvanceTo(50ms);
+
+    ASSERT_TRUE(WaitFor(warned));
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    clock.AdvanceTo(100ms);
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
 }
 
 TEST_F(WatchDogTest, error_only_once)
 {
-    LimitedMockClock mockClock{100ms, 10ms};
-
-    WatchDog watchDog{Config::HealthCheck{10ms, 50ms}, &mockClock};
+    WatchDog watchDog{Config::HealthCheck{10ms, 50ms}, &clock};
     watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1);
+    std::promise<void> failed;
+    EXPECT_CALL(callbacks, ErrorHandler(_)).WillOnce(Notify(failed));
 
     watchDog.Start();
+    clock.AdvanceTo(60ms);
+
+    ASSERT_TRUE(WaitFor(failed));
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    clock.AdvanceTo(100ms);
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
 }
 
 TEST_F(WatchDogTest, no_callback_if_reset_in_time)
 {
-    LimitedMockClock mockClock{1s, 100ms};
-
-    WatchDog watchDog{Config::HealthCheck{2000ms, 3000ms}, &mockClock};
+    WatchDog watchDog{Config::HealthCheck{2000ms, 3000ms}, &clock};
     watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
     watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
@@ -223,20 +192,15 @@ TEST_F(WatchDogTest, no_callback_if_reset_in_time)
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
 
     watchDog.Start();
-
-    // After being started, the watchdog will ask the clock for the current time periodically. This will advance the
-    // mock time each time and eventually the limit will be reached.
-
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
-    mockClock.AdvanceLimitBy(1s);
+    clock.AdvanceTo(1s);
 
     watchDog.Reset();
 
-    // After being reset, the watchdog will not ask the clock for the current time anymore. Since the mock time only
-    // advances when the watchdog asks for it, the new limit will never be reached.
-
-    // The wall-clock timeout is deliberately chosen rather small since it should be reached.
-    ASSERT_FALSE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_TIMEOUT));
+    // After being reset, no timeout is armed and the timer service stops reading the clock.
+    const auto readCount = clock.ReadCount();
+    clock.AdvanceTo(5s);
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
+    EXPECT_LE(clock.ReadCount(), readCount + 2);
 }
 
 TEST_F(WatchDogTest, create_health_check_unconfigured)
@@ -258,9 +222,7 @@ TEST_F(WatchDogTest, create_health_check_unconfigured)
 
 TEST_F(WatchDogTest, create_health_check_configured)
 {
-    LimitedMockClock mockClock{1000ms, 250ms};
-
-    WatchDog watchDog{Config::HealthCheck{2000ms, 3000ms}, &mockClock};
+    WatchDog watchDog{Config::HealthCheck{2000ms, 3000ms}, &clock};
     watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
     watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
@@ -268,17 +230,15 @@ TEST_F(WatchDogTest, create_health_check_configured)
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
 
     watchDog.Start();
-
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    clock.AdvanceTo(1000ms);
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
 
     watchDog.Reset();
 }
 
 TEST_F(WatchDogTest, nothing_without_soft_and_hard)
 {
-    LimitedMockClock mockClock{200ms, 50ms};
-
-    WatchDog watchDog{Config::HealthCheck{{}, {}}, &mockClock};
+    WatchDog watchDog{Config::HealthCheck{{}, {}}, &clock};
     watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
     watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
@@ -287,46 +247,48 @@ TEST_F(WatchDogTest, nothing_without_soft_and_hard)
 
     watchDog.Start();
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    // Without timeouts, nothing is armed and the clock is not polled
+    const auto readCount = clock.ReadCount();
+    clock.AdvanceTo(1h);
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
+    EXPECT_EQ(clock.ReadCount(), readCount);
 }
 
 TEST_F(WatchDogTest, warn_with_soft_without_hard)
 {
-    LimitedMockClock mockClock{200ms, 50ms};
-
-    WatchDog watchDog{Config::HealthCheck{100ms, {}}, &mockClock};
+    WatchDog watchDog{Config::HealthCheck{100ms, {}}, &clock};
     watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
     watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
+    std::promise<void> warned;
+    EXPECT_CALL(callbacks, WarnHandler(_)).WillOnce(Notify(warned));
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
 
     watchDog.Start();
+    clock.AdvanceTo(200ms);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(WaitFor(warned));
 }
 
 TEST_F(WatchDogTest, error_with_hard_without_soft)
 {
-    LimitedMockClock mockClock{200ms, 50ms};
-
-    WatchDog watchDog{Config::HealthCheck{{}, 100ms}, &mockClock};
+    WatchDog watchDog{Config::HealthCheck{{}, 100ms}, &clock};
     watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
     watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
+    std::promise<void> failed;
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1);
+    EXPECT_CALL(callbacks, ErrorHandler(_)).WillOnce(Notify(failed));
 
     watchDog.Start();
+    clock.AdvanceTo(200ms);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(WaitFor(failed));
 }
 
 TEST_F(WatchDogTest, warn_and_error_with_soft_and_hard)
 {
-    LimitedMockClock mockClock{150ms, 10ms};
-
-    WatchDog watchDog{Config::HealthCheck{100ms, 200ms}, &mockClock};
+    WatchDog watchDog{Config::HealthCheck{100ms, 200ms}, &clock};
     watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
     watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
@@ -335,21 +297,44 @@ TEST_F(WatchDogTest, warn_and_error_with_soft_and_hard)
     // The expectations on WarnHandler and ErrorHandler are partially ordered. The explicit call to SequencePoint
     // separates two sets of expectations.
     testing::Sequence warnSequence, errorSequence;
+    std::promise<void> warned, failed;
 
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1).InSequence(warnSequence);
+    EXPECT_CALL(callbacks, WarnHandler(_)).InSequence(warnSequence).WillOnce(Notify(warned));
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0).InSequence(errorSequence);
     EXPECT_CALL(callbacks, SequencePoint()).Times(1).InSequence(warnSequence, errorSequence);
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(0).InSequence(warnSequence);
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1).InSequence(errorSequence);
+    EXPECT_CALL(callbacks, ErrorHandler(_)).InSequence(errorSequence).WillOnce(Notify(failed));
 
     watchDog.Start();
+    clock.AdvanceTo(150ms);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(WaitFor(warned));
     callbacks.SequencePoint();
 
-    mockClock.AdvanceLimitBy(100ms);
+    clock.AdvanceTo(250ms);
+
+    ASSERT_TRUE(WaitFor(failed));
+}
+
+TEST_F(WatchDogTest, restart_rearms_the_timeouts)
+{
+    WatchDog watchDog{Config::HealthCheck{100ms, {}}, &clock};
+    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+
+    std::promise<void> warned;
+    EXPECT_CALL(callbacks, WarnHandler(Lt(100ms + 10ms))).WillOnce(Notify(warned));
+
+    watchDog.Start();
+    clock.AdvanceTo(90ms);
+    watchDog.Reset();
+
+    // the second job starts at 90ms, its soft timeout expires at 190ms
+    watchDog.Start();
+    clock.AdvanceTo(150ms);
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
+    clock.AdvanceTo(195ms);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(WaitFor(warned));
 }
 
 } // anonymous namespace
@@ -21,6 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "TimeConfiguration.hpp"
 
+#include <algorithm>
+
+#include "Hash.hpp"
+
 namespace SilKit {
 namespace Services {
 namespace Orchestration {
@@ -41,37 +45,95 @@ void TimeConfiguration::SetBlockingMode(bool blocking)
 void TimeConfiguration::SynchronizedParticipantAdded(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    const auto participantId = SilKit::Util::Hash::Hash(otherParticipantName);
+    if (_participantIndices.find(participantId) != _participantIndices.end())
     {
         // ignore already known participants
         return;
     }
-    NextSimTask task;
-    task.timePoint = -1ns;
-    task.duration = 0ns;
-    _otherNextTasks[otherParticipantName] = task;
+    UpdateNextTimePoint(GetOrAddParticipantIndex(participantId), -1ns);
 }
 
 void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep)
+{
+    OnReceiveNextSimStep(SilKit::Util::Hash::Hash(participantName), std::move(nextStep));
+}
+
+void TimeConfiguration::OnReceiveNextSimStep(Core::ParticipantId participantId, NextSimTask nextStep)
 {
     Lock lock{_mx};
-    _otherNextTasks[participantName] = std::move(nextStep);
+    UpdateNextTimePoint(GetOrAddParticipantIndex(participantId), nextStep.timePoint);
 }
 
 void TimeConfiguration::SynchronizedParticipantRemoved(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    auto it = _participantIndices.find(SilKit::Util::Hash::Hash(otherParticipantName));
+    if (it == _participantIndices.end())
     {
         const std::string errorMessage{"Participant " + otherParticipantName + " unknown."};
         throw SilKitError{errorMessage};
     }
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
+    // an unused leaf never has the lowest time point
+    UpdateNextTimePoint(it->second, std::chrono::nanoseconds::max());
+    _freeParticipantIndices.push_back(it->second);
+    _participantIndices.erase(it);
+}
+
+auto TimeConfiguration::GetOrAddParticipantIndex(Core::ParticipantId participantId) -> std::size_t
+{
+    auto it = _participantIndices.find(participantId);
+    if (it != _participantIndices.end())
+    {
+        return it->second;
+    }
+
+    std::size_t index{_participantIndices.size()};
+    if (!_freeParticipantIndices.empty())
+    {
+        index = _freeParticipantIndices.back();
+        _freeParticipantIndices.pop_back();
+    }
+    _participantIndices.emplace(participantId, index);
+
+    if (index >= _leafCount)
     {
-        _otherNextTasks.erase(it);
+        // grow the tree to the next power of two and rebuild the inner nodes
+        auto leafCount = (std::max)(_leafCount, std::size_t{1});
+        while (leafCount <= index)
+        {
+            leafCount *= 2;
+        }
+
+        std::vector<std::chrono::nanoseconds> nextTimePoints(2 * leafCount, std::chrono::nanoseconds::max());
+        std::copy(_nextTimePoints.begin() + _leafCount, _nextTimePoints.end(), nextTimePoints.begin() + leafCount);
+        for (auto node = leafCount - 1; node > 0; --node)
+        {
+            nextTimePoints[node] = (std::min)(nextTimePoints[2 * node], nextTimePoints[2 * node + 1]);
+        }
+
+        _nextTimePoints = std::move(nextTimePoints);
+        _leafCount = leafCount;
     }
+    return index;
 }
+
+void TimeConfiguration::UpdateNextTimePoint(std::size_t index, std::chrono::nanoseconds timePoint)
+{
+    auto node = _leafCount + index;
+    _nextTimePoints[node] = timePoint;
+    for (node /= 2; node > 0; node /= 2)
+    {
+        const auto lowest = (std::min)(_nextTimePoints[2 * node], _nextTimePoints[2 * node + 1]);
+        if (_nextTimePoints[node] == lowest)
+        {
+            // the ancestors are unaffected
+            break;
+        }
+        _nextTimePoints[node] = lowest;
+    }
+}
+
 void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
 {
     Lock lock{_mx};
@@ -101,12 +163,8 @@ bool TimeConfiguration::OtherParticipantHasLowerTimepoint() const
 {
     Lock lock{_mx};
 
-    for (const auto& otherTask : _otherNextTasks)
-    {
-        if (_myNextTask.timePoint > otherTask.second.timePoint)
-            return true;
-    }
-    return false;
+    // the root of the tournament tree is the lowest next time point of the other participants
+    return _leafCount != 0 && _myNextTask.timePoint > _nextTimePoints[1];
 }
 
 void TimeConfiguration::Initialize()
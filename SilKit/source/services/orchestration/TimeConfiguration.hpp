@@ -19,13 +19,16 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#pragma once
+
 #include <string>
 #include <chrono>
-#include <map>
 #include <mutex>
-
+#include <unordered_map>
+#include <vector>
 
 #include "OrchestrationDatatypes.hpp"
+#include "EndpointAddress.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -40,6 +43,8 @@ public: //Methods
     void SetBlockingMode(bool blocking);
     void SynchronizedParticipantAdded(const std::string& otherParticipantName);
     void OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep);
+    //! Identifies the participant by the id of its service descriptor, i.e., the hash of its name
+    void OnReceiveNextSimStep(Core::ParticipantId participantId, NextSimTask nextStep);
     void SynchronizedParticipantRemoved(const std::string& otherParticipantName);
     void SetStepDuration(std::chrono::nanoseconds duration);
     void AdvanceTimeStep();
@@ -49,12 +54,24 @@ public: //Methods
     void Initialize();
     bool IsBlocking() const;
 
+private: //Methods
+    //! Returns the dense index of the participant, which is assigned when the participant is seen first
+    auto GetOrAddParticipantIndex(Core::ParticipantId participantId) -> std::size_t;
+    void UpdateNextTimePoint(std::size_t index, std::chrono::nanoseconds timePoint);
+
 private: //Members
     mutable std::mutex _mx;
     using Lock = std::unique_lock<decltype(_mx)>;
     NextSimTask _currentTask;
     NextSimTask _myNextTask;
-    std::map<std::string, NextSimTask> _otherNextTasks;
+    // The other participants are identified by dense indices, freed indices are reused
+    std::unordered_map<Core::ParticipantId, std::size_t> _participantIndices;
+    std::vector<std::size_t> _freeParticipantIndices;
+    // Tournament tree over the next time points of the other participants: the leaves hold the time points in the
+    // order of the participant indices, each inner node holds the minimum of its children. The root at index 1 is
+    // the lowest next time point of all other participants.
+    std::vector<std::chrono::nanoseconds> _nextTimePoints;
+    std::size_t _leafCount{0};
     bool _blocking;
 };
 
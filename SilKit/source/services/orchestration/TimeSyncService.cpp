@@ -77,6 +77,7 @@ public:
 
     void RequestInitialStep() override
     {
+        _participant->FlushSendBuffers();
         _controller.SendMsg(_configuration->NextSimStep());
         // Bootstrap checked execution, in case there is no other participant.
         // Else, checked execution is initiated when we receive their NextSimTask messages.
@@ -93,6 +94,8 @@ public:
 
     void RequestNextStep() override
     {
+        // the messages of the completed step must arrive before the peers may advance their time
+        _participant->FlushSendBuffers();
         _controller.SendMsg(_configuration->NextSimStep());
         _participant->ExecuteDeferred([this]() {
             this->ProcessSimulationTimeUpdate();
@@ -101,7 +104,7 @@ public:
 
     void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) override
     {
-        _configuration->OnReceiveNextSimStep(from->GetServiceDescriptor().GetParticipantName(), task);
+        _configuration->OnReceiveNextSimStep(from->GetServiceDescriptor().GetParticipantId(), task);
 
         switch (_controller.State())
         {
@@ -0,0 +1,203 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "TimerService.hpp"
+
+#include <algorithm>
+
+#include "SetThreadName.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::chrono::nanoseconds TickDuration = 1ms;
+
+struct SteadyClock : public SilKit::Services::Orchestration::TimerService::IClock
+{
+    auto Now() const -> std::chrono::nanoseconds override
+    {
+        return std::chrono::steady_clock::now().time_since_epoch();
+    }
+};
+
+auto GetSteadyClock() -> SilKit::Services::Orchestration::TimerService::IClock*
+{
+    static SteadyClock steadyClock{};
+    return &steadyClock;
+}
+
+} // namespace
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+
+// ================================================================================
+//  TimerService
+// ================================================================================
+
+TimerService::TimerService(IClock* clock, std::chrono::nanoseconds maxSleep)
+    : _clock{clock ? clock : GetSteadyClock()}
+    , _maxSleep{maxSleep}
+    , _epoch{_clock->Now()}
+{
+    _thread = std::thread{&TimerService::Run, this};
+}
+
+TimerService::~TimerService()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _stop = true;
+    }
+    _wakeUp.notify_all();
+    _thread.join();
+}
+
+auto TimerService::GetProcessWide() -> std::shared_ptr<TimerService>
+{
+    static std::mutex mutex;
+    static std::weak_ptr<TimerService> processWide;
+
+    std::unique_lock<decltype(mutex)> lock{mutex};
+    auto service = processWide.lock();
+    if (!service)
+    {
+        service = std::make_shared<TimerService>();
+        processWide = service;
+    }
+    return service;
+}
+
+auto TimerService::Now() const -> std::chrono::nanoseconds
+{
+    return _clock->Now();
+}
+
+void TimerService::Arm(Timer& timer, std::chrono::nanoseconds deadline)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    // round up, a timer must never expire before its deadline
+    const auto tick = ToTick(deadline + TickDuration - std::chrono::nanoseconds{1});
+    _wheel.Schedule(timer, tick);
+
+    // only wake the thread if it would sleep past the new deadline
+    if (tick < _wakeUpTick)
+    {
+        _wakeUpTick = tick;
+        lock.unlock();
+        _wakeUp.notify_one();
+    }
+}
+
+void TimerService::Disarm(Timer& timer, bool waitForHandler)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _wheel.Cancel(timer);
+
+    // a handler which destroys its own timer must not wait for itself
+    if (waitForHandler && std::this_thread::get_id() != _thread.get_id())
+    {
+        _handlerDone.wait(lock, [this, &timer] { return _runningTimer != &timer; });
+    }
+}
+
+void TimerService::Run()
+{
+    Util::SetThreadName("SilKit-Timers");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    while (!_stop)
+    {
+        if (_wheel.Empty())
+        {
+            _wakeUpTick = Util::TimerWheel::NoDeadline();
+            _wakeUp.wait(lock, [this] { return _stop || !_wheel.Empty(); });
+            continue;
+        }
+
+        _wheel.Advance(ToTick(_clock->Now()));
+
+        while (auto* entry = _wheel.PopExpired())
+        {
+            auto* timer = static_cast<Timer*>(entry);
+            _runningTimer = timer;
+            lock.unlock();
+            timer->_handler();
+            lock.lock();
+            _runningTimer = nullptr;
+            _handlerDone.notify_all();
+        }
+
+        if (_stop || _wheel.Empty())
+        {
+            continue;
+        }
+
+        const auto plannedTick = _wheel.NextDeadline();
+        _wakeUpTick = plannedTick;
+        const auto untilDeadline = _epoch + TickDuration * static_cast<std::chrono::nanoseconds::rep>(plannedTick)
+                                    - _clock->Now();
+        const auto sleep = std::min(std::max(untilDeadline, std::chrono::nanoseconds{0}), _maxSleep);
+        // Arm lowers _wakeUpTick if a timer expires earlier than planned
+        _wakeUp.wait_for(lock, sleep, [this, plannedTick] { return _stop || _wakeUpTick < plannedTick; });
+    }
+}
+
+auto TimerService::ToTick(std::chrono::nanoseconds time) const -> Util::TimerWheel::Tick
+{
+    if (time <= _epoch)
+    {
+        return 0;
+    }
+    return static_cast<Util::TimerWheel::Tick>((time - _epoch) / TickDuration);
+}
+
+// ================================================================================
+//  TimerService::Timer
+// ================================================================================
+
+TimerService::Timer::Timer(std::shared_ptr<TimerService> service, std::function<void()> handler)
+    : _service{std::move(service)}
+    , _handler{std::move(handler)}
+{
+}
+
+TimerService::Timer::~Timer()
+{
+    _service->Disarm(*this, true);
+}
+
+void TimerService::Timer::ArmAt(std::chrono::nanoseconds deadline)
+{
+    _service->Arm(*this, deadline);
+}
+
+void TimerService::Timer::Disarm()
+{
+    _service->Disarm(*this, false);
+}
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
@@ -0,0 +1,135 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "TimerWheel.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+
+/*! \brief Process-wide service for one-shot deadlines, e.g., the timeouts of the WatchDog
+ *
+ *  All timers of a service share a single thread and a hierarchical timer wheel with a resolution of one
+ *  millisecond. Arming and disarming a timer is O(1). The thread sleeps until the next deadline and does not wake
+ *  up at all while no timer is armed.
+ */
+class TimerService
+{
+public:
+    struct IClock
+    {
+        virtual ~IClock() = default;
+
+        /// Returns the current time in nanoseconds since the start of the current epoch.
+        virtual auto Now() const -> std::chrono::nanoseconds = 0;
+    };
+
+    class Timer;
+
+public:
+    // ----------------------------------------
+    // Constructors, Destructor, and Assignment
+
+    /*! \param clock Clock for the deadlines; the steady clock if nullptr
+     *  \param maxSleep Upper bound for the time between two readings of the clock. Only needed for clocks that do
+     *         not advance with the wall-clock time.
+     */
+    explicit TimerService(IClock* clock = nullptr,
+                          std::chrono::nanoseconds maxSleep = std::chrono::nanoseconds::max());
+    ~TimerService();
+
+    TimerService(const TimerService&) = delete;
+    TimerService& operator=(const TimerService&) = delete;
+
+    //! The service shared by all users in the process. It is destroyed when the last user releases it.
+    static auto GetProcessWide() -> std::shared_ptr<TimerService>;
+
+public:
+    // ----------------------------------------
+    // Public Methods
+    auto Now() const -> std::chrono::nanoseconds;
+
+private:
+    // ----------------------------------------
+    // private methods
+    friend class Timer;
+
+    void Arm(Timer& timer, std::chrono::nanoseconds deadline);
+    void Disarm(Timer& timer, bool waitForHandler);
+
+    void Run();
+
+    auto ToTick(std::chrono::nanoseconds time) const -> Util::TimerWheel::Tick;
+
+private:
+    // ----------------------------------------
+    // private members
+    IClock* _clock;
+    std::chrono::nanoseconds _maxSleep;
+    // clock time of tick zero
+    std::chrono::nanoseconds _epoch;
+
+    std::mutex _mutex;
+    std::condition_variable _wakeUp;
+    std::condition_variable _handlerDone;
+    Util::TimerWheel _wheel;
+    // the tick at which the thread wakes up next
+    Util::TimerWheel::Tick _wakeUpTick{Util::TimerWheel::NoDeadline()};
+    Timer* _runningTimer{nullptr};
+    bool _stop{false};
+
+    std::thread _thread;
+};
+
+//! \brief A one-shot timer of a TimerService; the handler is called on the thread of the service
+class TimerService::Timer : private Util::TimerWheel::Entry
+{
+public:
+    Timer(std::shared_ptr<TimerService> service, std::function<void()> handler);
+    //! Disarms the timer and waits for a running handler to return
+    ~Timer();
+
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+    //! Arms the timer for the given clock time of the service. A timer that is already armed is re-armed.
+    void ArmAt(std::chrono::nanoseconds deadline);
+    void Disarm();
+
+private:
+    friend class TimerService;
+
+    std::shared_ptr<TimerService> _service;
+    std::function<void()> _handler;
+};
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
@@ -19,16 +19,21 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
-#include <iostream>
-
 #include "WatchDog.hpp"
-#include "SetThreadName.hpp"
 
 using namespace std::chrono_literals;
 
 namespace {
 
-auto GetDefaultClock() -> SilKit::Services::Orchestration::WatchDog::IClock*;
+// injected clocks only advance when they are read, e.g., in tests
+constexpr std::chrono::milliseconds InjectedClockResolution{2};
+
+auto MakeTimerService(SilKit::Services::Orchestration::WatchDog::IClock* clock)
+    -> std::shared_ptr<SilKit::Services::Orchestration::TimerService>
+{
+    using SilKit::Services::Orchestration::TimerService;
+    return clock ? std::make_shared<TimerService>(clock, InjectedClockResolution) : TimerService::GetProcessWide();
+}
 
 } // namespace
 
@@ -37,9 +42,11 @@ namespace Services {
 namespace Orchestration {
 
 WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock)
-    : _clock{clock ? clock : GetDefaultClock()}
-    , _warnHandler{[](std::chrono::milliseconds) {}}
+    : _warnHandler{[](std::chrono::milliseconds) {}}
     , _errorHandler{[](std::chrono::milliseconds) {}}
+    , _timerService{MakeTimerService(clock)}
+    , _warnTimer{_timerService, [this] { OnTimeout(_warnHandler); }}
+    , _errorTimer{_timerService, [this] { OnTimeout(_errorHandler); }}
 {
     if (healthCheckConfig.softResponseTimeout.has_value())
     {
@@ -54,23 +61,29 @@ WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock)
         if (_errorTimeout <= 0ms)
             throw SilKitError{"WatchDog requires errorTimeout > 0ms"};
     }
-    _watchThread = std::thread{&WatchDog::Run, this};
-}
-
-WatchDog::~WatchDog()
-{
-    _stopPromise.set_value();
-    _watchThread.join();
 }
 
 void WatchDog::Start()
 {
-    _startTime.store(_clock->Now());
+    const auto startTime = _timerService->Now();
+    _startTime.store(startTime);
+
+    // the warning is skipped if the job is already overdue when the soft timeout expires
+    if (_warnTimeout != _defaultTimeout && _warnTimeout < _errorTimeout)
+    {
+        _warnTimer.ArmAt(startTime + _warnTimeout);
+    }
+    if (_errorTimeout != _defaultTimeout)
+    {
+        _errorTimer.ArmAt(startTime + _errorTimeout);
+    }
 }
 
 void WatchDog::Reset()
 {
     _startTime.store(std::chrono::nanoseconds::min());
+    _warnTimer.Disarm();
+    _errorTimer.Disarm();
 }
 
 void WatchDog::SetWarnHandler(std::function<void(std::chrono::milliseconds)> handler)
@@ -83,69 +96,16 @@ void WatchDog::SetErrorHandler(std::function<void(std::chrono::milliseconds)> ha
     _errorHandler = std::move(handler);
 }
 
-void WatchDog::Run()
+void WatchDog::OnTimeout(const std::function<void(std::chrono::milliseconds)>& handler)
 {
-    enum class WatchDogState
-    {
-        Healthy,
-        Warn,
-        Error
-    };
-
-    SilKit::Util::SetThreadName("SilKit-Watchdog");
-    WatchDogState state = WatchDogState::Healthy;
-    auto stopFuture = _stopPromise.get_future();
-
-    while (true)
+    const auto startTime = _startTime.load();
+    if (startTime == std::chrono::nanoseconds::min())
     {
-        auto futureStatus = stopFuture.wait_for(_resolution);
-
-        if (futureStatus == std::future_status::ready)
-        {
-            // stop was signaled; stopping thread;
-            return;
-        }
-
-        const auto startTime = _startTime.load();
-
-        // We only communicate with the "main thread" via the atomic _startTime.
-        // If _startTime is duration::min(), Start() has not yet been called.
-        // Otherwise, _startTime is the duration since epoch when the Start() was called.
-        if (startTime == std::chrono::nanoseconds::min())
-        {
-            // no job is currently running. Reset state and continue.
-            state = WatchDogState::Healthy;
-            continue;
-        }
-
-        // These declarations are after the startTime check to prevent integer overflow
-        // by deferring arithmetic on duration::min() until Start() was called.
-        const auto now = _clock->Now();
-        const auto currentRunDuration = std::chrono::duration_cast<std::chrono::milliseconds>(now - startTime);
-
-        if (currentRunDuration > _warnTimeout && currentRunDuration <= _errorTimeout)
-        {
-            if (state == WatchDogState::Healthy)
-            {
-                _warnHandler(currentRunDuration);
-                state = WatchDogState::Warn;
-            }
-            continue;
-        }
-
-        if (currentRunDuration > _errorTimeout)
-        {
-            if (state != WatchDogState::Error)
-            {
-                _errorHandler(currentRunDuration);
-                state = WatchDogState::Error;
-            }
-            continue;
-        }
-
-        // If neither warning, nor error timeouts were hit, the state is healthy.
-        state = WatchDogState::Healthy;
+        // reset while the timer expired
+        return;
     }
+
+    handler(std::chrono::duration_cast<std::chrono::milliseconds>(_timerService->Now() - startTime));
 }
 
 // For testing purposes only
@@ -163,20 +123,3 @@ std::chrono::milliseconds WatchDog::GetErrorTimeout()
 } // namespace Services
 } // namespace SilKit
 
-namespace {
-
-struct SteadyClock : public SilKit::Services::Orchestration::WatchDog::IClock
-{
-    auto Now() const -> std::chrono::nanoseconds override
-    {
-        return std::chrono::steady_clock::now().time_since_epoch();
-    }
-};
-
-auto GetDefaultClock() -> SilKit::Services::Orchestration::WatchDog::IClock*
-{
-    static SteadyClock steadyClock{};
-    return &steadyClock;
-}
-
-} // namespace
@@ -22,32 +22,28 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <atomic>
-#include <future>
 #include <chrono>
+#include <functional>
 #include <memory>
 
 #include "ParticipantConfiguration.hpp"
+#include "TimerService.hpp"
 
 namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
+//! \brief Reports a warning and an error if a job runs longer than the soft and hard response timeouts
 class WatchDog
 {
 public:
-    struct IClock
-    {
-        virtual ~IClock() = default;
-
-        /// Returns the current time in nanoseconds since the start of the current epoch.
-        virtual auto Now() const -> std::chrono::nanoseconds = 0;
-    };
+    using IClock = TimerService::IClock;
 
 public:
     // ----------------------------------------
     // Constructors, Destructor, and Assignment
+    //! Uses the process-wide TimerService, unless a clock is injected
     WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock = nullptr);
-    ~WatchDog();
 
 public:
     // ----------------------------------------
@@ -65,7 +61,7 @@ public:
 private:
     // ----------------------------------------
     // private methods
-    void Run();
+    void OnTimeout(const std::function<void(std::chrono::milliseconds)>& handler);
 
 public:
     const std::chrono::milliseconds _defaultTimeout = std::chrono::milliseconds::max();
@@ -73,20 +69,20 @@ public:
 private:
     // ----------------------------------------
     // private members
-    std::promise<void> _stopPromise;
-    /// Clock used for watchdog timing. Can be injected via the constructor.
-    IClock* _clock;
     // we use a duration instead of a timepoint to avoid a bug in clang6 (up to v9.0)
     std::atomic<std::chrono::nanoseconds> _startTime{std::chrono::nanoseconds::min()};
 
-    std::chrono::milliseconds _resolution = std::chrono::milliseconds{2};
     std::chrono::milliseconds _warnTimeout = _defaultTimeout;
     std::chrono::milliseconds _errorTimeout = _defaultTimeout;
 
     std::function<void(std::chrono::milliseconds)> _warnHandler;
     std::function<void(std::chrono::milliseconds)> _errorHandler;
 
-    std::thread _watchThread;
+    /// Provides the clock used for watchdog timing, which can be injected via the constructor.
+    std::shared_ptr<TimerService> _timerService;
+    // NB: the timers are destroyed first, they wait for running handlers
+    TimerService::Timer _warnTimer;
+    TimerService::Timer _errorTimer;
 };
 
 } // namespace Orchestration
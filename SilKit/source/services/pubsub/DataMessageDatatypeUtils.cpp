@@ -39,6 +39,11 @@ bool operator==(const WireDataMessageEvent& lhs, const WireDataMessageEvent& rhs
     return ToDataMessageEvent(lhs) == ToDataMessageEvent(rhs);
 }
 
+bool operator==(const WireDataMessageBatchEvent& lhs, const WireDataMessageBatchEvent& rhs)
+{
+    return lhs.messages == rhs.messages;
+}
+
 bool MatchMediaType(const std::string& subMediaType, const std::string& pubMediaType)
 {
     return subMediaType == "" || subMediaType == pubMediaType;
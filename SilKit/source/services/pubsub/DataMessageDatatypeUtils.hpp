@@ -39,6 +39,8 @@ bool operator==(const DataMessageEvent& lhs, const DataMessageEvent& rhs);
 
 bool operator==(const WireDataMessageEvent& lhs, const WireDataMessageEvent& rhs);
 
+bool operator==(const WireDataMessageBatchEvent& lhs, const WireDataMessageBatchEvent& rhs);
+
 bool MatchMediaType(const std::string& subMediaType, const std::string& pubMediaType);
 
 } // namespace PubSub
@@ -43,13 +43,96 @@ DataPublisher::DataPublisher(Core::IParticipantInternal* participant,
     , _participant{participant}
     , _config{config}
 {
+    using Mode = Config::DataPublisherAggregation::Mode;
+    if (_config.aggregation.mode != Mode::Off)
+    {
+        // Both modes send the pending messages before the participant announces a new simulation step or state
+        _flushHandlerId = _participant->AddSendBufferFlushHandler([this] { FlushBatch(); });
+    }
+    if (_config.aggregation.mode == Mode::TimeWindow)
+    {
+        _batchTimer = std::make_unique<Orchestration::TimerService::Timer>(
+            Orchestration::TimerService::GetProcessWide(), [this] { FlushBatch(); });
+    }
+}
+
+DataPublisher::~DataPublisher()
+{
+    if (_config.aggregation.mode != Config::DataPublisherAggregation::Mode::Off)
+    {
+        // Returns only after a FlushBatch running on another thread (e.g., the I/O thread) returned
+        _participant->RemoveSendBufferFlushHandler(_flushHandlerId);
+    }
 }
 
 void DataPublisher::PublishInternal(Util::Span<const uint8_t> data)
 {
     WireDataMessageEvent msg{_timeProvider->Now(), data};
     _tracer.Trace(SilKit::Services::TransmitDirection::TX, msg.timestamp, ToDataMessageEvent(msg));
-    _participant->SendMsg(this, msg);
+    if (IsAggregating())
+    {
+        AddToBatch(std::move(msg));
+    }
+    else
+    {
+        _participant->SendMsg(this, msg);
+    }
+}
+
+auto DataPublisher::IsAggregating() const -> bool
+{
+    switch (_config.aggregation.mode)
+    {
+    case Config::DataPublisherAggregation::Mode::SimulationStep:
+        // Without virtual time synchronization there is no end of a simulation step to wait for
+        return _timeProvider->IsSynchronizingVirtualTime();
+    case Config::DataPublisherAggregation::Mode::TimeWindow:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void DataPublisher::AddToBatch(WireDataMessageEvent msg)
+{
+    std::unique_lock<decltype(_batchMutex)> lock{_batchMutex};
+
+    _batch.messages.emplace_back(std::move(msg));
+
+    if (_batch.messages.size() >= _config.aggregation.maxBatchSize)
+    {
+        SendBatchLocked();
+    }
+    else if (_batchTimer && _batch.messages.size() == 1)
+    {
+        // the window starts with the first message of a batch
+        auto timerService = Orchestration::TimerService::GetProcessWide();
+        _batchTimer->ArmAt(timerService->Now() + _config.aggregation.timeWindow);
+    }
+}
+
+void DataPublisher::FlushBatch()
+{
+    std::unique_lock<decltype(_batchMutex)> lock{_batchMutex};
+    SendBatchLocked();
+}
+
+void DataPublisher::SendBatchLocked()
+{
+    if (_batchTimer)
+    {
+        _batchTimer->Disarm();
+    }
+    if (_batch.messages.empty())
+    {
+        return;
+    }
+
+    // sent while holding the lock, so concurrent flushes cannot reorder the batches
+    WireDataMessageBatchEvent batch;
+    batch.messages.reserve(_batch.messages.size());
+    std::swap(batch, _batch);
+    _participant->SendMsg(this, std::move(batch));
 }
 
 void DataPublisher::Publish(Util::Span<const uint8_t> data)
@@ -61,6 +144,16 @@ void DataPublisher::Publish(Util::Span<const uint8_t> data)
     PublishInternal(data);
 }
 
+void DataPublisher::PublishBatch(Util::Span<const Util::Span<const uint8_t>> data)
+{
+    _participant->SendMsgBatch([this, data]() {
+        for (const auto& value : data)
+        {
+            Publish(value);
+        }
+    });
+}
+
 void DataPublisher::ReplayMessage(const SilKit::IReplayMessage* message)
 {
     using namespace SilKit::Tracing;
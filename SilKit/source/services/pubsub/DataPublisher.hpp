@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "silkit/services/pubsub/IDataPublisher.hpp"
@@ -30,6 +32,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IParticipantInternal.hpp"
 #include "ITraceMessageSource.hpp"
 #include "IReplayDataController.hpp"
+#include "TimerService.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -50,10 +53,12 @@ public:
                   const std::string& pubUUID,
                   const Config::DataPublisher& config  
     );
+    ~DataPublisher() override;
 
 
 public: // Methods
     void Publish(Util::Span<const uint8_t> data) override;
+    void PublishBatch(Util::Span<const Util::Span<const uint8_t>> data) override;
 
     //SilKit::Services::Orchestration::ITimeConsumer
     void SetTimeProvider(Services::Orchestration::ITimeProvider* provider) override;
@@ -71,6 +76,11 @@ public: // Methods
     void ReplayMessage(const SilKit::IReplayMessage *message) override;
 private: // Methods
     void PublishInternal(Util::Span<const uint8_t> data);
+    auto IsAggregating() const -> bool;
+    void AddToBatch(WireDataMessageEvent msg);
+    //! Sends the aggregated messages, if any
+    void FlushBatch();
+    void SendBatchLocked();
 
 private: // Member
     std::string _topic;
@@ -84,6 +94,13 @@ private: // Member
     Core::IParticipantInternal* _participant{nullptr};
 
     Config::DataPublisher _config;
+
+    // Aggregation of published messages, see Config::DataPublisherAggregation
+    std::mutex _batchMutex;
+    WireDataMessageBatchEvent _batch;
+    Util::HandlerId _flushHandlerId{};
+    // Declared last: it is destroyed, and its running handler returns, before the batch is destroyed
+    std::unique_ptr<Orchestration::TimerService::Timer> _batchTimer;
 };
 
 // ================================================================================
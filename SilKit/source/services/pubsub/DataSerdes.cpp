@@ -39,6 +39,19 @@ inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buff
     return buffer;
 }
 
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer,
+                                              const WireDataMessageBatchEvent& msg)
+{
+    buffer << msg.messages;
+    return buffer;
+}
+
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer, WireDataMessageBatchEvent& msg)
+{
+    buffer >> msg.messages;
+    return buffer;
+}
+
 void Serialize(SilKit::Core::MessageBuffer& buffer, const WireDataMessageEvent& msg)
 {
     buffer << msg;
@@ -50,6 +63,16 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageEvent& out)
     buffer >> out;
 }
 
+void Serialize(SilKit::Core::MessageBuffer& buffer, const WireDataMessageBatchEvent& msg)
+{
+    buffer << msg;
+}
+
+void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageBatchEvent& out)
+{
+    buffer >> out;
+}
+
 } // namespace PubSub    
 } // namespace Services
 } // namespace SilKit
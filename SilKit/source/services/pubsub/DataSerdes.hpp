@@ -33,6 +33,9 @@ namespace PubSub {
 void Serialize(SilKit::Core::MessageBuffer& buffer, const WireDataMessageEvent& msg);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageEvent& out);
 
+void Serialize(SilKit::Core::MessageBuffer& buffer, const WireDataMessageBatchEvent& msg);
+void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageBatchEvent& out);
+
 } // namespace PubSub    
 } // namespace Services
 } // namespace SilKit
@@ -63,6 +63,20 @@ void DataSubscriberInternal::ReceiveMsg(const IServiceEndpoint* /*from*/, const
     ReceiveInternal(dataMessageEvent);
 }
 
+void DataSubscriberInternal::ReceiveMsg(const IServiceEndpoint* /*from*/,
+                                        const WireDataMessageBatchEvent& dataMessageBatchEvent)
+{
+    if (Tracing::IsReplayEnabledFor(_replayConfig, Config::Replay::Direction::Receive))
+    {
+        return;
+    }
+
+    for (const auto& dataMessageEvent : dataMessageBatchEvent.messages)
+    {
+        ReceiveInternal(dataMessageEvent);
+    }
+}
+
 void DataSubscriberInternal::ReceiveInternal(const WireDataMessageEvent& dataMessageEvent)
 {
 
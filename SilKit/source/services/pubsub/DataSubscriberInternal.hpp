@@ -51,6 +51,8 @@ public: //Methods
     
     //! \brief Accepts messages originating from SilKit communications.
     void ReceiveMsg(const IServiceEndpoint* from, const WireDataMessageEvent& dataMessageEvent) override;
+    //! \brief Accepts the messages of an aggregating publisher, which are handled in their original order.
+    void ReceiveMsg(const IServiceEndpoint* from, const WireDataMessageBatchEvent& dataMessageBatchEvent) override;
 
     //SilKit::Services::Orchestration::ITimeConsumer
     void SetTimeProvider(Services::Orchestration::ITimeProvider* provider) override;
@@ -21,6 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataPublisher.hpp"
 
+#include <atomic>
+#include <future>
+#include <thread>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -45,8 +49,23 @@ class MockParticipant : public DummyParticipant
 {
 public:
     MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const WireDataMessageEvent&), (override));
+    MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const WireDataMessageBatchEvent&), (override));
+
+    void SendMsg(const IServiceEndpoint* from, WireDataMessageBatchEvent&& msg) override
+    {
+        SendMsg(from, static_cast<const WireDataMessageBatchEvent&>(msg));
+    }
 };
 
+auto MakeAggregationConfig(Config::DataPublisherAggregation::Mode mode, uint32_t maxBatchSize = 256)
+    -> Config::DataPublisher
+{
+    Config::DataPublisher config;
+    config.aggregation.mode = mode;
+    config.aggregation.maxBatchSize = maxBatchSize;
+    return config;
+}
+
 SilKit::Services::PubSub::PubSubSpec testDataNodeSpec{"Topic", {}};
 
 class DataPublisherTest : public ::testing::Test
@@ -76,4 +95,138 @@ TEST_F(DataPublisherTest, publish)
     publisher.Publish(sampleData);
 }
 
+TEST_F(DataPublisherTest, simulation_step_aggregation_sends_one_batch_on_flush)
+{
+    using Mode = Config::DataPublisherAggregation::Mode;
+    DataPublisher aggregatingPublisher{&participant, &participant.mockTimeProvider, testDataNodeSpec, "pubUUID",
+                                       MakeAggregationConfig(Mode::SimulationStep)};
+    aggregatingPublisher.SetServiceDescriptor(portAddress);
+
+    ON_CALL(participant.mockTimeProvider, IsSynchronizingVirtualTime()).WillByDefault(Return(true));
+    EXPECT_CALL(participant.mockTimeProvider, Now()).WillOnce(Return(1ms)).WillOnce(Return(2ms));
+
+    WireDataMessageBatchEvent sentBatch;
+    EXPECT_CALL(participant, SendMsg(&aggregatingPublisher, A<const WireDataMessageEvent&>())).Times(0);
+    EXPECT_CALL(participant, SendMsg(&aggregatingPublisher, A<const WireDataMessageBatchEvent&>()))
+        .WillOnce(SaveArg<1>(&sentBatch));
+
+    aggregatingPublisher.Publish(sampleData);
+    aggregatingPublisher.Publish(std::vector<uint8_t>{42u});
+    participant.FlushSendBuffers();
+    // nothing is pending anymore
+    participant.FlushSendBuffers();
+
+    ASSERT_EQ(sentBatch.messages.size(), 2u);
+    EXPECT_EQ(sentBatch.messages[0].timestamp, 1ms);
+    EXPECT_TRUE(ItemsAreEqual(sentBatch.messages[0].data.AsSpan(), Util::ToSpan(sampleData)));
+    EXPECT_EQ(sentBatch.messages[1].timestamp, 2ms);
+    EXPECT_EQ(sentBatch.messages[1].data.AsSpan().size(), 1u);
+}
+
+TEST_F(DataPublisherTest, simulation_step_aggregation_without_time_synchronization_publishes_directly)
+{
+    using Mode = Config::DataPublisherAggregation::Mode;
+    DataPublisher aggregatingPublisher{&participant, &participant.mockTimeProvider, testDataNodeSpec, "pubUUID",
+                                       MakeAggregationConfig(Mode::SimulationStep)};
+
+    ON_CALL(participant.mockTimeProvider, IsSynchronizingVirtualTime()).WillByDefault(Return(false));
+
+    EXPECT_CALL(participant, SendMsg(&aggregatingPublisher, A<const WireDataMessageEvent&>())).Times(1);
+    EXPECT_CALL(participant, SendMsg(&aggregatingPublisher, A<const WireDataMessageBatchEvent&>())).Times(0);
+
+    aggregatingPublisher.Publish(sampleData);
+    participant.FlushSendBuffers();
+}
+
+TEST_F(DataPublisherTest, aggregation_sends_full_batches_immediately)
+{
+    using Mode = Config::DataPublisherAggregation::Mode;
+    DataPublisher aggregatingPublisher{&participant, &participant.mockTimeProvider, testDataNodeSpec, "pubUUID",
+                                       MakeAggregationConfig(Mode::SimulationStep, 2)};
+
+    ON_CALL(participant.mockTimeProvider, IsSynchronizingVirtualTime()).WillByDefault(Return(true));
+
+    std::vector<size_t> batchSizes;
+    EXPECT_CALL(participant, SendMsg(&aggregatingPublisher, A<const WireDataMessageBatchEvent&>()))
+        .Times(3)
+        .WillRepeatedly([&batchSizes](const IServiceEndpoint*, const WireDataMessageBatchEvent& batch) {
+            batchSizes.push_back(batch.messages.size());
+        });
+
+    for (int i = 0; i < 5; ++i)
+    {
+        aggregatingPublisher.Publish(sampleData);
+    }
+    participant.FlushSendBuffers();
+
+    EXPECT_EQ(batchSizes, (std::vector<size_t>{2, 2, 1}));
+}
+
+TEST_F(DataPublisherTest, destruction_waits_for_flush_on_other_thread)
+{
+    using Mode = Config::DataPublisherAggregation::Mode;
+    auto aggregatingPublisher = std::make_unique<DataPublisher>(
+        &participant, &participant.mockTimeProvider, testDataNodeSpec, "pubUUID",
+        MakeAggregationConfig(Mode::SimulationStep));
+
+    ON_CALL(participant.mockTimeProvider, IsSynchronizingVirtualTime()).WillByDefault(Return(true));
+
+    std::promise<void> flushEntered;
+    std::promise<void> releaseFlush;
+    auto releaseFlushFuture = releaseFlush.get_future();
+    std::atomic<bool> flushReturned{false};
+    std::atomic<bool> destroyed{false};
+    std::atomic<bool> flushReturnedBeforeDestruction{false};
+
+    EXPECT_CALL(participant, SendMsg(_, A<const WireDataMessageBatchEvent&>()))
+        .WillOnce([&](const IServiceEndpoint*, const WireDataMessageBatchEvent&) {
+            flushEntered.set_value();
+            releaseFlushFuture.wait();
+            flushReturned = true;
+            flushReturnedBeforeDestruction = !destroyed.load();
+        });
+
+    aggregatingPublisher->Publish(sampleData);
+
+    auto flusher = std::thread{[this] { participant.FlushSendBuffers(); }};
+    flushEntered.get_future().wait();
+
+    auto destroyer = std::thread{[&aggregatingPublisher, &destroyed] {
+        aggregatingPublisher.reset();
+        destroyed = true;
+    }};
+
+    // the flush handler is still running, so the publisher must not be destroyed yet
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(destroyed.load());
+
+    releaseFlush.set_value();
+    destroyer.join();
+    flusher.join();
+
+    EXPECT_TRUE(flushReturned.load());
+    EXPECT_TRUE(flushReturnedBeforeDestruction.load());
+}
+
+TEST_F(DataPublisherTest, time_window_aggregation_sends_batch_after_window)
+{
+    using Mode = Config::DataPublisherAggregation::Mode;
+    DataPublisher aggregatingPublisher{&participant, &participant.mockTimeProvider, testDataNodeSpec, "pubUUID",
+                                       MakeAggregationConfig(Mode::TimeWindow)};
+
+    std::promise<size_t> batchSent;
+    EXPECT_CALL(participant, SendMsg(&aggregatingPublisher, A<const WireDataMessageBatchEvent&>()))
+        .WillOnce([&batchSent](const IServiceEndpoint*, const WireDataMessageBatchEvent& batch) {
+            batchSent.set_value(batch.messages.size());
+        });
+
+    aggregatingPublisher.Publish(sampleData);
+    aggregatingPublisher.Publish(sampleData);
+    aggregatingPublisher.Publish(sampleData);
+
+    auto batchSize = batchSent.get_future();
+    ASSERT_EQ(batchSize.wait_for(5s), std::future_status::ready);
+    EXPECT_EQ(batchSize.get(), 3u);
+}
+
 } // anonymous namespace
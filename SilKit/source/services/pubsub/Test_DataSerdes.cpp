@@ -55,3 +55,23 @@ TEST(MwVAsioSerdes, SimData_LargeDataMessage)
     EXPECT_EQ(in, out);
 }
 
+TEST(MwVAsioSerdes, SimData_DataMessageBatch)
+{
+    using namespace SilKit::Services::PubSub;
+    using namespace SilKit::Core;
+
+    SilKit::Core::MessageBuffer buffer;
+    WireDataMessageBatchEvent in, out;
+    in.messages.push_back(WireDataMessageEvent{1ms, std::vector<uint8_t>{1, 2, 3}});
+    in.messages.push_back(WireDataMessageEvent{2ms, std::vector<uint8_t>{}});
+    in.messages.push_back(WireDataMessageEvent{3ms, std::vector<uint8_t>(2000, 'D')});
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    ASSERT_EQ(in.messages.size(), out.messages.size());
+    for (size_t i = 0; i < in.messages.size(); ++i)
+    {
+        EXPECT_EQ(in.messages[i], out.messages[i]);
+    }
+}
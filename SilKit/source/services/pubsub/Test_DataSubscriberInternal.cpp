@@ -79,4 +79,26 @@ TEST_F(DataSubscriberInternalTest, trigger_default_data_handler)
 
     subscriber.ReceiveMsg(&subscriberOther, msg);
 }
+
+TEST_F(DataSubscriberInternalTest, batch_is_delivered_in_order_with_original_timestamps)
+{
+    WireDataMessageBatchEvent batch;
+    batch.messages.push_back(WireDataMessageEvent{1ms, std::vector<uint8_t>{1u}});
+    batch.messages.push_back(WireDataMessageEvent{2ms, std::vector<uint8_t>{2u, 2u}});
+    batch.messages.push_back(WireDataMessageEvent{3ms, std::vector<uint8_t>{3u, 3u, 3u}});
+
+    std::vector<std::chrono::nanoseconds> timestamps;
+    std::vector<size_t> sizes;
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, _))
+        .Times(3)
+        .WillRepeatedly([&](IDataSubscriber*, const DataMessageEvent& dataMessageEvent) {
+            timestamps.push_back(dataMessageEvent.timestamp);
+            sizes.push_back(dataMessageEvent.data.size());
+        });
+
+    subscriber.ReceiveMsg(&subscriberOther, batch);
+
+    EXPECT_EQ(timestamps, (std::vector<std::chrono::nanoseconds>{1ms, 2ms, 3ms}));
+    EXPECT_EQ(sizes, (std::vector<size_t>{1, 2, 3}));
+}
 } // anonymous namespace
@@ -37,18 +37,28 @@ public:
     virtual ~IRpcCallHandle() = default;
 };
 
+class RpcServerInternal;
+
 class RpcCallHandle : public IRpcCallHandle
 {
 public:
-    RpcCallHandle(Util::Uuid callUuid)
+    RpcCallHandle(Util::Uuid callUuid, RpcServerInternal* owner = nullptr)
         : _callUuid{callUuid}
+        , _owner{owner}
     {
     }
 
     auto GetCallUuid() const -> const Util::Uuid& { return _callUuid; }
 
+    //! The RpcServerInternal which received the call and submits its result
+    auto GetOwner() const -> RpcServerInternal* { return _owner; }
+
+    //! Handles are recycled by their owner for subsequent calls
+    void SetCallUuid(const Util::Uuid& callUuid) { _callUuid = callUuid; }
+
 private:
     Util::Uuid _callUuid{};
+    RpcServerInternal* _owner{nullptr};
 };
 
 } // namespace Rpc
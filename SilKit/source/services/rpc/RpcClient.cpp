@@ -51,6 +51,7 @@ RpcClient::RpcClient(Core::IParticipantInternal* participant, Services::Orchestr
                      RpcCallResultHandler handler)
     : _dataSpec{dataSpec}
     , _clientUUID{clientUUID}
+    , _callUuidBase{Util::Uuid::GenerateRandom()}
     , _handler{std::move(handler)}
     , _logger{participant->GetLogger()}
     , _timeProvider{timeProvider}
@@ -112,44 +113,38 @@ void RpcClient::CallWithTimeout(Util::Span<const uint8_t> data, std::chrono::nan
 
 void RpcClient::TimeHandler(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)
 {
-    std::vector<TimeoutEntry> timeoutedEntries;
+    // NB: Only called from the time provider's thread, the buffer of expired calls is reused across steps.
+    _expiredCalls.clear();
 
     {
         std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
 
-        for (auto it = _timeoutEntries.begin(); it != _timeoutEntries.end();)
+        _timeoutClock += duration;
+        while (!_timeoutEntries.empty() && _timeoutEntries.top().deadline <= _timeoutClock)
         {
-            it->timeLeft -= duration;
-            if (it->timeLeft <= static_cast<std::chrono::nanoseconds>(0))
-            {
-                timeoutedEntries.insert(timeoutedEntries.end(), std::make_move_iterator(it),
-                                        std::make_move_iterator(it + 1));
-                it = _timeoutEntries.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
+            _expiredCalls.push_back(_timeoutEntries.top().callUuid);
+            _timeoutEntries.pop();
         }
     }
 
-    for (auto&& entry : timeoutedEntries)
+    for (const auto& uuid : _expiredCalls)
     {
-        auto uuid = entry.callUuid;
-
-        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
-        auto it = _activeCalls.find(uuid);
-        auto userContext = it->second.GetUserContext();
-
-        if (it != _activeCalls.end())
+        void* userContext{nullptr};
         {
-            _activeCalls.erase(it);
-            lock.unlock();
+            std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
+            auto* callInfo = _activeCalls.Find(uuid);
+            if (callInfo == nullptr)
+            {
+                // the call has already returned
+                continue;
+            }
 
-            _handler(this, RpcCallResultEvent{now, userContext, RpcCallStatus::Timeout, {}});
+            userContext = callInfo->GetUserContext();
+            _activeCalls.Erase(uuid);
         }
+
+        _handler(this, RpcCallResultEvent{now, userContext, RpcCallStatus::Timeout, {}});
     }
-    timeoutedEntries.clear();
 }
 
 
@@ -165,21 +160,22 @@ void RpcClient::TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std
     }
     else
     {
-        const auto callUuid = Util::Uuid::GenerateRandom();
+        // NB: The call ids only have to be unique per client, the RpcServerInternal receiving them serves one client
+        const auto callUuid = Util::Uuid{_callUuidBase.ab, _callUuidBase.cd + _nextCallIndex++};
 
-        FunctionCall msg{_timeProvider->Now(), callUuid, Util::ToStdVector(data)};
+        FunctionCall msg{_timeProvider->Now(), callUuid, Util::SharedVector<uint8_t>{data}};
 
         {
             {
                 std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
-                _activeCalls.emplace(callUuid, RpcCallInfo{static_cast<int32_t>(_numCounterparts), userContext});
+                _activeCalls.Insert(callUuid, RpcCallInfo{static_cast<int32_t>(_numCounterparts), userContext});
             }
 
             if (hasTimeout)
             {
                 {
                     std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
-                    _timeoutEntries.push_back({timeout, callUuid});
+                    _timeoutEntries.push({_timeoutClock + timeout, callUuid});
                 }
 
                 if (!_isTimeoutHandlerSet)
@@ -209,32 +205,31 @@ void RpcClient::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const Functio
 
 void RpcClient::ReceiveMessage(const FunctionCallResponse& msg)
 {
-    std::map<SilKit::Util::Uuid, SilKit::Services::Rpc::RpcClient::RpcCallInfo>::iterator it;
+    void* userContext{nullptr};
     {
         std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
 
-        it = _activeCalls.find(msg.callUuid);
-
-        if (it == _activeCalls.end())
+        auto* callInfo = _activeCalls.Find(msg.callUuid);
+        if (callInfo == nullptr)
         {
             std::string warningMsg{"RpcClient: Received function call response with an unknown/deleted uuid. Might be a call reply that ran into a timeout."};
             _logger->Warn(warningMsg);
             return;
         }
-    };
 
-    if (_handler)
-    {
-        _handler(this,
-                 RpcCallResultEvent{msg.timestamp, it->second.GetUserContext(), ToRpcCallStatus(msg.status), msg.data});
+        userContext = callInfo->GetUserContext();
+
+        // NB: If the call was made to multiple servers, multiple returns will be received. Only forget about the call
+        //     after all returns have been received.
+        if (callInfo->DecrementRemainingReturnCount() <= 0)
+        {
+            _activeCalls.Erase(msg.callUuid);
+        }
     }
 
-    // NB: If the call was made to multiple servers, multiple returns will be received. Only forget about the call
-    //     after all returns have been received.
-    if (it->second.DecrementRemainingReturnCount() <= 0)
+    if (_handler)
     {
-        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
-        _activeCalls.erase(it);
+        _handler(this, RpcCallResultEvent{msg.timestamp, userContext, ToRpcCallStatus(msg.status), msg.data.AsSpan()});
     }
 }
 
@@ -35,6 +35,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IMsgForRpcClient.hpp"
 #include "IParticipantInternal.hpp"
 #include "RpcCallHandle.hpp"
+#include "FlatHashMap.hpp"
 #include "Uuid.hpp"
 
 namespace SilKit {
@@ -81,6 +82,7 @@ private:
     class RpcCallInfo
     {
     public:
+        RpcCallInfo() = default;
         RpcCallInfo(int32_t remainingReturnCount, void* userContext)
             : _remainingReturnCount{remainingReturnCount}
             , _userContext{userContext}
@@ -98,6 +100,8 @@ private:
 
     SilKit::Services::Rpc::RpcSpec _dataSpec;
     std::string _clientUUID;
+    Util::Uuid _callUuidBase;
+    std::atomic<uint64_t> _nextCallIndex{0};
 
     RpcCallResultHandler _handler;
 
@@ -110,16 +114,24 @@ private:
 
     std::mutex _activeCallsMx;
     std::mutex _timeoutQueueMx;
-    std::map<Util::Uuid, RpcCallInfo> _activeCalls;
+    Util::FlatHashMap<Util::Uuid, RpcCallInfo, Util::UuidHash> _activeCalls;
 
+    //! The deadline is absolute on the timeout clock, which is the sum of the step durations seen by the TimeHandler.
     struct TimeoutEntry
     {
-        std::chrono::nanoseconds timeLeft;
+        std::chrono::nanoseconds deadline;
         Util::Uuid callUuid;
     };
 
+    struct LaterDeadline
+    {
+        bool operator()(const TimeoutEntry& lhs, const TimeoutEntry& rhs) const { return lhs.deadline > rhs.deadline; }
+    };
 
-    std::vector<TimeoutEntry> _timeoutEntries{};
+    // NB: Entries of calls which returned in time are not removed, they are skipped when their deadline is reached.
+    std::priority_queue<TimeoutEntry, std::vector<TimeoutEntry>, LaterDeadline> _timeoutEntries{};
+    std::chrono::nanoseconds _timeoutClock{0};
+    std::vector<Util::Uuid> _expiredCalls{};
     std::function<void(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)> _timeoutHandler{};
     Services::HandlerId _timeoutHandlerId{};
     std::atomic<bool> _isTimeoutHandlerSet{ false };
@@ -90,21 +90,14 @@ void RpcServer::SubmitResult(IRpcCallHandle* callHandle, Util::Span<const uint8_
         throw SilKit::StateError{std::move(errorMsg)};
     }
 
-    // counts the number of RpcServerInternal's living within this RpcServer that returned the FunctionCall
-    uint32_t submitResultCounter = 0;
+    // NB: The handle refers to the RpcServerInternal which received the call, the RpcServerInternals are not searched
+    const auto& rpcCallHandle = static_cast<const RpcCallHandle&>(*callHandle);
+    auto* internalRpcServer = rpcCallHandle.GetOwner();
 
+    if (internalRpcServer == nullptr || internalRpcServer->GetParent() != this
+        || !internalRpcServer->SubmitResult(rpcCallHandle, resultData))
     {
-        std::unique_lock<decltype(_internalRpcServersMx)> lock{_internalRpcServersMx};
-        for (auto* internalRpcServer : _internalRpcServers)
-        {
-            submitResultCounter += (internalRpcServer->SubmitResult(callHandle, resultData) ? 1 : 0);
-        }
-    }
-
-    if (submitResultCounter != 1)
-    {
-        // NB: Multiple returns are possible, but only from _different_ RpcServers
-        std::string errorMsg = "RpcServer::SubmitResult() returned to multiple clients";
+        std::string errorMsg = "RpcServer::SubmitResult() must be called with the handle of an active call of this server";
         _logger->Error(errorMsg);
         throw SilKit::StateError{std::move(errorMsg)};
     }
@@ -66,10 +66,30 @@ void RpcServerInternal::ReceiveMessage(const FunctionCall& msg)
         return;
     }
 
-    // NB: 'result' has type pair<iterator, bool> where the bool indicates if the call was actually inserted (i.e.
-    //     the key was _not_ already present in the map).
-    auto result = _activeCalls.emplace(msg.callUuid, std::make_shared<RpcCallHandle>(msg.callUuid));
-    if (!result.second)
+    RpcCallHandle* callHandle{nullptr};
+    {
+        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
+
+        if (_activeCalls.Find(msg.callUuid) == nullptr)
+        {
+            std::unique_ptr<RpcCallHandle> handle;
+            if (_freeCallHandles.empty())
+            {
+                handle = std::make_unique<RpcCallHandle>(msg.callUuid, this);
+            }
+            else
+            {
+                handle = std::move(_freeCallHandles.back());
+                _freeCallHandles.pop_back();
+                handle->SetCallUuid(msg.callUuid);
+            }
+
+            callHandle = handle.get();
+            _activeCalls.Insert(msg.callUuid, std::move(handle));
+        }
+    }
+
+    if (callHandle == nullptr)
     {
         // Inform the client about the failed (unhandled) call
         _participant->SendMsg(
@@ -78,31 +98,33 @@ void RpcServerInternal::ReceiveMessage(const FunctionCall& msg)
 
         // Log that a call was received that could not be handled
         _participant->GetLogger()->Error("RpcServerInternal: Received FunctionCall with already active callUuid");
-
         return;
     }
 
-    // NB: Explicitly _copy_ the call handle to keep the handle itself alive even if it gets removed from the map
-    //     due to a call to SubmitResult in the handler.
-    std::shared_ptr<RpcCallHandle> callHandle = result.first->second;
-    _handler(_parent, RpcCallEvent{msg.timestamp, callHandle.get(), msg.data});
+    // NB: The handle stays valid if SubmitResult is called in the handler, it is only reused by a subsequent call.
+    _handler(_parent, RpcCallEvent{msg.timestamp, callHandle, msg.data.AsSpan()});
 }
 
-bool RpcServerInternal::SubmitResult(IRpcCallHandle* callHandlePtr, Util::Span<const uint8_t> resultData)
+bool RpcServerInternal::SubmitResult(const RpcCallHandle& callHandle, Util::Span<const uint8_t> resultData)
 {
-    const auto& callHandle = static_cast<const RpcCallHandle&>(*callHandlePtr);
-
-    auto it = _activeCalls.find(callHandle.GetCallUuid());
-    if (it == _activeCalls.end())
+    const auto callUuid = callHandle.GetCallUuid();
     {
-        // The call is not known to this RpcServerInternal, therefore return false
-        return false;
+        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
+
+        auto* activeCall = _activeCalls.Find(callUuid);
+        if (activeCall == nullptr || activeCall->get() != &callHandle)
+        {
+            // The call is not known to this RpcServerInternal, therefore return false
+            return false;
+        }
+
+        _freeCallHandles.push_back(std::move(*activeCall));
+        _activeCalls.Erase(callUuid);
     }
 
-    _participant->SendMsg(
-        this, FunctionCallResponse{_timeProvider->Now(), callHandle.GetCallUuid(), Util::ToStdVector(resultData),
-                                   FunctionCallResponse::Status::Success});
-    _activeCalls.erase(it);
+    _participant->SendMsg(this, FunctionCallResponse{_timeProvider->Now(), callUuid,
+                                                     Util::SharedVector<uint8_t>{resultData},
+                                                     FunctionCallResponse::Status::Success});
 
     // The call was handled, therefore return true
     return true;
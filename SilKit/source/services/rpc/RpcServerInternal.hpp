@@ -21,8 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <vector>
-#include <map>
 
 #include "ITimeConsumer.hpp"
 #include "silkit/services/rpc/IRpcServer.hpp"
@@ -31,6 +32,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IParticipantInternal.hpp"
 #include "IMsgForRpcServerInternal.hpp"
 #include "RpcCallHandle.hpp"
+#include "FlatHashMap.hpp"
+#include "Uuid.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -50,10 +53,12 @@ public:
     void SetRpcHandler(RpcCallHandler handler);
 
     //! \brief Tries to submit the result to the call associated with the call handle.
-    //! \param callHandlePtr The call handle identifying the call to submit a result for
+    //! \param callHandle The call handle identifying the call to submit a result for
     //! \param resultData The result of the call
     //! \returns True if the call was handled, false if the call was unknown to this RpcServerInternal
-    bool SubmitResult(IRpcCallHandle* callHandlePtr, Util::Span<const uint8_t> resultData);
+    bool SubmitResult(const RpcCallHandle& callHandle, Util::Span<const uint8_t> resultData);
+
+    auto GetParent() const -> IRpcServer* { return _parent; }
 
     //! \brief Accepts messages originating from SIL Kit communications.
     void ReceiveMsg(const Core::IServiceEndpoint* from, const FunctionCall& msg) override;
@@ -75,7 +80,10 @@ private:
     IRpcServer* _parent;
 
     Core::ServiceDescriptor _serviceDescriptor{};
-    std::map<Util::Uuid, std::shared_ptr<RpcCallHandle>> _activeCalls;
+    std::mutex _activeCallsMx;
+    Util::FlatHashMap<Util::Uuid, std::unique_ptr<RpcCallHandle>, Util::UuidHash> _activeCalls;
+    // NB: The handles of submitted calls are reused, so receiving a call does not allocate a new handle
+    std::vector<std::unique_ptr<RpcCallHandle>> _freeCallHandles;
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
     Core::IParticipantInternal* _participant{nullptr};
 };
@@ -112,6 +112,7 @@ struct MockConnection
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
+    void SendMsgBatch(const std::function<void()>& sendMessages) { sendMessages(); }
     void NotifyShutdown() {}
 
     void RegisterMessageReceiver(
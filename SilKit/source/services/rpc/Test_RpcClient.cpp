@@ -25,6 +25,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <functional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -88,7 +90,7 @@ TEST_F(RpcClientTest, rpc_client_call_sends_message_with_current_timestamp_and_d
     EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCall>()))
         .WillOnce([this, &fixedTimeProvider](const SilKit::Core::IServiceEndpoint* /*from*/, const FunctionCall& msg) {
             ASSERT_EQ(msg.timestamp, fixedTimeProvider.now);
-            ASSERT_EQ(msg.data, sampleData);
+            ASSERT_EQ(SilKit::Util::ToStdVector(msg.data.AsSpan()), sampleData);
         });
 
     // HACK: Change the time provider for the captured services. Must happen _after_ the RpcServer and RpcClient (and
@@ -125,4 +127,57 @@ TEST_F(RpcClientTest, rpc_client_call_receives_internal_server_error_when_server
     iRpcClient->Call(sampleData, userContext);
 }
 
+TEST_F(RpcClientTest, rpc_client_calls_time_out_in_the_order_of_their_deadlines)
+{
+    using namespace std::chrono_literals;
+
+    SilKit::Core::Tests::MockTimeProvider timeProvider;
+
+    IRpcServer* iRpcServer = CreateRpcServer();
+    IRpcClient* iRpcClient = CreateRpcClient();
+
+    std::vector<std::pair<uintptr_t, RpcCallStatus>> results;
+    iRpcClient->SetCallResultHandler([&results](IRpcClient* /*client*/, const RpcCallResultEvent& event) {
+        results.emplace_back(reinterpret_cast<uintptr_t>(event.userContext), event.callStatus);
+    });
+
+    // the server only answers the call with the payload {3}
+    iRpcServer->SetCallHandler([](IRpcServer* server, const RpcCallEvent& event) {
+        if (event.argumentData.size() == 1 && event.argumentData[0] == 3)
+        {
+            server->SubmitResult(event.callHandle, std::vector<uint8_t>{});
+        }
+    });
+
+    participant->GetSilKitConnection().Test_SetTimeProvider(&timeProvider);
+
+    using Results = decltype(results);
+
+    iRpcClient->CallWithTimeout(std::vector<uint8_t>{1}, 30ms, reinterpret_cast<void*>(uintptr_t{1}));
+    iRpcClient->CallWithTimeout(std::vector<uint8_t>{2}, 10ms, reinterpret_cast<void*>(uintptr_t{2}));
+    iRpcClient->CallWithTimeout(std::vector<uint8_t>{3}, 20ms, reinterpret_cast<void*>(uintptr_t{3}));
+    EXPECT_EQ(results, (Results{{3, RpcCallStatus::Success}}));
+
+    timeProvider._handlers.InvokeAll(0ms, 5ms);
+    EXPECT_EQ(results.size(), 1u);
+
+    timeProvider._handlers.InvokeAll(5ms, 5ms);
+    EXPECT_EQ(results, (Results{{3, RpcCallStatus::Success}, {2, RpcCallStatus::Timeout}}));
+
+    // the deadline of the answered call passes without a result
+    timeProvider._handlers.InvokeAll(10ms, 10ms);
+    EXPECT_EQ(results.size(), 2u);
+
+    timeProvider._handlers.InvokeAll(20ms, 10ms);
+    EXPECT_EQ(results,
+              (Results{{3, RpcCallStatus::Success}, {2, RpcCallStatus::Timeout}, {1, RpcCallStatus::Timeout}}));
+
+    // the timed out calls are forgotten
+    timeProvider._handlers.InvokeAll(30ms, 100ms);
+    EXPECT_EQ(results.size(), 3u);
+
+    // the client removes its step handler from the time provider on destruction
+    participant.reset();
+}
+
 } // anonymous namespace
@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <functional>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -59,7 +60,7 @@ TEST_F(RpcServerTest, rpc_server_call_response_sends_message_with_timestamp_and_
         .WillOnce(
             [this, &fixedTimeProvider](const SilKit::Core::IServiceEndpoint* /*from*/, const FunctionCallResponse& msg) {
                 ASSERT_EQ(msg.timestamp, fixedTimeProvider.now);
-                ASSERT_EQ(msg.data, sampleData);
+                ASSERT_EQ(SilKit::Util::ToStdVector(msg.data.AsSpan()), sampleData);
             });
 
     IRpcClient* iRpcClient = CreateRpcClient();
@@ -71,4 +72,35 @@ TEST_F(RpcServerTest, rpc_server_call_response_sends_message_with_timestamp_and_
     iRpcClient->Call(sampleData);
 }
 
+TEST_F(RpcServerTest, rpc_server_reuses_call_handles_and_rejects_submitted_handles)
+{
+    IRpcServer* iRpcServer = CreateRpcServer();
+
+    std::vector<IRpcCallHandle*> callHandles;
+    iRpcServer->SetCallHandler([&callHandles](IRpcServer* server, RpcCallEvent event) {
+        callHandles.push_back(event.callHandle);
+        server->SubmitResult(event.callHandle, event.argumentData);
+        EXPECT_THROW(server->SubmitResult(event.callHandle, event.argumentData), SilKit::StateError);
+    });
+
+    std::vector<SilKit::Util::Uuid> callUuids;
+    EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCall>()))
+        .Times(2)
+        .WillRepeatedly([&callUuids](const SilKit::Core::IServiceEndpoint* /*from*/, const FunctionCall& msg) {
+            callUuids.push_back(msg.callUuid);
+        });
+
+    IRpcClient* iRpcClient = CreateRpcClient();
+    iRpcClient->Call(sampleData);
+    iRpcClient->Call(sampleData);
+
+    ASSERT_EQ(callHandles.size(), 2u);
+    EXPECT_EQ(callHandles[0], callHandles[1]);
+
+    // the call ids of a client are consecutive
+    ASSERT_EQ(callUuids.size(), 2u);
+    EXPECT_EQ(callUuids[1].ab, callUuids[0].ab);
+    EXPECT_EQ(callUuids[1].cd, callUuids[0].cd + 1);
+}
+
 } // anonymous namespace
@@ -0,0 +1,50 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <chrono>
+
+#include "silkit/util/Span.hpp"
+
+#include "IReplay.hpp"
+
+namespace SilKit {
+namespace Tracing {
+
+//! Optional interface of replay channel readers, which keep an index of the message timestamps
+class ITimeIndexedReader
+{
+public:
+    virtual ~ITimeIndexedReader() = default;
+
+    /*! \brief Returns the messages from the current position up to (excluding) the given time and advances past them
+     *
+     *  The messages refer to the data of the replay file and stay valid until the next call.
+     */
+    virtual auto ReadWindow(std::chrono::nanoseconds end) -> Util::Span<IReplayMessage* const> = 0;
+
+    //! True if all messages have been read
+    virtual bool IsAtEnd() const = 0;
+};
+
+} // namespace Tracing
+} // namespace SilKit
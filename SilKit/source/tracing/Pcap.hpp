@@ -31,6 +31,12 @@ const size_t PacketHeaderSize = 16;
 const uint16_t MajorVersion = 2;
 const uint16_t MinorVersion = 4;
 
+// Data link types of the global header, cf. https://www.tcpdump.org/linktypes.html
+const uint32_t LinkTypeEthernet = 1;
+const uint32_t LinkTypeFlexray = 210;
+const uint32_t LinkTypeLin = 212;
+const uint32_t LinkTypeCanSocketCan = 227;
+
 struct GlobalHeader
 {
     uint32_t magic_number = NativeMagic; /* magic number */
@@ -39,7 +45,7 @@ struct GlobalHeader
     int32_t thiszone = 0; /* GMT to local correction */
     uint32_t sigfigs = 0; /* accuracy of timestamps */
     uint32_t snaplen = 65535; /* max length of captured packets, in octets */
-    uint32_t network = 1; /* data link type */
+    uint32_t network = LinkTypeEthernet; /* data link type */
 };
 static_assert(sizeof(GlobalHeader) == GlobalHeaderSize, "GlobalHeader size must be equal to 24 bytes");
 
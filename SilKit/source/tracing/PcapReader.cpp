@@ -20,39 +20,30 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "PcapReader.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
 #include "silkit/services/ethernet/EthernetDatatypes.hpp"
 
-#include "WireEthernetMessages.hpp"
 #include "Pcap.hpp"
-#include "Assert.hpp"
+#include "ILogger.hpp"
+#include "detail/MemoryMappedFile.hpp"
 
 namespace SilKit {
 namespace Tracing {
 
 using namespace SilKit::Services::Logging;
 
+namespace {
+// Amount of packet data which is prefetched after a replay window has been read
+constexpr size_t PrefetchSize = 1024 * 1024;
+} // namespace
+
 //////////////////////////////////////////////////////////////////////
-// PcapMessage -- internal only
+// PcapMessage
 //////////////////////////////////////////////////////////////////////
 
-class PcapMessage
-    : public SilKit::IReplayMessage
-    , public SilKit::Services::Ethernet::WireEthernetFrame
-{
-public:
-    auto Timestamp() const -> std::chrono::nanoseconds override;
-    void SetTimestamp(std::chrono::nanoseconds timeStamp);
-    auto GetDirection() const -> SilKit::Services::TransmitDirection override;
-    auto ServiceDescriptorStr() const -> std::string override;
-    auto EndpointAddress() const -> SilKit::Core::EndpointAddress override;
-    auto Type() const -> SilKit::TraceMessageType override;
-
-private:
-    std::chrono::nanoseconds _timeStamp{0};
-    SilKit::Services::TransmitDirection _direction{SilKit::Services::TransmitDirection::TX};
-    std::string _serviceDescriptorStr;
-};
-
 void PcapMessage::SetTimestamp(std::chrono::nanoseconds timeStamp)
 {
     _timeStamp = timeStamp;
@@ -87,146 +78,214 @@ auto PcapMessage::Type() const -> TraceMessageType
 // PcapReader
 //////////////////////////////////////////////////////////////////////
 
+// The file contents and the index, shared by all copies of a reader
+struct PcapReader::Storage
+{
+    Detail::MemoryMappedFile::Ptr file;
+    std::vector<uint8_t> buffer; //!< Used instead of the file when reading from a stream
+    const uint8_t* data{nullptr};
+    size_t size{0};
+
+    std::vector<IndexEntry> index;
+    std::map<std::string, std::string> metaInfos;
+};
+
 PcapReader::PcapReader(std::istream* stream, SilKit::Services::Logging::ILogger* logger)
-    : _stream{stream}
-    , _log{logger}
+    : _log{logger}
 {
-    Reset();
+    if (stream == nullptr)
+    {
+        _log->Error("PcapReader: no input file or stream pointer given!");
+        throw SilKitError("PcapReader: no input file or stream pointer given!");
+    }
+
+    auto storage = std::make_shared<Storage>();
+    stream->seekg(0);
+    storage->buffer.assign(std::istreambuf_iterator<char>{*stream}, std::istreambuf_iterator<char>{});
+    storage->data = storage->buffer.data();
+    storage->size = storage->buffer.size();
+    Load(std::move(storage));
 }
+
 PcapReader::PcapReader(const std::string& filePath, ILogger* logger)
     : _filePath{filePath}
     , _log{logger}
 {
-    Reset();
+    auto storage = std::make_shared<Storage>();
+    try
+    {
+        storage->file = Detail::MemoryMappedFile::Open(_filePath);
+    }
+    catch (const SilKitError& error)
+    {
+        _log->Error("Cannot open file " + _filePath + ": " + error.what());
+        throw SilKitError("Cannot open file " + _filePath);
+    }
+    storage->data = storage->file->Data();
+    storage->size = storage->file->Size();
+    Load(std::move(storage));
 }
 
-// Copies meta infos and resets file stream to initial seek state
+// Shares the file and the index, reading starts at the first message
 PcapReader::PcapReader(PcapReader& other)
+    : _filePath{other._filePath}
+    , _log{other._log}
+    , _storage{other._storage}
 {
-    _filePath = other._filePath;
-    _metaInfos = other._metaInfos;
-    _numMessages = other._numMessages;
-    _log = other._log;
-    _startTime = other._startTime;
-    _endTime = other._endTime;
-    _stream = other._stream;
-    Reset();
 }
 
-void PcapReader::Reset()
+void PcapReader::Load(std::shared_ptr<Storage> storage)
 {
-    if (_filePath.empty() && _stream == nullptr)
+    ReadGlobalHeader(*storage);
+    BuildIndex(*storage);
+    _storage = std::move(storage);
+}
+
+void PcapReader::ReadGlobalHeader(Storage& storage)
+{
+    if (storage.size < sizeof(Pcap::GlobalHeader))
+    {
+        throw SilKitError("PCAP file cannot be opened: global header short read");
+    }
+    Pcap::GlobalHeader header{};
+    memcpy(&header, storage.data, sizeof(header));
+    if (header.magic_number != Pcap::NativeMagic)
+    {
+        throw SilKitError("PCAP file cannot be opened: invalid PCAP valid magic number");
+    }
+    if ((header.version_major != Pcap::MajorVersion) && (header.version_minor != Pcap::MinorVersion))
     {
-        _log->Error("PcapReader::Reset(): no input file or stream pointer given!");
-        throw SilKitError("PcapReader::Reset(): no input file or stream pointer given!");
+        throw SilKitError("PCAP file cannot be opened: invalid PCAP version " + std::to_string(header.version_major) + "."
+                          + std::to_string(header.version_minor));
     }
+    if (header.network != Pcap::LinkTypeEthernet)
+    {
+        throw SilKitError("PCAP file cannot be opened: only Ethernet traces can be replayed, the data link type is "
+                          + std::to_string(header.network));
+    }
+    storage.metaInfos["pcap/version"] = std::to_string(header.version_major) + "." + std::to_string(header.version_minor);
+    storage.metaInfos["pcap/gmt_to_local"] = std::to_string(header.thiszone);
+}
 
-    if (!_filePath.empty())
+void PcapReader::BuildIndex(Storage& storage)
+{
+    bool isSorted = true;
+    size_t offset = sizeof(Pcap::GlobalHeader);
+    while (offset < storage.size)
     {
-        if (!_file.is_open())
+        if (storage.size - offset < sizeof(Pcap::PacketHeader))
         {
-            _file.open(_filePath, std::ios::binary | std::ios::in);
-            _stream = &_file;
+            _log->Warn("PCAP file: " + _filePath + ": short read on packet header.");
+            break;
         }
-        if (!_file.good())
+        Pcap::PacketHeader hdr{};
+        memcpy(&hdr, storage.data + offset, sizeof(hdr));
+        if (storage.size - offset - sizeof(hdr) < hdr.incl_len)
         {
-            _log->Error("Cannot open file " + _filePath);
-            throw SilKitError("Cannot open file " + _filePath);
+            _log->Warn("PCAP file: " + _filePath + ": Cannot read packet at offset " + std::to_string(offset));
+            break;
         }
-    }
 
-    SILKIT_ASSERT(_stream != nullptr);
-
-    //seek stream to first packet and cache first message
-    ReadGlobalHeader();
-    Seek(1);
-}
+        std::chrono::nanoseconds timeStamp{((uint64_t)hdr.ts_sec * 1000000000u) + ((uint64_t)hdr.ts_usec * 1000u)};
+        isSorted &= storage.index.empty() || storage.index.back().timestamp <= timeStamp;
+        storage.index.push_back(IndexEntry{timeStamp, offset});
 
-void PcapReader::ReadGlobalHeader()
-{
-    std::array<char, sizeof(Pcap::GlobalHeader)> buf{};
-    _stream->seekg(0);
-    _stream->read(buf.data(), buf.size());
-    if (!_stream->good())
-    {
-        throw SilKitError("PCAP file cannot be opened: global header short read");
+        offset += sizeof(hdr) + hdr.incl_len;
     }
-    auto* hdr = reinterpret_cast<Pcap::GlobalHeader*>(buf.data());
-    if (hdr->magic_number != Pcap::NativeMagic)
-    {
-        throw SilKitError("PCAP file cannot be opened: invalid PCAP valid magic number");
-    }
-    if ((hdr->version_major != Pcap::MajorVersion) && (hdr->version_minor != Pcap::MinorVersion))
+
+    if (!isSorted)
     {
-        throw SilKitError("PCAP file cannot be opened: invalid PCAP version " + std::to_string(hdr->version_major) + "."
-                          + std::to_string(hdr->version_minor));
+        // The replay assumes ascending timestamps, packets with equal timestamps keep their order
+        Services::Logging::Debug(_log, "PCAP file: {}: sorting packets by timestamp", _filePath);
+        std::stable_sort(storage.index.begin(), storage.index.end(),
+                         [](const IndexEntry& lhs, const IndexEntry& rhs) { return lhs.timestamp < rhs.timestamp; });
     }
-    _metaInfos["pcap/version"] = std::to_string(hdr->version_major) + "." + std::to_string(hdr->version_minor);
-    _metaInfos["pcap/gmt_to_local"] = std::to_string(hdr->thiszone);
+}
+
+void PcapReader::FillMessage(const IndexEntry& entry, PcapMessage& message) const
+{
+    Pcap::PacketHeader hdr{};
+    memcpy(&hdr, _storage->data + entry.offset, sizeof(hdr));
+
+    // The message shares the ownership of the storage, instead of copying the packet data
+    std::shared_ptr<const uint8_t> packetData{_storage, _storage->data + entry.offset + sizeof(hdr)};
+    message.raw = Util::SharedVector<uint8_t>{std::move(packetData), hdr.incl_len};
+    message.SetTimestamp(entry.timestamp);
 }
 
 auto PcapReader::StartTime() const -> std::chrono::nanoseconds
 {
-    return _startTime;
+    const auto& index = _storage->index;
+    return index.empty() ? std::chrono::nanoseconds{0} : index.front().timestamp;
 }
 
 auto PcapReader::EndTime() const -> std::chrono::nanoseconds
 {
-    throw SilKitError("PcapReader::EndTime(): Not Implemented");
+    const auto& index = _storage->index;
+    return index.empty() ? std::chrono::nanoseconds{0} : index.back().timestamp;
 }
 
 auto PcapReader::NumberOfMessages() const -> uint64_t
 {
-    return _numMessages;
+    return _storage->index.size();
 }
 
 bool PcapReader::Seek(size_t messageNumber)
 {
     //seek number of messages relative to current position
-    for (auto i = 0u; i < messageNumber; i++)
-    {
-        //extract PCAP packet from stream
+    const auto numMessages = _storage->index.size();
+    _position = (std::min)(_position + messageNumber, numMessages);
+    _currentMessage.reset();
+    return _position < numMessages;
+}
 
-        std::array<char, sizeof(Pcap::PacketHeader)> buf{};
-        _stream->read(buf.data(), buf.size());
-        if (!_stream->good())
-        {
-            _log->Warn("PCAP file: " + _filePath + ": short read on packet header.");
-            return false;
-        }
+std::shared_ptr<IReplayMessage> PcapReader::Read()
+{
+    if (!_currentMessage && !IsAtEnd())
+    {
         auto msg = std::make_shared<PcapMessage>();
-        auto* hdr = reinterpret_cast<Pcap::PacketHeader*>(buf.data());
-        std::chrono::nanoseconds timeStamp{((uint64_t)hdr->ts_sec * 1000000000u) + ((uint64_t)hdr->ts_usec * 1000u)};
+        FillMessage(_storage->index[_position], *msg);
+        _currentMessage = std::move(msg);
+    }
+    return _currentMessage;
+}
 
-        std::vector<uint8_t> msgBuf{};
-        msgBuf.resize(hdr->incl_len);
-        _stream->read(reinterpret_cast<char*>(msgBuf.data()), hdr->incl_len);
-        if (!_stream->good())
-        {
-            _log->Warn("PCAP file: " + _filePath + ": Cannot read packet at offset "
-                       + std::to_string(_stream->tellg()));
-            return false;
-        }
-        msg->raw = std::move(msgBuf);
-        msg->SetTimestamp(timeStamp);
+auto PcapReader::ReadWindow(std::chrono::nanoseconds end) -> Util::Span<IReplayMessage* const>
+{
+    const auto& index = _storage->index;
+    const auto first = index.begin() + _position;
+    const auto last = std::lower_bound(first, index.end(), end,
+                                       [](const IndexEntry& entry, auto time) { return entry.timestamp < time; });
+    const auto count = static_cast<size_t>(std::distance(first, last));
+
+    _windowMessages.resize(count);
+    _window.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        FillMessage(first[i], _windowMessages[i]);
+        _window[i] = &_windowMessages[i];
+    }
 
-        _currentMessage = std::move(msg);
-        //NB we can't know the number of messages without seeking through the whole file,
-        //      which we're not going to do for performance reasons.
-        _numMessages++;
+    _position += count;
+    _currentMessage.reset();
+
+    // Page in the data of the next window while the current one is replayed
+    if (_storage->file && !IsAtEnd())
+    {
+        _storage->file->Prefetch(index[_position].offset, PrefetchSize);
     }
-    return true;
+
+    return {_window.data(), _window.size()};
 }
 
-std::shared_ptr<IReplayMessage> PcapReader::Read()
+bool PcapReader::IsAtEnd() const
 {
-    //return cached value
-    return _currentMessage;
+    return _position >= _storage->index.size();
 }
 
 auto PcapReader::GetMetaInfos() const -> const std::map<std::string, std::string>&
 {
-    return _metaInfos;
+    return _storage->metaInfos;
 }
 
 } // namespace Tracing
@@ -22,14 +22,42 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <istream>
-#include <fstream>
+#include <vector>
 
 #include "IReplay.hpp"
+#include "ITimeIndexedReader.hpp"
+#include "WireEthernetMessages.hpp"
 
 namespace SilKit {
 namespace Tracing {
 
-class PcapReader : public SilKit::IReplayChannelReader
+//! An Ethernet frame of a PCAP file, its raw data refers to the memory of the file
+class PcapMessage
+    : public SilKit::IReplayMessage
+    , public SilKit::Services::Ethernet::WireEthernetFrame
+{
+public:
+    auto Timestamp() const -> std::chrono::nanoseconds override;
+    void SetTimestamp(std::chrono::nanoseconds timeStamp);
+    auto GetDirection() const -> SilKit::Services::TransmitDirection override;
+    auto ServiceDescriptorStr() const -> std::string override;
+    auto EndpointAddress() const -> SilKit::Core::EndpointAddress override;
+    auto Type() const -> SilKit::TraceMessageType override;
+
+private:
+    std::chrono::nanoseconds _timeStamp{0};
+    SilKit::Services::TransmitDirection _direction{SilKit::Services::TransmitDirection::TX};
+    std::string _serviceDescriptorStr;
+};
+
+/*! \brief Reads Ethernet frames from a PCAP file
+ *
+ *  The file is memory mapped and a timestamp index of all packets is built when it is opened. Copies of a reader
+ *  share the file and the index.
+ */
+class PcapReader
+    : public SilKit::IReplayChannelReader
+    , public ITimeIndexedReader
 {
 public:
     // Constructors
@@ -48,23 +76,37 @@ public:
     bool Seek(size_t messageNumber) override;
     auto Read() -> std::shared_ptr<SilKit::IReplayMessage> override;
 
+    // Interface ITimeIndexedReader
+    auto ReadWindow(std::chrono::nanoseconds end) -> Util::Span<IReplayMessage* const> override;
+    bool IsAtEnd() const override;
+
     auto GetMetaInfos() const -> const std::map<std::string, std::string>&;
 
+private:
+    struct IndexEntry
+    {
+        std::chrono::nanoseconds timestamp;
+        size_t offset; //!< Offset of the packet header
+    };
+
+    struct Storage;
+
 private:
     //Methods
-    void Reset();
-    void ReadGlobalHeader();
+    void Load(std::shared_ptr<Storage> storage);
+    void ReadGlobalHeader(Storage& storage);
+    void BuildIndex(Storage& storage);
+    void FillMessage(const IndexEntry& entry, PcapMessage& message) const;
 
 private:
     std::string _filePath;
-    std::ifstream _file;
-    std::istream* _stream{nullptr};
-    std::map<std::string, std::string> _metaInfos;
-    std::shared_ptr<IReplayMessage> _currentMessage;
-    uint64_t _numMessages{0};
     SilKit::Services::Logging::ILogger* _log{nullptr};
-    std::chrono::nanoseconds _startTime{0};
-    std::chrono::nanoseconds _endTime{0};
+    std::shared_ptr<const Storage> _storage;
+    size_t _position{0};
+    std::shared_ptr<IReplayMessage> _currentMessage;
+    // Reused by ReadWindow
+    std::vector<PcapMessage> _windowMessages;
+    std::vector<IReplayMessage*> _window;
 };
 
 } // namespace Tracing
@@ -21,14 +21,14 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "PcapSink.hpp"
 
+#include <algorithm>
 #include <string>
-#include <ctime>
-#include <sstream>
 
 #include "TraceMessage.hpp"
 #include "string_utils.hpp"
 
 #include "Pcap.hpp"
+#include "SetThreadName.hpp"
 #include "detail/NamedPipe.hpp"
 
 #include "ILogger.hpp"
@@ -39,13 +39,229 @@ namespace Tracing {
 using namespace SilKit::Services::Logging;
 
 namespace {
-constexpr Pcap::GlobalHeader g_pcapGlobalHeader{};
+
+constexpr size_t QueueCapacity = 4096;
+constexpr size_t BatchSize = 64 * 1024;
+constexpr auto WriterIdleTimeout = std::chrono::milliseconds{10};
+
+// SocketCAN flags, cf. https://www.tcpdump.org/linktypes/LINKTYPE_CAN_SOCKETCAN.html
+constexpr uint32_t SocketCanExtendedFrame = 0x80000000u;
+constexpr uint32_t SocketCanRemoteFrame = 0x40000000u;
+constexpr uint8_t SocketCanFdBitRateSwitch = 0x01;
+constexpr uint8_t SocketCanFdErrorStateIndicator = 0x02;
+constexpr uint8_t SocketCanFdFrame = 0x04;
+
+auto LinkTypeOf(TraceMessageType type) -> uint32_t
+{
+    switch (type)
+    {
+    case TraceMessageType::EthernetFrame: return Pcap::LinkTypeEthernet;
+    case TraceMessageType::CanFrameEvent: return Pcap::LinkTypeCanSocketCan;
+    case TraceMessageType::LinFrame: return Pcap::LinkTypeLin;
+    case TraceMessageType::FlexrayFrameEvent: return Pcap::LinkTypeFlexray;
+    default: return 0;
+    }
+}
+
+void Append(std::vector<uint8_t>& packet, const uint8_t* data, size_t size)
+{
+    packet.insert(packet.end(), data, data + size);
+}
+
+void AppendBigEndian(std::vector<uint8_t>& packet, uint32_t value)
+{
+    packet.push_back(static_cast<uint8_t>(value >> 24));
+    packet.push_back(static_cast<uint8_t>(value >> 16));
+    packet.push_back(static_cast<uint8_t>(value >> 8));
+    packet.push_back(static_cast<uint8_t>(value));
+}
+
+//! Creates a packet containing the PCAP packet header, the caller appends dataSize bytes of packet data
+auto MakePacket(std::chrono::nanoseconds timestamp, size_t dataSize) -> std::vector<uint8_t>
+{
+    const auto tosec = 1000'000ull;
+    const auto usec = std::chrono::duration_cast<std::chrono::microseconds>(timestamp);
+
+    Pcap::PacketHeader pcapPacketHeader;
+    pcapPacketHeader.orig_len = static_cast<uint32_t>(dataSize);
+    pcapPacketHeader.incl_len = pcapPacketHeader.orig_len;
+    pcapPacketHeader.ts_sec = static_cast<uint32_t>(usec.count() / tosec);
+    pcapPacketHeader.ts_usec = static_cast<uint32_t>(usec.count() % tosec);
+
+    std::vector<uint8_t> packet;
+    packet.reserve(sizeof(pcapPacketHeader) + dataSize);
+    Append(packet, reinterpret_cast<const uint8_t*>(&pcapPacketHeader), sizeof(pcapPacketHeader));
+    return packet;
+}
+
+auto EncodeEthernet(std::chrono::nanoseconds timestamp, const Services::Ethernet::EthernetFrame& frame)
+    -> std::vector<uint8_t>
+{
+    auto packet = MakePacket(timestamp, frame.raw.size());
+    Append(packet, frame.raw.data(), frame.raw.size());
+    return packet;
+}
+
+auto EncodeCan(std::chrono::nanoseconds timestamp, const Services::Can::CanFrameEvent& event) -> std::vector<uint8_t>
+{
+    using Services::Can::CanFrameFlag;
+    using Services::Can::CanFrameFlagMask;
+
+    const auto& frame = event.frame;
+    const auto hasFlag = [&frame](CanFrameFlag flag) {
+        return (frame.flags & static_cast<CanFrameFlagMask>(flag)) != 0;
+    };
+
+    if (hasFlag(CanFrameFlag::Xlf))
+    {
+        return {}; // not representable in the SocketCAN link type
+    }
+
+    const bool isFd = hasFlag(CanFrameFlag::Fdf);
+    const auto dataSize = std::min<size_t>(frame.dataField.size(), isFd ? 64 : 8);
+
+    uint32_t canId = frame.canId;
+    if (hasFlag(CanFrameFlag::Ide))
+    {
+        canId = (canId & 0x1FFFFFFFu) | SocketCanExtendedFrame;
+    }
+    else
+    {
+        canId &= 0x7FFu;
+    }
+    if (hasFlag(CanFrameFlag::Rtr))
+    {
+        canId |= SocketCanRemoteFrame;
+    }
+
+    uint8_t fdFlags = 0;
+    if (isFd)
+    {
+        fdFlags |= SocketCanFdFrame;
+        fdFlags |= hasFlag(CanFrameFlag::Brs) ? SocketCanFdBitRateSwitch : 0;
+        fdFlags |= hasFlag(CanFrameFlag::Esi) ? SocketCanFdErrorStateIndicator : 0;
+    }
+
+    auto packet = MakePacket(timestamp, 8 + dataSize);
+    AppendBigEndian(packet, canId);
+    packet.push_back(static_cast<uint8_t>(dataSize));
+    packet.push_back(fdFlags);
+    packet.push_back(0); // reserved
+    packet.push_back(0); // reserved
+    Append(packet, frame.dataField.data(), dataSize);
+    return packet;
+}
+
+auto LinProtectedId(Services::Lin::LinId id) -> uint8_t
+{
+    const auto bit = [id](int n) { return static_cast<uint8_t>((id >> n) & 1); };
+    const uint8_t p0 = bit(0) ^ bit(1) ^ bit(2) ^ bit(4);
+    const uint8_t p1 = (bit(1) ^ bit(3) ^ bit(4) ^ bit(5)) ^ 1;
+    return static_cast<uint8_t>((id & 0x3F) | (p0 << 6) | (p1 << 7));
+}
+
+auto LinChecksum(uint8_t protectedId, const Services::Lin::LinFrame& frame, size_t dataSize, bool enhanced)
+    -> uint8_t
+{
+    unsigned sum = enhanced ? protectedId : 0;
+    for (size_t i = 0; i < dataSize; ++i)
+    {
+        sum += frame.data[i];
+        if (sum > 0xFF)
+        {
+            sum -= 0xFF;
+        }
+    }
+    return static_cast<uint8_t>(~sum);
+}
+
+// cf. https://www.tcpdump.org/linktypes/LINKTYPE_LIN.html
+auto EncodeLin(std::chrono::nanoseconds timestamp, const Services::Lin::LinFrame& frame) -> std::vector<uint8_t>
+{
+    const auto dataSize = std::min<size_t>(frame.dataLength, frame.data.size());
+    const bool enhanced = frame.checksumModel == Services::Lin::LinChecksumModel::Enhanced;
+    const auto protectedId = LinProtectedId(frame.id);
+
+    auto packet = MakePacket(timestamp, 8 + dataSize);
+    packet.push_back(1); // header revision
+    packet.push_back(0); // reserved
+    packet.push_back(0); // reserved
+    packet.push_back(0); // reserved
+    // payload length, message type 0 (frame), checksum type
+    packet.push_back(static_cast<uint8_t>((dataSize << 4) | (enhanced ? 1 : 0)));
+    packet.push_back(protectedId);
+    packet.push_back(LinChecksum(protectedId, frame, dataSize, enhanced));
+    packet.push_back(0); // error flags
+    Append(packet, frame.data.data(), dataSize);
+    return packet;
+}
+
+// cf. https://www.tcpdump.org/linktypes/LINKTYPE_FLEXRAY.html
+auto EncodeFlexray(std::chrono::nanoseconds timestamp, const Services::Flexray::FlexrayFrameEvent& event)
+    -> std::vector<uint8_t>
+{
+    using Services::Flexray::FlexrayHeader;
+
+    const auto& header = event.frame.header;
+    const auto& payload = event.frame.payload;
+    const auto hasFlag = [&header](FlexrayHeader::Flag flag) {
+        return (header.flags & static_cast<FlexrayHeader::FlagMask>(flag)) != 0;
+    };
+
+    uint8_t indicators = 0;
+    indicators |= hasFlag(FlexrayHeader::Flag::PPIndicator) ? 0x40 : 0;
+    indicators |= hasFlag(FlexrayHeader::Flag::NFIndicator) ? 0x20 : 0;
+    indicators |= hasFlag(FlexrayHeader::Flag::SyFIndicator) ? 0x10 : 0;
+    indicators |= hasFlag(FlexrayHeader::Flag::SuFIndicator) ? 0x08 : 0;
+
+    // measurement header, frame header, payload and frame CRC
+    auto packet = MakePacket(timestamp, 2 + 5 + payload.size() + 3);
+    packet.push_back(static_cast<uint8_t>((event.channel == Services::Flexray::FlexrayChannel::B ? 0x80 : 0) | 0x01));
+    packet.push_back(0); // error flags
+    packet.push_back(static_cast<uint8_t>(indicators | ((header.frameId >> 8) & 0x07)));
+    packet.push_back(static_cast<uint8_t>(header.frameId));
+    packet.push_back(static_cast<uint8_t>(((header.payloadLength & 0x7F) << 1) | ((header.headerCrc >> 10) & 0x01)));
+    packet.push_back(static_cast<uint8_t>(header.headerCrc >> 2));
+    packet.push_back(static_cast<uint8_t>(((header.headerCrc & 0x03) << 6) | (header.cycleCount & 0x3F)));
+    Append(packet, payload.data(), payload.size());
+    packet.insert(packet.end(), 3, 0); // the frame CRC is not simulated
+    return packet;
+}
+
+auto EncodePacket(std::chrono::nanoseconds timestamp, const TraceMessage& traceMessage) -> std::vector<uint8_t>
+{
+    switch (traceMessage.Type())
+    {
+    case TraceMessageType::EthernetFrame:
+        return EncodeEthernet(timestamp, traceMessage.Get<Services::Ethernet::EthernetFrame>());
+    case TraceMessageType::CanFrameEvent:
+        return EncodeCan(timestamp, traceMessage.Get<Services::Can::CanFrameEvent>());
+    case TraceMessageType::LinFrame: return EncodeLin(timestamp, traceMessage.Get<Services::Lin::LinFrame>());
+    case TraceMessageType::FlexrayFrameEvent:
+        return EncodeFlexray(timestamp, traceMessage.Get<Services::Flexray::FlexrayFrameEvent>());
+    default: return {};
+    }
+}
+
 } // namespace
 
-PcapSink::PcapSink(Services::Logging::ILogger* logger, std::string name)
+PcapSink::PcapSink(Services::Logging::ILogger* logger, std::string name, OverflowPolicy overflowPolicy)
     : _name{std::move(name)}
     , _logger{logger}
+    , _overflowPolicy{overflowPolicy}
+    , _queue{QueueCapacity}
+{
+}
+
+PcapSink::~PcapSink()
 {
+    try
+    {
+        Close();
+    }
+    catch (...)
+    {
+    }
 }
 
 void PcapSink::Open(SinkType outputType, const std::string& outputPath)
@@ -55,6 +271,8 @@ void PcapSink::Open(SinkType outputType, const std::string& outputPath)
         throw SilKitError("PcapSink::Open: outputPath must not be empty!");
     }
 
+    StopWriter();
+
     switch (outputType)
     {
     case SilKit::SinkType::PcapFile:
@@ -63,16 +281,22 @@ void PcapSink::Open(SinkType outputType, const std::string& outputPath)
             _file.close();
         }
         _file.open(outputPath, std::ios::out | std::ios::binary);
-        _file.write(reinterpret_cast<const char*>(&g_pcapGlobalHeader), sizeof(g_pcapGlobalHeader));
         break;
 
     case SilKit::SinkType::PcapNamedPipe:
         _pipe = Detail::NamedPipe::Create(outputPath);
-        _headerWritten = false;
-        _outputPath = outputPath;
         break;
     default: throw SilKitError("PcapSink::Open: specified SinkType not implemented");
     }
+
+    // The global header is written by the writer thread, once the link type is known
+    _outputPath = outputPath;
+    _headerWritten = false;
+    _linkType = 0;
+    _writeFailed = false;
+    _stopWriter = false;
+    _isOpen = true;
+    _writerThread = std::thread{[this] { WriterLoop(); }};
 }
 
 auto PcapSink::GetLogger() const -> Services::Logging::ILogger*
@@ -85,8 +309,15 @@ auto PcapSink::Name() const -> const std::string&
     return _name;
 }
 
+auto PcapSink::NumberOfDroppedPackets() const -> uint64_t
+{
+    return _numDroppedPackets;
+}
+
 void PcapSink::Close()
 {
+    StopWriter();
+
     if (_file)
     {
         _file.flush();
@@ -105,59 +336,244 @@ void PcapSink::Close()
         }
         _pipe.reset();
     }
+
+    if (_numDroppedPackets > 0)
+    {
+        Services::Logging::Warn(_logger, "Sink {}: {} packets were dropped, because the write queue was full", _name,
+                                _numDroppedPackets.load());
+    }
 }
 
 void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
                      const Core::ServiceDescriptor& /* unused endpoint address */, std::chrono::nanoseconds timestamp,
                      const TraceMessage& traceMessage)
 {
-    if (traceMessage.Type() != TraceMessageType::EthernetFrame)
+    if (_writeFailed)
+    {
+        throw SilKitError("Failed to write trace message to PCAP sink");
+    }
+    if (!_isOpen)
     {
-        std::stringstream ss;
-        ss << "Error: unsupported message type: " << traceMessage;
-        throw SilKitError(ss.str());
+        WarnTraceAfterClose();
+        return;
     }
-    const auto& message = traceMessage.Get<Services::Ethernet::EthernetFrame>();
 
-    std::unique_lock<decltype(_lock)> lock;
+    const auto linkType = LinkTypeOf(traceMessage.Type());
+    auto packet = linkType != 0 ? EncodePacket(timestamp, traceMessage) : std::vector<uint8_t>{};
+    if (packet.empty())
+    {
+        if (!_warnedUnsupportedMessage.exchange(true))
+        {
+            Services::Logging::Warn(_logger, "Sink {}: unsupported message type is not written to PCAP: {}", _name,
+                                    to_string(traceMessage));
+        }
+        return;
+    }
 
-    const auto tosec = 1000'000ull;
-    const auto usec = std::chrono::duration_cast<std::chrono::microseconds>(timestamp);
+    if (!SelectLinkType(linkType))
+    {
+        if (!_warnedOtherLinkType.exchange(true))
+        {
+            Services::Logging::Warn(_logger,
+                                    "Sink {}: a PCAP output contains a single bus type, frames of other bus types are "
+                                    "not written: {}",
+                                    _name, to_string(traceMessage));
+        }
+        return;
+    }
 
-    Pcap::PacketHeader pcapPacketHeader;
-    pcapPacketHeader.orig_len = static_cast<uint32_t>(message.raw.size());
-    pcapPacketHeader.incl_len = pcapPacketHeader.orig_len;
-    pcapPacketHeader.ts_sec = static_cast<uint32_t>(usec.count() / tosec);
-    pcapPacketHeader.ts_usec = static_cast<uint32_t>(usec.count() % tosec);
+    Enqueue(std::move(packet));
+}
 
-    bool ok = true;
-    if (_file.is_open())
+bool PcapSink::SelectLinkType(uint32_t linkType)
+{
+    uint32_t expected = 0;
+    return _linkType.compare_exchange_strong(expected, linkType) || expected == linkType;
+}
+
+void PcapSink::Enqueue(std::vector<uint8_t> packet)
+{
+    if (_queue.TryPush(std::move(packet)))
     {
-        _file.write(reinterpret_cast<const char*>(&pcapPacketHeader), sizeof(pcapPacketHeader));
-        _file.write(reinterpret_cast<const char*>(&message.raw.at(0)), message.raw.size());
-        ok &= _file.good();
+        WakeUpWriter();
+        return;
     }
 
-    if (_pipe)
+    if (_overflowPolicy == OverflowPolicy::Drop)
     {
-        if (!_headerWritten)
+        if (_numDroppedPackets++ == 0)
         {
-            Services::Logging::Info(_logger, "Sink {}: Waiting for a reader to connect to PCAP pipe {} ... ", _name,
-                                    _outputPath);
+            Services::Logging::Warn(_logger, "Sink {}: write queue is full, dropping packets", _name);
+        }
+        return;
+    }
 
-            ok &= _pipe->Write(reinterpret_cast<const char*>(&g_pcapGlobalHeader), sizeof(g_pcapGlobalHeader));
-            Services::Logging::Debug(_logger, "Sink {}: PCAP pipe: {} is connected successfully", _name, _outputPath);
+    // Block until the writer drained some packets. The push is retried with the lock held and the writer notifies
+    // with the lock held, so the notification cannot get lost. The timeout only guards against a stalled writer.
+    std::unique_lock<std::mutex> lock{_wakeUpMutex};
+    ++_numBlockedProducers;
+    while (!_queue.TryPush(std::move(packet)))
+    {
+        if (_stopWriter)
+        {
+            --_numBlockedProducers;
+            lock.unlock();
+            WarnTraceAfterClose();
+            return;
+        }
+        _wakeUp.notify_one();
+        _spaceAvailable.wait_for(lock, WriterIdleTimeout);
+    }
+    --_numBlockedProducers;
+    _wakeUp.notify_one();
+}
 
-            _headerWritten = true;
+void PcapSink::WarnTraceAfterClose()
+{
+    if (!_warnedTraceAfterClose.exchange(true))
+    {
+        Services::Logging::Warn(_logger, "Sink {}: the sink is closed, traced messages are not written", _name);
+    }
+}
+
+void PcapSink::WakeUpWriter()
+{
+    if (_writerIdle)
+    {
+        std::lock_guard<std::mutex> lock{_wakeUpMutex};
+        _wakeUp.notify_one();
+    }
+}
+
+void PcapSink::StopWriter()
+{
+    _isOpen = false;
+    if (_writerThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock{_wakeUpMutex};
+            _stopWriter = true;
+            _wakeUp.notify_one();
+            _spaceAvailable.notify_all();
+        }
+        _writerThread.join();
+    }
+}
+
+void PcapSink::WriterLoop()
+{
+    Util::SetThreadName("SilKit-PcapSink");
+
+    std::vector<uint8_t> batch;
+    batch.reserve(BatchSize);
+    std::vector<uint8_t> packet;
+
+    while (true)
+    {
+        // NB: read the flag before draining, such that all packets queued before Close are written
+        const bool stopping = _stopWriter;
+
+        while (batch.size() < BatchSize && _queue.TryPop(packet))
+        {
+            batch.insert(batch.end(), packet.begin(), packet.end());
         }
 
-        ok &= _pipe->Write(reinterpret_cast<const char*>(&pcapPacketHeader), sizeof(pcapPacketHeader));
-        ok &= _pipe->Write(reinterpret_cast<const char*>(&message.raw.at(0)), message.raw.size());
+        if (_numBlockedProducers > 0)
+        {
+            std::lock_guard<std::mutex> lock{_wakeUpMutex};
+            _spaceAvailable.notify_all();
+        }
+
+        if (!batch.empty())
+        {
+            WriteBatch(batch);
+            batch.clear();
+            continue;
+        }
+
+        if (stopping)
+        {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock{_wakeUpMutex};
+        _writerIdle = true;
+        if (!_stopWriter)
+        {
+            _wakeUp.wait_for(lock, WriterIdleTimeout);
+        }
+        _writerIdle = false;
+    }
+
+    // An empty trace file is still a valid PCAP file
+    if (!_headerWritten && _file.is_open() && !_writeFailed)
+    {
+        const Pcap::GlobalHeader globalHeader{};
+        _file.write(reinterpret_cast<const char*>(&globalHeader), sizeof(globalHeader));
+        _headerWritten = true;
+    }
+}
+
+void PcapSink::WriteBatch(const std::vector<uint8_t>& batch)
+{
+    if (_writeFailed)
+    {
+        return;
+    }
+
+    try
+    {
+        if (!_headerWritten)
+        {
+            WriteGlobalHeader(_linkType);
+        }
+
+        bool ok = true;
+        if (_file.is_open())
+        {
+            _file.write(reinterpret_cast<const char*>(batch.data()), batch.size());
+            ok &= _file.good();
+        }
+        if (_pipe)
+        {
+            ok &= _pipe->Write(reinterpret_cast<const char*>(batch.data()), batch.size());
+        }
+        if (!ok)
+        {
+            throw SilKitError("Failed to write trace message to PCAP sink");
+        }
+    }
+    catch (const std::exception& error)
+    {
+        Services::Logging::Error(_logger, "Sink {}: {}", _name, error.what());
+        _writeFailed = true;
+    }
+}
+
+void PcapSink::WriteGlobalHeader(uint32_t linkType)
+{
+    Pcap::GlobalHeader globalHeader{};
+    globalHeader.network = linkType;
+
+    bool ok = true;
+    if (_file.is_open())
+    {
+        _file.write(reinterpret_cast<const char*>(&globalHeader), sizeof(globalHeader));
+        ok &= _file.good();
+    }
+
+    if (_pipe)
+    {
+        Services::Logging::Info(_logger, "Sink {}: Waiting for a reader to connect to PCAP pipe {} ... ", _name,
+                                _outputPath);
+        ok &= _pipe->Write(reinterpret_cast<const char*>(&globalHeader), sizeof(globalHeader));
+        Services::Logging::Debug(_logger, "Sink {}: PCAP pipe: {} is connected successfully", _name, _outputPath);
     }
 
+    _headerWritten = true;
     if (!ok)
     {
-        throw SilKitError("Failed to write trace message to PCAP sink");
+        throw SilKitError("Failed to write the global header to PCAP sink");
     }
 }
 
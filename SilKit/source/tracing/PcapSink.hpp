@@ -21,27 +21,41 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <fstream>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "ITraceMessageSink.hpp"
 
 #include "EndpointAddress.hpp"
+#include "BoundedQueue.hpp"
 #include "detail/NamedPipe.hpp"
 
 namespace SilKit {
 namespace Tracing {
 
+/*! \brief Writes Ethernet, CAN, LIN and FlexRay frames in the PCAP format
+ *
+ *  Trace only encodes the packet and hands it to a writer thread, which writes the queued packets in batches.
+ *  The data link type of the output is chosen by the first traced frame, frames of other bus types are dropped.
+ *  If the queue is full, Trace waits or drops the packet, depending on the overflow policy.
+ */
 class PcapSink : public ITraceMessageSink
 {
 public:
+    using OverflowPolicy = Config::TraceSink::OverflowPolicy;
+
     // ----------------------------------------
     // Constructors and Destructor
     PcapSink() = delete;
     PcapSink(const PcapSink&) = delete;
-    PcapSink(Services::Logging::ILogger* logger, std::string name);
-    ~PcapSink() = default;
+    PcapSink(Services::Logging::ILogger* logger, std::string name,
+             OverflowPolicy overflowPolicy = OverflowPolicy::Block);
+    ~PcapSink() override;
 
     // ----------------------------------------
     // Public methods
@@ -56,17 +70,52 @@ public:
 
     auto Name() const -> const std::string& override;
 
+    //! Number of packets which were dropped, because the queue was full
+    auto NumberOfDroppedPackets() const -> uint64_t;
+
+private:
+    // ----------------------------------------
+    // Private methods
+    bool SelectLinkType(uint32_t linkType);
+    void Enqueue(std::vector<uint8_t> packet);
+    void WakeUpWriter();
+    void WarnTraceAfterClose();
+    void StopWriter();
+
+    // Executed by the writer thread
+    void WriterLoop();
+    void WriteBatch(const std::vector<uint8_t>& batch);
+    void WriteGlobalHeader(uint32_t linkType);
+
 private:
     // ----------------------------------------
     // Private members
-    bool _headerWritten{false};
-    std::ofstream _file;
-    std::unique_ptr<Detail::NamedPipe> _pipe;
-    std::mutex _lock;
     std::string _name;
-    std::string _busName;
     std::string _outputPath;
     Services::Logging::ILogger* _logger{nullptr};
+    OverflowPolicy _overflowPolicy;
+
+    // NB: only accessed by the writer thread while it is running
+    bool _headerWritten{false};
+    std::ofstream _file;
+    std::unique_ptr<Detail::NamedPipe> _pipe;
+
+    std::atomic<uint32_t> _linkType{0}; //!< 0 until the first frame is traced
+    Util::BoundedQueue<std::vector<uint8_t>> _queue;
+    std::thread _writerThread;
+    std::atomic<bool> _isOpen{false};
+    std::atomic<bool> _stopWriter{false};
+    std::atomic<bool> _writeFailed{false};
+    std::atomic<bool> _writerIdle{false};
+    std::mutex _wakeUpMutex;
+    std::condition_variable _wakeUp;
+    std::condition_variable _spaceAvailable; //!< signaled by the writer after draining, if producers are blocked
+    std::atomic<size_t> _numBlockedProducers{0};
+
+    std::atomic<uint64_t> _numDroppedPackets{0};
+    std::atomic<bool> _warnedUnsupportedMessage{false};
+    std::atomic<bool> _warnedOtherLinkType{false};
+    std::atomic<bool> _warnedTraceAfterClose{false};
 };
 
 } // namespace Tracing
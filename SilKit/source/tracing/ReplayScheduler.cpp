@@ -325,6 +325,7 @@ void ReplayScheduler::ConfigureController(const std::string& controllerName, IRe
         }
 
         task.replayReader = replayChannel->GetReader();
+        task.indexedReader = dynamic_cast<ITimeIndexedReader*>(task.replayReader.get());
         task.initialTime = replayChannel->StartTime();
         task.name = replayChannel->Name();
         task.replayFile = std::move(replayFile);
@@ -386,6 +387,17 @@ void ReplayScheduler::ReplayMessages(std::chrono::nanoseconds now, std::chrono::
             continue;
         }
 
+        if (task.indexedReader != nullptr)
+        {
+            //NB: Currently, the messages are batched at the beginning of the schedule.
+            for (auto* msg : task.indexedReader->ReadWindow(relativeEnd))
+            {
+                task.controller->ReplayMessage(msg);
+            }
+            task.doneReplaying = task.indexedReader->IsAtEnd();
+            continue;
+        }
+
         while (true)
         {
             auto msg = task.replayReader->Read();
@@ -29,6 +29,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ParticipantConfiguration.hpp"
 #include "ITimeProvider.hpp"
 #include "IReplayDataController.hpp"
+#include "ITimeIndexedReader.hpp"
 #include "ISimulator.hpp"
 
 namespace SilKit {
@@ -62,6 +63,7 @@ private:
         std::string name;
         IReplayDataController* controller{nullptr};
         std::shared_ptr<IReplayChannelReader> replayReader;
+        ITimeIndexedReader* indexedReader{nullptr}; //!< Set if replayReader supports reading by time windows
         std::chrono::nanoseconds initialTime{0};
         bool doneReplaying{false};
     };
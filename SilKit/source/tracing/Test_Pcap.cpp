@@ -20,10 +20,16 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "PcapReader.hpp"
+#include "PcapSink.hpp"
 
+#include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <iterator>
 
 #include "silkit/services/ethernet/EthernetDatatypes.hpp"
+#include "silkit/services/can/CanDatatypes.hpp"
+#include "silkit/services/lin/LinDatatypes.hpp"
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -37,6 +43,8 @@ namespace {
 using namespace SilKit::Tracing;
 using namespace SilKit::Services::Ethernet;
 using namespace SilKit::Core::Tests;
+using namespace SilKit::Services::Can;
+using namespace SilKit::Services::Lin;
 
 std::vector<uint8_t> MakePcapTestData(WireEthernetFrame& wireFrame, size_t numMessages)
 {
@@ -107,4 +115,181 @@ TEST(ReplayTest, read_from_pcap)
     EXPECT_EQ((int)numMessages, 10);
 }
 
+TEST(ReplayTest, read_window_uses_the_index)
+{
+    MockLogger log;
+    std::stringstream ss;
+
+    WireEthernetFrame testInput;
+    auto raw = MakePcapTestData(testInput, 10);
+    ss.write(reinterpret_cast<char*>(raw.data()), raw.size());
+
+    PcapReader reader{&ss, &log};
+    ASSERT_EQ(reader.NumberOfMessages(), 10u);
+    // message i has the timestamp i seconds and i microseconds
+    EXPECT_EQ(reader.StartTime(), std::chrono::nanoseconds{0});
+    EXPECT_EQ(reader.EndTime(), std::chrono::seconds{9} + std::chrono::microseconds{9});
+
+    EXPECT_EQ(reader.ReadWindow(std::chrono::seconds{5}).size(), 5u);
+    EXPECT_EQ(reader.Read()->Timestamp(), std::chrono::seconds{5} + std::chrono::microseconds{5});
+
+    auto window = reader.ReadWindow(std::chrono::seconds{8});
+    ASSERT_EQ(window.size(), 3u);
+    for (auto i = 0u; i < window.size(); i++)
+    {
+        EXPECT_EQ(window[i]->Timestamp(), std::chrono::seconds{5 + i} + std::chrono::microseconds{5 + i});
+        auto& frame = dynamic_cast<WireEthernetFrame&>(*window[i]);
+        EXPECT_TRUE(ItemsAreEqual(frame.raw.AsSpan(), testInput.raw.AsSpan()));
+    }
+
+    // an empty window does not advance the reader
+    EXPECT_EQ(reader.ReadWindow(std::chrono::seconds{8}).size(), 0u);
+    EXPECT_EQ(reader.ReadWindow(std::chrono::seconds{100}).size(), 2u);
+    EXPECT_TRUE(reader.IsAtEnd());
+    EXPECT_EQ(reader.Read(), nullptr);
+
+    // copies of the reader start at the first message
+    PcapReader copy{reader};
+    EXPECT_FALSE(copy.IsAtEnd());
+    EXPECT_EQ(copy.Read()->Timestamp(), std::chrono::nanoseconds{0});
+}
+
+TEST(ReplayTest, read_from_memory_mapped_file)
+{
+    const std::string path{"ReplayTest_mapped.pcap"};
+    MockLogger log;
+
+    WireEthernetFrame testInput;
+    auto raw = MakePcapTestData(testInput, 3);
+    // a truncated packet at the end of the file is ignored
+    raw.resize(raw.size() - 1);
+    {
+        std::ofstream file{path, std::ios::binary};
+        file.write(reinterpret_cast<const char*>(raw.data()), raw.size());
+    }
+
+    {
+        PcapReader reader{path, &log};
+        EXPECT_EQ(reader.NumberOfMessages(), 2u);
+        EXPECT_EQ(reader.GetMetaInfos().at("pcap/version"), "2.4");
+
+        auto window = reader.ReadWindow(std::chrono::seconds{10});
+        ASSERT_EQ(window.size(), 2u);
+        auto& frame = dynamic_cast<WireEthernetFrame&>(*window[1]);
+        EXPECT_TRUE(ItemsAreEqual(frame.raw.AsSpan(), testInput.raw.AsSpan()));
+    }
+    std::remove(path.c_str());
+}
+
+auto ReadFile(const std::string& path) -> std::vector<uint8_t>
+{
+    std::ifstream file{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+auto LinkTypeOf(const std::vector<uint8_t>& pcap) -> uint32_t
+{
+    Pcap::GlobalHeader globalHeader{};
+    memcpy(&globalHeader, pcap.data(), sizeof(globalHeader));
+    return globalHeader.network;
+}
+
+TEST(PcapSinkTest, empty_trace_is_valid_pcap_file)
+{
+    const std::string path{"PcapSinkTest_empty.pcap"};
+    MockLogger log;
+    {
+        PcapSink sink{&log, "Sink"};
+        sink.Open(SilKit::SinkType::PcapFile, path);
+        sink.Close();
+    }
+
+    const auto pcap = ReadFile(path);
+    std::remove(path.c_str());
+
+    ASSERT_EQ(pcap.size(), Pcap::GlobalHeaderSize);
+    EXPECT_EQ(LinkTypeOf(pcap), Pcap::LinkTypeEthernet);
+}
+
+TEST(PcapSinkTest, can_frames_are_written_as_socketcan)
+{
+    const std::string path{"PcapSinkTest_can.pcap"};
+    MockLogger log;
+
+    std::vector<uint8_t> payload{1, 2, 3};
+    CanFrameEvent event{};
+    event.frame.canId = 0x123456;
+    event.frame.flags = static_cast<CanFrameFlagMask>(CanFrameFlag::Ide);
+    event.frame.dataField = payload;
+
+    LinFrame linFrame{};
+    linFrame.id = 0x10;
+
+    PcapSink sink{&log, "Sink"};
+    sink.Open(SilKit::SinkType::PcapFile, path);
+    for (auto i = 0; i < 100; i++)
+    {
+        sink.Trace(SilKit::Services::TransmitDirection::TX, {}, std::chrono::microseconds{i}, SilKit::TraceMessage{event});
+    }
+    // the output already has the CAN link type
+    sink.Trace(SilKit::Services::TransmitDirection::TX, {}, std::chrono::microseconds{100}, SilKit::TraceMessage{linFrame});
+    sink.Close();
+
+    const auto pcap = ReadFile(path);
+    std::remove(path.c_str());
+
+    const auto packetSize = Pcap::PacketHeaderSize + 8 + payload.size();
+    ASSERT_EQ(pcap.size(), Pcap::GlobalHeaderSize + 100 * packetSize);
+    EXPECT_EQ(LinkTypeOf(pcap), Pcap::LinkTypeCanSocketCan);
+    EXPECT_EQ(sink.NumberOfDroppedPackets(), 0u);
+
+    const auto* lastPacket = pcap.data() + Pcap::GlobalHeaderSize + 99 * packetSize;
+    Pcap::PacketHeader packetHeader{};
+    memcpy(&packetHeader, lastPacket, sizeof(packetHeader));
+    EXPECT_EQ(packetHeader.ts_usec, 99u);
+    EXPECT_EQ(packetHeader.incl_len, 8 + payload.size());
+
+    const std::vector<uint8_t> expected{0x80, 0x12, 0x34, 0x56, 3, 0, 0, 0, 1, 2, 3};
+    EXPECT_EQ(std::vector<uint8_t>(lastPacket + Pcap::PacketHeaderSize, lastPacket + packetSize), expected);
+}
+
+TEST(PcapSinkTest, lin_frames_contain_protected_id_and_checksum)
+{
+    const std::string path{"PcapSinkTest_lin.pcap"};
+    MockLogger log;
+
+    LinFrame linFrame{};
+    linFrame.id = 0x10;
+    linFrame.checksumModel = LinChecksumModel::Enhanced;
+    linFrame.dataLength = 2;
+    linFrame.data = {1, 2};
+
+    PcapSink sink{&log, "Sink"};
+    sink.Open(SilKit::SinkType::PcapFile, path);
+    sink.Trace(SilKit::Services::TransmitDirection::TX, {}, std::chrono::seconds{1}, SilKit::TraceMessage{linFrame});
+    sink.Close();
+
+    const auto pcap = ReadFile(path);
+    std::remove(path.c_str());
+
+    ASSERT_EQ(pcap.size(), Pcap::GlobalHeaderSize + Pcap::PacketHeaderSize + 8 + 2);
+    EXPECT_EQ(LinkTypeOf(pcap), Pcap::LinkTypeLin);
+
+    const std::vector<uint8_t> expected{1, 0, 0, 0, 0x21, 0x50, 0xAC, 0, 1, 2};
+    EXPECT_EQ(std::vector<uint8_t>(pcap.begin() + Pcap::GlobalHeaderSize + Pcap::PacketHeaderSize, pcap.end()),
+              expected);
+}
+
+TEST(ReplayTest, reading_non_ethernet_pcap_throws)
+{
+    MockLogger log;
+    std::stringstream ss;
+
+    Pcap::GlobalHeader globalHeader{};
+    globalHeader.network = Pcap::LinkTypeCanSocketCan;
+    ss.write(reinterpret_cast<const char*>(&globalHeader), sizeof(globalHeader));
+
+    EXPECT_THROW(PcapReader(&ss, &log), SilKit::SilKitError);
+}
+
 } // namespace
@@ -95,14 +95,14 @@ auto CreateTraceMessageSinks(Services::Logging::ILogger* logger,
         }
         case Config::TraceSink::Type::PcapFile:
         {
-            auto sink = std::make_unique<PcapSink>(logger, sinkCfg.name);
+            auto sink = std::make_unique<PcapSink>(logger, sinkCfg.name, sinkCfg.overflowPolicy);
             sink->Open(SinkType::PcapFile, sinkCfg.outputPath);
             newSinks.emplace_back(std::move(sink));
             break;
         }
         case Config::TraceSink::Type::PcapPipe:
         {
-            auto sink = std::make_unique<PcapSink>(logger, sinkCfg.name);
+            auto sink = std::make_unique<PcapSink>(logger, sinkCfg.name, sinkCfg.overflowPolicy);
             sink->Open(SinkType::PcapNamedPipe, sinkCfg.outputPath);
             newSinks.emplace_back(std::move(sink));
             break;
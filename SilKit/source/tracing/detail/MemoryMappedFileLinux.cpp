@@ -0,0 +1,122 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "silkit/participant/exception.hpp"
+
+#include "MemoryMappedFileLinux.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+namespace SilKit {
+namespace Tracing {
+namespace Detail {
+
+namespace {
+void ThrowError(const std::string& what, const std::string& path)
+{
+    std::stringstream ss;
+    ss << "Error mapping file \"" << path << "\": " << what << ": " << strerror(errno);
+    throw SilKitError(ss.str());
+}
+} // namespace
+
+MemoryMappedFileLinux::MemoryMappedFileLinux(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        ThrowError("open failed", path);
+    }
+
+    struct stat fileStat{};
+    if (::fstat(fd, &fileStat) == -1)
+    {
+        ::close(fd);
+        ThrowError("fstat failed", path);
+    }
+
+    _size = static_cast<size_t>(fileStat.st_size);
+    if (_size > 0)
+    {
+        _data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (_data == MAP_FAILED)
+        {
+            _data = nullptr;
+            ::close(fd);
+            ThrowError("mmap failed", path);
+        }
+        // the file is usually read front to back, let the kernel read ahead aggressively
+        ::madvise(_data, _size, MADV_SEQUENTIAL);
+    }
+
+    // the mapping keeps the file referenced
+    ::close(fd);
+}
+
+MemoryMappedFileLinux::~MemoryMappedFileLinux()
+{
+    if (_data != nullptr)
+    {
+        ::munmap(_data, _size);
+    }
+}
+
+auto MemoryMappedFileLinux::Data() const -> const uint8_t*
+{
+    return static_cast<const uint8_t*>(_data);
+}
+
+auto MemoryMappedFileLinux::Size() const -> size_t
+{
+    return _size;
+}
+
+void MemoryMappedFileLinux::Prefetch(size_t offset, size_t size) const
+{
+    if (_data == nullptr || offset >= _size)
+    {
+        return;
+    }
+
+    // madvise requires a page aligned address
+    static const auto pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const auto alignedOffset = offset - (offset % pageSize);
+    const auto alignedSize = (std::min)(size + (offset - alignedOffset), _size - alignedOffset);
+    ::madvise(static_cast<uint8_t*>(_data) + alignedOffset, alignedSize, MADV_WILLNEED);
+}
+
+// public Factory
+auto MemoryMappedFile::Open(const std::string& path) -> Ptr
+{
+    return std::make_unique<MemoryMappedFileLinux>(path);
+}
+
+} // namespace Detail
+} // namespace Tracing
+} // namespace SilKit
@@ -0,0 +1,116 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "silkit/participant/exception.hpp"
+
+#include "MemoryMappedFileWin.hpp"
+
+#include <sstream>
+
+namespace SilKit {
+namespace Tracing {
+namespace Detail {
+
+namespace {
+void ThrowError(const std::string& what, const std::string& path)
+{
+    std::stringstream ss;
+    ss << "Error mapping file \"" << path << "\": " << what << ": error " << GetLastError();
+    throw SilKitError(ss.str());
+}
+} // namespace
+
+MemoryMappedFileWin::MemoryMappedFileWin(const std::string& path)
+{
+    _fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (_fileHandle == INVALID_HANDLE_VALUE)
+    {
+        ThrowError("CreateFile failed", path);
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(_fileHandle, &fileSize))
+    {
+        CloseHandle(_fileHandle);
+        ThrowError("GetFileSizeEx failed", path);
+    }
+
+    _size = static_cast<size_t>(fileSize.QuadPart);
+    if (_size > 0)
+    {
+        _mappingHandle = CreateFileMappingA(_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (_mappingHandle == NULL)
+        {
+            CloseHandle(_fileHandle);
+            ThrowError("CreateFileMapping failed", path);
+        }
+        _data = static_cast<const uint8_t*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (_data == nullptr)
+        {
+            CloseHandle(_mappingHandle);
+            CloseHandle(_fileHandle);
+            ThrowError("MapViewOfFile failed", path);
+        }
+    }
+}
+
+MemoryMappedFileWin::~MemoryMappedFileWin()
+{
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+    }
+    if (_mappingHandle != NULL)
+    {
+        CloseHandle(_mappingHandle);
+    }
+    if (_fileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(_fileHandle);
+    }
+}
+
+auto MemoryMappedFileWin::Data() const -> const uint8_t*
+{
+    return _data;
+}
+
+auto MemoryMappedFileWin::Size() const -> size_t
+{
+    return _size;
+}
+
+void MemoryMappedFileWin::Prefetch(size_t /*offset*/, size_t /*size*/) const
+{
+    // NB: PrefetchVirtualMemory is not available on all supported Windows versions, the sequential scan hint of the
+    //     file handle makes the cache manager read ahead instead.
+}
+
+// public Factory
+auto MemoryMappedFile::Open(const std::string& path) -> Ptr
+{
+    return std::make_unique<MemoryMappedFileWin>(path);
+}
+
+} // namespace Detail
+} // namespace Tracing
+} // namespace SilKit
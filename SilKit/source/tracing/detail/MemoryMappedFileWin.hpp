@@ -0,0 +1,58 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include "MemoryMappedFile.hpp"
+
+#include <windows.h>
+
+namespace SilKit {
+namespace Tracing {
+namespace Detail {
+
+class MemoryMappedFileWin : public MemoryMappedFile
+{
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    MemoryMappedFileWin(const std::string& path);
+    ~MemoryMappedFileWin();
+
+public:
+    // ----------------------------------------
+    // Public interface methods
+    auto Data() const -> const uint8_t* override;
+    auto Size() const -> size_t override;
+    void Prefetch(size_t offset, size_t size) const override;
+
+private:
+    // ----------------------------------------
+    // private members
+    HANDLE _fileHandle{INVALID_HANDLE_VALUE};
+    HANDLE _mappingHandle{NULL};
+    const uint8_t* _data{nullptr};
+    size_t _size{0};
+};
+
+} // namespace Detail
+} // namespace Tracing
+} // namespace SilKit
@@ -0,0 +1,161 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace SilKit {
+namespace Util {
+
+/*! \brief Bounded lock-free queue for multiple producers and consumers
+ *
+ *  Each slot carries a sequence number, which tells producers and consumers whether the slot is free or occupied
+ *  for the current lap (D. Vyukov's bounded MPMC queue). TryPush and TryPop never block and fail if the queue is
+ *  full or empty, respectively.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+    //! The capacity is rounded up to the next power of two
+    explicit BoundedQueue(std::size_t capacity);
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    //! Returns false (and leaves the value untouched) if the queue is full
+    bool TryPush(T&& value);
+    //! Returns false if the queue is empty
+    bool TryPop(T& value);
+
+    auto Capacity() const -> std::size_t { return _mask + 1; }
+
+private:
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    static auto RoundUpToPowerOfTwo(std::size_t value) -> std::size_t;
+
+private:
+    const std::size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+    // NB: separate cache lines for the producers and the consumers
+    alignas(64) std::atomic<std::size_t> _pushPos{0};
+    alignas(64) std::atomic<std::size_t> _popPos{0};
+};
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+
+template <typename T>
+BoundedQueue<T>::BoundedQueue(std::size_t capacity)
+    : _mask{RoundUpToPowerOfTwo(capacity) - 1}
+    , _slots{new Slot[_mask + 1]}
+{
+    for (std::size_t i = 0; i <= _mask; ++i)
+    {
+        _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool BoundedQueue<T>::TryPush(T&& value)
+{
+    auto pos = _pushPos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        auto& slot = _slots[pos & _mask];
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+        if (difference == 0)
+        {
+            if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot.value = std::move(value);
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the slot still holds the value of the previous lap
+            return false;
+        }
+        else
+        {
+            pos = _pushPos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+bool BoundedQueue<T>::TryPop(T& value)
+{
+    auto pos = _popPos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        auto& slot = _slots[pos & _mask];
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+        if (difference == 0)
+        {
+            if (_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                value = std::move(slot.value);
+                slot.sequence.store(pos + _mask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = _popPos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+auto BoundedQueue<T>::RoundUpToPowerOfTwo(std::size_t value) -> std::size_t
+{
+    if (value < 2)
+    {
+        return 2;
+    }
+    std::size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace Util
+} // namespace SilKit
@@ -0,0 +1,193 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace SilKit {
+namespace Util {
+
+/*! \brief Hash map with open addressing in a single contiguous array
+ *
+ *  Collisions are resolved by linear probing, erased slots are closed by shifting the following entries of the
+ *  probe sequence back (no tombstones). The table grows by doubling when it is half full. Key and Value must be
+ *  default constructible and movable. Pointers returned by Find are invalidated by Insert and Erase.
+ */
+template <typename Key, typename Value, typename Hasher = std::hash<Key>>
+class FlatHashMap
+{
+public:
+    FlatHashMap() = default;
+
+    //! Returns false (and leaves the map untouched) if the key is already present
+    bool Insert(const Key& key, Value value);
+    //! Returns nullptr if the key is not present
+    auto Find(const Key& key) -> Value*;
+    //! Returns false if the key is not present
+    bool Erase(const Key& key);
+
+    auto Size() const -> std::size_t { return _size; }
+    bool Empty() const { return _size == 0; }
+    void Clear();
+
+private:
+    struct Slot
+    {
+        bool occupied{false};
+        Key key{};
+        Value value{};
+    };
+
+    auto IndexOf(const Key& key) const -> std::size_t;
+    auto FindSlot(const Key& key) const -> std::size_t;
+    void Grow();
+
+private:
+    std::vector<Slot> _slots;
+    std::size_t _size{0};
+    Hasher _hasher{};
+};
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+
+template <typename Key, typename Value, typename Hasher>
+bool FlatHashMap<Key, Value, Hasher>::Insert(const Key& key, Value value)
+{
+    if (2 * (_size + 1) > _slots.size())
+    {
+        Grow();
+    }
+
+    const auto mask = _slots.size() - 1;
+    auto index = IndexOf(key);
+    while (_slots[index].occupied)
+    {
+        if (_slots[index].key == key)
+        {
+            return false;
+        }
+        index = (index + 1) & mask;
+    }
+
+    auto& slot = _slots[index];
+    slot.occupied = true;
+    slot.key = key;
+    slot.value = std::move(value);
+    ++_size;
+    return true;
+}
+
+template <typename Key, typename Value, typename Hasher>
+auto FlatHashMap<Key, Value, Hasher>::Find(const Key& key) -> Value*
+{
+    const auto index = FindSlot(key);
+    return index == _slots.size() ? nullptr : &_slots[index].value;
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool FlatHashMap<Key, Value, Hasher>::Erase(const Key& key)
+{
+    auto hole = FindSlot(key);
+    if (hole == _slots.size())
+    {
+        return false;
+    }
+
+    // move entries of the probe sequence into the hole, unless their home slot lies (cyclically) after the hole
+    const auto mask = _slots.size() - 1;
+    for (auto index = (hole + 1) & mask; _slots[index].occupied; index = (index + 1) & mask)
+    {
+        const auto home = IndexOf(_slots[index].key);
+        if (((index - home) & mask) >= ((index - hole) & mask))
+        {
+            _slots[hole].key = std::move(_slots[index].key);
+            _slots[hole].value = std::move(_slots[index].value);
+            hole = index;
+        }
+    }
+
+    _slots[hole] = Slot{};
+    --_size;
+    return true;
+}
+
+template <typename Key, typename Value, typename Hasher>
+void FlatHashMap<Key, Value, Hasher>::Clear()
+{
+    _slots.clear();
+    _size = 0;
+}
+
+template <typename Key, typename Value, typename Hasher>
+auto FlatHashMap<Key, Value, Hasher>::IndexOf(const Key& key) const -> std::size_t
+{
+    // NB: std::hash is the identity for integers on common platforms, mix the bits before masking (SplitMix64)
+    auto hash = static_cast<uint64_t>(_hasher(key));
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+    hash = hash ^ (hash >> 31);
+    return static_cast<std::size_t>(hash) & (_slots.size() - 1);
+}
+
+template <typename Key, typename Value, typename Hasher>
+auto FlatHashMap<Key, Value, Hasher>::FindSlot(const Key& key) const -> std::size_t
+{
+    if (_size == 0)
+    {
+        return _slots.size();
+    }
+
+    const auto mask = _slots.size() - 1;
+    for (auto index = IndexOf(key); _slots[index].occupied; index = (index + 1) & mask)
+    {
+        if (_slots[index].key == key)
+        {
+            return index;
+        }
+    }
+    return _slots.size();
+}
+
+template <typename Key, typename Value, typename Hasher>
+void FlatHashMap<Key, Value, Hasher>::Grow()
+{
+    std::vector<Slot> slots(_slots.empty() ? 16 : 2 * _slots.size());
+    std::swap(_slots, slots);
+    _size = 0;
+
+    for (auto& slot : slots)
+    {
+        if (slot.occupied)
+        {
+            Insert(slot.key, std::move(slot.value));
+        }
+    }
+}
+
+} // namespace Util
+} // namespace SilKit
@@ -23,67 +23,143 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/util/HandlerId.hpp"
 
-#include <map>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <iterator>
+#include <memory>
 #include <mutex>
+#include <type_traits>
+#include <vector>
 
 namespace SilKit {
 namespace Util {
 
+/*! \brief Registry of handlers which are invoked without locking the registry
+ *
+ *  The handlers are stored by value in an immutable snapshot, which is replaced (copy-on-write) by Add and Remove.
+ *  InvokeAll only loads the current snapshot and iterates it. Handlers may add and remove handlers while they are
+ *  invoked: removed handlers are not invoked anymore, added handlers are invoked by the running InvokeAll, like
+ *  before with the recursive mutex. Invocations on different threads run concurrently, also of the same handler.
+ *
+ *  Remove waits for a grace period: it returns only after the InvokeAll calls on other threads, which may still see
+ *  the removed handler, have returned. The state captured by the handler may be released afterwards. Invocations on
+ *  the calling thread are not waited for, so a handler may remove itself or other handlers. Handlers running on two
+ *  threads must not remove handlers of the same registry concurrently, because each would wait for the other.
+ *
+ *  Replaced snapshots are kept and reused for later snapshots, their handlers are destroyed as soon as no InvokeAll
+ *  iterates them anymore.
+ */
 template <typename Callable>
 class SynchronizedHandlers
 {
-    using Mutex = std::recursive_mutex;
+    using HandlerIdT = std::underlying_type_t<HandlerId>;
 
-    struct State
+    struct Entry
     {
-        // NB: entries must not invalidate iterators on adding or removing (i.e., node-based containers like map are
-        //     fine, containers like vector are not)
-        std::map<HandlerId, Callable> entries;
-        std::underlying_type_t<HandlerId> nextHandlerId = 0;
-
-        friend void swap(State &a, State &b) noexcept
+        template <typename... T>
+        explicit Entry(HandlerIdT handlerId, T &&...t)
+            : id{handlerId}
+            , callable{std::forward<T>(t)...}
         {
-            using std::swap;
-            swap(a.entries, b.entries);
-            swap(a.nextHandlerId, b.nextHandlerId);
         }
+
+        HandlerIdT id;
+        Callable callable;
+    };
+
+    struct Snapshot
+    {
+        // NB: the entries are sorted by their id, because new handlers get increasing ids
+        std::vector<Entry> entries;
+        //! Snapshots published later have a higher version
+        uint64_t version{0};
+        //! Number of running InvokeAll which iterate this snapshot
+        std::atomic<std::size_t> readers{0};
     };
 
 public:
-    SynchronizedHandlers() = default;
+    SynchronizedHandlers()
+        : _snapshot{new Snapshot{}}
+    {
+    }
+
+    SynchronizedHandlers(const SynchronizedHandlers &) = delete;
+    SynchronizedHandlers &operator=(const SynchronizedHandlers &) = delete;
+
+    ~SynchronizedHandlers() { delete _snapshot.load(); }
 
     template <typename... T>
     auto Add(T &&...t) -> HandlerId
     {
         const auto lock = MakeUniqueLock();
 
-        const auto handlerId = MakeHandlerId();
-        _state.entries.emplace(handlerId, Callable{std::forward<T>(t)...});
+        const auto handlerId = _nextHandlerId++;
+        const auto &current = _snapshot.load()->entries;
+        auto snapshot = MakeSnapshot();
+        snapshot->entries.reserve(current.size() + 1);
+        snapshot->entries.insert(snapshot->entries.end(), current.begin(), current.end());
+        snapshot->entries.emplace_back(handlerId, std::forward<T>(t)...);
+        Publish(std::move(snapshot));
 
-        return handlerId;
+        return static_cast<HandlerId>(handlerId);
     }
 
     auto Remove(const HandlerId handlerId) -> bool
     {
-        const auto lock = MakeUniqueLock();
+        auto lock = MakeUniqueLock();
 
-        return _state.entries.erase(handlerId) != 0;
+        const auto &current = _snapshot.load()->entries;
+        const auto it = FindEntry(current, static_cast<HandlerIdT>(handlerId));
+        if (it == current.end() || it->id != static_cast<HandlerIdT>(handlerId))
+        {
+            return false;
+        }
+
+        auto snapshot = MakeSnapshot();
+        snapshot->entries.reserve(current.size() - 1);
+        snapshot->entries.insert(snapshot->entries.end(), current.begin(), it);
+        snapshot->entries.insert(snapshot->entries.end(), std::next(it), current.end());
+        const auto version = Publish(std::move(snapshot));
+
+        WaitForGracePeriod(lock, version);
+        ClearRetiredSnapshots();
+
+        return true;
     }
 
     template <typename... T>
     bool InvokeAll(T &&...t)
     {
-        const auto lock = MakeUniqueLock();
+        InvocationGuard guard{*this};
 
-        for (const auto &kv : _state.entries)
+        auto it = guard.snapshot->entries.cbegin();
+        while (it != guard.snapshot->entries.cend())
         {
-            kv.second(t...);
+            const auto id = it->id;
+            it->callable(t...);
+
+            if (_snapshot.load(std::memory_order_acquire) == guard.snapshot)
+            {
+                ++it;
+                continue;
+            }
+
+            // The handlers were changed: continue with the handlers after the invoked one in the current snapshot
+            guard.SwitchToCurrentSnapshot();
+            it = FindEntry(guard.snapshot->entries, id + 1);
         }
 
-        return !_state.entries.empty();
+        return !guard.snapshot->entries.empty();
     }
 
-    auto Size() -> size_t { return _state.entries.size(); }
+    auto Size() -> size_t
+    {
+        // NB: the lock keeps the current snapshot from being replaced and reused
+        const auto lock = MakeUniqueLock();
+        return _snapshot.load()->entries.size();
+    }
 
 public:
     friend void swap(SynchronizedHandlers &a, SynchronizedHandlers &b) noexcept
@@ -98,25 +174,189 @@ public:
 
         std::lock(aLock, bLock);
 
+        // The entries are copied, because running invocations keep the snapshots of their own instance
+        auto aSnapshot = a.MakeSnapshot();
+        aSnapshot->entries = b._snapshot.load()->entries;
+        auto bSnapshot = b.MakeSnapshot();
+        bSnapshot->entries = a._snapshot.load()->entries;
+        a.Publish(std::move(aSnapshot));
+        b.Publish(std::move(bSnapshot));
+
         using std::swap;
-        swap(a._state, b._state);
+        swap(a._nextHandlerId, b._nextHandlerId);
     }
 
 private:
-    auto MakeUniqueLock() const -> std::unique_lock<Mutex> { return std::unique_lock<Mutex>{_mutex}; }
+    //! Registers a running InvokeAll with the snapshot it iterates
+    struct InvocationGuard
+    {
+        explicit InvocationGuard(SynchronizedHandlers &handlers)
+            : handlers{handlers}
+            , snapshot{handlers.AcquireSnapshot()}
+            , outer{CurrentInvocation()}
+        {
+            CurrentInvocation() = this;
+        }
+
+        ~InvocationGuard()
+        {
+            CurrentInvocation() = outer;
+            handlers.ReleaseSnapshot(*snapshot);
+        }
+
+        void SwitchToCurrentSnapshot()
+        {
+            auto *previous = snapshot;
+            snapshot = handlers.AcquireSnapshot();
+            handlers.ReleaseSnapshot(*previous);
+        }
+
+        SynchronizedHandlers &handlers;
+        Snapshot *snapshot;
+        InvocationGuard *outer;
+    };
+
+    //! The innermost InvokeAll running on this thread, the outer ones are linked
+    static auto CurrentInvocation() -> InvocationGuard *&
+    {
+        static thread_local InvocationGuard *current{nullptr};
+        return current;
+    }
+
+    static auto FindEntry(const std::vector<Entry> &entries, HandlerIdT id) ->
+        typename std::vector<Entry>::const_iterator
+    {
+        return std::lower_bound(entries.begin(), entries.end(), id,
+                                [](const Entry &entry, HandlerIdT value) { return entry.id < value; });
+    }
 
-    auto MakeDeferredLock() const -> std::unique_lock<Mutex>
+    auto AcquireSnapshot() -> Snapshot *
     {
-        return std::unique_lock<Mutex>{_mutex, std::defer_lock};
+        while (true)
+        {
+            // NB: the snapshot may have been replaced and reused in the meantime, but it is never deleted
+            auto *snapshot = _snapshot.load();
+            ++snapshot->readers;
+            // If the snapshot is still current, it is neither reused nor waited for without seeing this reader
+            if (_snapshot.load() == snapshot)
+            {
+                return snapshot;
+            }
+            ReleaseSnapshot(*snapshot);
+        }
     }
 
-    auto MakeHandlerId() -> HandlerId { return static_cast<HandlerId>(_state.nextHandlerId++); }
+    void ReleaseSnapshot(Snapshot &snapshot)
+    {
+        const auto lastReader = --snapshot.readers == 0;
+        if (_waitingRemovers.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            ClearRetiredSnapshots();
+            _readersLeft.notify_all();
+        }
+        else if (lastReader && _hasRetiredEntries.load())
+        {
+            std::unique_lock<std::mutex> lock{_mutex, std::try_to_lock};
+            if (lock.owns_lock())
+            {
+                ClearRetiredSnapshots();
+            }
+        }
+    }
+
+    // NB: must be called with the _mutex locked
+    void WaitForGracePeriod(std::unique_lock<std::mutex> &lock, uint64_t version)
+    {
+        ++_waitingRemovers;
+        _readersLeft.wait(lock, [this, version] {
+            return std::all_of(_retiredSnapshots.begin(), _retiredSnapshots.end(),
+                               [this, version](const std::unique_ptr<Snapshot> &snapshot) {
+                                   return snapshot->version >= version
+                                          || snapshot->readers.load() == CountOwnReaders(*snapshot);
+                               });
+        });
+        --_waitingRemovers;
+    }
+
+    //! Number of InvokeAll on the calling thread which iterate the snapshot
+    auto CountOwnReaders(const Snapshot &snapshot) const -> std::size_t
+    {
+        std::size_t count = 0;
+        for (auto *invocation = CurrentInvocation(); invocation != nullptr; invocation = invocation->outer)
+        {
+            if (&invocation->handlers == this && invocation->snapshot == &snapshot)
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    // NB: must be called with the _mutex locked
+    auto MakeSnapshot() -> std::unique_ptr<Snapshot>
+    {
+        // A retired snapshot without readers is reused, a reader which still loaded it does not pass its check
+        const auto it = std::find_if(_retiredSnapshots.begin(), _retiredSnapshots.end(),
+                                     [](const std::unique_ptr<Snapshot> &snapshot) { return snapshot->readers == 0; });
+        if (it == _retiredSnapshots.end())
+        {
+            return std::make_unique<Snapshot>();
+        }
+
+        auto snapshot = std::move(*it);
+        _retiredSnapshots.erase(it);
+        snapshot->entries.clear();
+        return snapshot;
+    }
+
+    // NB: must be called with the _mutex locked
+    auto Publish(std::unique_ptr<Snapshot> snapshot) -> uint64_t
+    {
+        const auto version = ++_nextVersion;
+        snapshot->version = version;
+        _retiredSnapshots.emplace_back(_snapshot.exchange(snapshot.release()));
+        _hasRetiredEntries = true;
+        ClearRetiredSnapshots();
+        return version;
+    }
+
+    // NB: must be called with the _mutex locked
+    void ClearRetiredSnapshots()
+    {
+        // A reader which acquires a retired snapshot after this check does not pass its check and never sees the entries
+        bool hasRetiredEntries = false;
+        for (const auto &snapshot : _retiredSnapshots)
+        {
+            if (snapshot->readers.load() == 0)
+            {
+                snapshot->entries.clear();
+            }
+            hasRetiredEntries = hasRetiredEntries || !snapshot->entries.empty();
+        }
+        _hasRetiredEntries = hasRetiredEntries;
+    }
+
+    auto MakeUniqueLock() const -> std::unique_lock<std::mutex> { return std::unique_lock<std::mutex>{_mutex}; }
+
+    auto MakeDeferredLock() const -> std::unique_lock<std::mutex>
+    {
+        return std::unique_lock<std::mutex>{_mutex, std::defer_lock};
+    }
 
 private:
-    mutable Mutex _mutex;
+    // NB: Add, Remove and swap are serialized by the _mutex, InvokeAll does not lock it
+    mutable std::mutex _mutex;
+    HandlerIdT _nextHandlerId{0};
+    uint64_t _nextVersion{0};
+
+    std::atomic<Snapshot *> _snapshot;
+    std::vector<std::unique_ptr<Snapshot>> _retiredSnapshots;
+    std::atomic<bool> _hasRetiredEntries{false};
 
-    // NB: access to _state must be protected by locking the _mutex
-    State _state;
+    //! Signaled by finishing invocations while a Remove waits for the grace period
+    std::condition_variable _readersLeft;
+    std::atomic<std::size_t> _waitingRemovers{0};
 };
 
 } // namespace Util
@@ -0,0 +1,339 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace SilKit {
+namespace Util {
+
+/*! \brief Hierarchical timer wheel with intrusive entries
+ *
+ *  Deadlines are given in ticks. Level 0 has one slot per tick, each further level has slots which are SlotsPerLevel
+ *  times as wide. An entry is placed into the lowest level whose current window contains its deadline; when the
+ *  wheel advances into a slot of a higher level, the slot's entries are moved down (cascaded). Deadlines beyond the
+ *  window of the top level are kept in an overflow list, which is cascaded whenever a new top-level window starts.
+ *
+ *  Schedule and Cancel are O(1). Entries are owned by the caller and must be cancelled before they are destroyed.
+ *  The wheel is not thread-safe.
+ */
+class TimerWheel
+{
+public:
+    using Tick = uint64_t;
+
+    static constexpr unsigned SlotBits = 6;
+    static constexpr std::size_t SlotsPerLevel = std::size_t{1} << SlotBits;
+    static constexpr std::size_t Levels = 4;
+    // NB: a function, because a static constexpr member would need a definition in a translation unit (C++14)
+    static constexpr auto NoDeadline() -> Tick { return std::numeric_limits<Tick>::max(); }
+
+    class Entry
+    {
+    public:
+        Entry() = default;
+        Entry(const Entry&) = delete;
+        Entry& operator=(const Entry&) = delete;
+
+        //! True if the entry is scheduled or expired but not yet popped
+        bool IsLinked() const { return _head != nullptr; }
+        auto Deadline() const -> Tick { return _deadline; }
+
+    private:
+        friend class TimerWheel;
+
+        Entry* _prev{nullptr};
+        Entry* _next{nullptr};
+        Entry** _head{nullptr};
+        Tick _deadline{0};
+    };
+
+public:
+    explicit TimerWheel(Tick now = 0)
+        : _now{now}
+    {
+        for (auto& level : _slots)
+        {
+            level.fill(nullptr);
+        }
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    //! (Re-)schedules the entry; deadlines in the past expire on the next call to Advance
+    inline void Schedule(Entry& entry, Tick deadline);
+    //! Removes the entry from the wheel or from the expired entries
+    inline void Cancel(Entry& entry);
+
+    //! Moves all entries with a deadline up to and including now to the expired entries
+    inline void Advance(Tick now);
+    //! Returns the next expired entry, or nullptr. The returned entry is no longer linked.
+    inline auto PopExpired() -> Entry*;
+
+    /*! \brief The tick at which Advance has work to do next, i.e., an entry expires or a slot is cascaded
+     *
+     *  Returns NoDeadline() if no entry is scheduled.
+     */
+    inline auto NextDeadline() const -> Tick;
+
+    auto Now() const -> Tick { return _now; }
+    //! True if no entry is scheduled; expired entries are not counted
+    bool Empty() const { return _scheduled == 0; }
+
+private:
+    static constexpr Tick SlotMask = SlotsPerLevel - 1;
+
+    static auto Shift(std::size_t level) -> unsigned { return static_cast<unsigned>(level * SlotBits); }
+
+    inline void Insert(Entry& entry);
+    inline void Link(Entry& entry, Entry** head);
+    inline void Unlink(Entry& entry);
+    inline void Cascade(std::size_t level);
+    inline void CascadeOverflow();
+    inline void Reinsert(Entry*& head);
+
+private:
+    // all ticks before _now have been processed
+    Tick _now;
+    std::size_t _scheduled{0};
+    std::array<std::array<Entry*, SlotsPerLevel>, Levels> _slots;
+    // entries with a deadline beyond the window of the top level
+    Entry* _overflow{nullptr};
+    Entry* _expired{nullptr};
+    Entry* _expiredTail{nullptr};
+};
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+
+void TimerWheel::Schedule(Entry& entry, Tick deadline)
+{
+    Cancel(entry);
+    entry._deadline = deadline;
+    Insert(entry);
+    ++_scheduled;
+}
+
+void TimerWheel::Cancel(Entry& entry)
+{
+    if (!entry.IsLinked())
+    {
+        return;
+    }
+    if (entry._head != &_expired)
+    {
+        --_scheduled;
+    }
+    Unlink(entry);
+}
+
+void TimerWheel::Advance(Tick now)
+{
+    if (_scheduled == 0)
+    {
+        _now = (now == NoDeadline()) ? now : now + 1;
+        return;
+    }
+
+    while (_now <= now && _scheduled > 0)
+    {
+        // skip the ticks without expiring entries or cascading slots
+        const auto next = NextDeadline();
+        if (next > now)
+        {
+            _now = now + 1;
+            break;
+        }
+        _now = next;
+
+        // cascade from the top, so that entries can move down by several levels in one tick
+        if ((_now & ((Tick{1} << Shift(Levels)) - 1)) == 0)
+        {
+            CascadeOverflow();
+        }
+        for (auto level = Levels - 1; level > 0; --level)
+        {
+            if ((_now & ((Tick{1} << Shift(level)) - 1)) == 0)
+            {
+                Cascade(level);
+            }
+        }
+
+        auto& slot = _slots[0][_now & SlotMask];
+        while (slot != nullptr)
+        {
+            auto& entry = *slot;
+            Unlink(entry);
+            --_scheduled;
+            Link(entry, &_expired);
+        }
+
+        ++_now;
+    }
+
+    if (_scheduled == 0 && _now <= now)
+    {
+        _now = (now == NoDeadline()) ? now : now + 1;
+    }
+}
+
+auto TimerWheel::PopExpired() -> Entry*
+{
+    auto* entry = _expired;
+    if (entry != nullptr)
+    {
+        Unlink(*entry);
+    }
+    return entry;
+}
+
+auto TimerWheel::NextDeadline() const -> Tick
+{
+    if (_scheduled == 0)
+    {
+        return NoDeadline();
+    }
+
+    for (std::size_t level = 0; level < Levels; ++level)
+    {
+        const auto shift = Shift(level);
+        const auto windowStart = (_now >> (shift + SlotBits)) << (shift + SlotBits);
+        for (auto index = (_now >> shift) & SlotMask; index < SlotsPerLevel; ++index)
+        {
+            if (_slots[level][index] != nullptr)
+            {
+                const auto slotStart = windowStart + (index << shift);
+                return slotStart > _now ? slotStart : _now;
+            }
+        }
+    }
+
+    // only overflowing entries are left, they are cascaded at the start of the next top-level window
+    const auto topShift = Shift(Levels);
+    return ((_now >> topShift) + 1) << topShift;
+}
+
+void TimerWheel::Insert(Entry& entry)
+{
+    const auto deadline = entry._deadline < _now ? _now : entry._deadline;
+
+    for (std::size_t level = 0; level < Levels; ++level)
+    {
+        const auto windowShift = Shift(level) + SlotBits;
+        if ((deadline >> windowShift) == (_now >> windowShift))
+        {
+            Link(entry, &_slots[level][(deadline >> Shift(level)) & SlotMask]);
+            return;
+        }
+    }
+
+    Link(entry, &_overflow);
+}
+
+void TimerWheel::Link(Entry& entry, Entry** head)
+{
+    entry._head = head;
+    entry._prev = nullptr;
+
+    if (head == &_expired)
+    {
+        // expired entries keep the order in which they expired
+        entry._next = nullptr;
+        entry._prev = _expiredTail;
+        if (_expiredTail != nullptr)
+        {
+            _expiredTail->_next = &entry;
+        }
+        else
+        {
+            _expired = &entry;
+        }
+        _expiredTail = &entry;
+        return;
+    }
+
+    entry._next = *head;
+    if (*head != nullptr)
+    {
+        (*head)->_prev = &entry;
+    }
+    *head = &entry;
+}
+
+void TimerWheel::Unlink(Entry& entry)
+{
+    if (entry._prev != nullptr)
+    {
+        entry._prev->_next = entry._next;
+    }
+    else
+    {
+        *entry._head = entry._next;
+    }
+
+    if (entry._next != nullptr)
+    {
+        entry._next->_prev = entry._prev;
+    }
+    else if (entry._head == &_expired)
+    {
+        _expiredTail = entry._prev;
+    }
+
+    entry._prev = nullptr;
+    entry._next = nullptr;
+    entry._head = nullptr;
+}
+
+void TimerWheel::Cascade(std::size_t level)
+{
+    Reinsert(_slots[level][(_now >> Shift(level)) & SlotMask]);
+}
+
+void TimerWheel::CascadeOverflow()
+{
+    Reinsert(_overflow);
+}
+
+void TimerWheel::Reinsert(Entry*& head)
+{
+    // detach the list first, entries may be linked into the same list again
+    auto* entry = head;
+    head = nullptr;
+    while (entry != nullptr)
+    {
+        auto* next = entry->_next;
+        entry->_prev = nullptr;
+        entry->_next = nullptr;
+        entry->_head = nullptr;
+        Insert(*entry);
+        entry = next;
+    }
+}
+
+} // namespace Util
+} // namespace SilKit
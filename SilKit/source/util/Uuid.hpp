@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <string>
 #include <iosfwd>
 
+#include <cstddef>
 #include <cstdint>
 
 namespace SilKit {
@@ -47,5 +48,14 @@ auto operator<<(std::ostream& ostream, const Uuid& uuid) -> std::ostream&;
 
 auto to_string(const Uuid& uuid) -> std::string;
 
+//! Hash function object for unordered containers. The bits of random Uuids are uniformly distributed.
+struct UuidHash
+{
+    auto operator()(const Uuid& uuid) const -> std::size_t
+    {
+        return static_cast<std::size_t>(uuid.ab ^ uuid.cd);
+    }
+};
+
 } // namespace Util
 } // namespace SilKit
\ No newline at end of file
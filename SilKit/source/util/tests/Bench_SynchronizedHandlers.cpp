@@ -0,0 +1,154 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+// Dispatch benchmark of the handler registry over the number of registered handlers.
+//
+// Every round, InvokeAll calls all handlers with a message, as done by the controllers for every received message.
+// The SynchronizedHandlers are compared with the registry they replaced, which held a recursive mutex over a std::map
+// while invoking. The invocations run on one thread and concurrently on several threads, which the reference
+// serializes. Usage: Bench_SynchronizedHandlers [rounds] [threads]
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SynchronizedHandlers.hpp"
+
+namespace {
+
+using Handler = std::function<void(size_t)>;
+
+//! The registry as it was before the handlers were invoked from snapshots
+struct RecursiveMutexReference
+{
+    auto Add(Handler handler) -> SilKit::Util::HandlerId
+    {
+        std::unique_lock<std::recursive_mutex> lock{mutex};
+        const auto handlerId = static_cast<SilKit::Util::HandlerId>(nextHandlerId++);
+        entries.emplace(handlerId, std::move(handler));
+        return handlerId;
+    }
+
+    bool InvokeAll(size_t value)
+    {
+        std::unique_lock<std::recursive_mutex> lock{mutex};
+        for (const auto& kv : entries)
+        {
+            kv.second(value);
+        }
+        return !entries.empty();
+    }
+
+    std::recursive_mutex mutex;
+    std::map<SilKit::Util::HandlerId, Handler> entries;
+    std::underlying_type_t<SilKit::Util::HandlerId> nextHandlerId{0};
+};
+
+std::atomic<size_t> sink{0};
+// NB: the handlers count per thread, so the threads only contend on the registry
+thread_local size_t threadSink{0};
+
+template <typename Handlers>
+auto MeasureNanosecondsPerInvocation(size_t rounds, size_t numThreads, size_t numHandlers, Handlers& handlers) -> double
+{
+    const auto invokeAll = [rounds, &handlers] {
+        for (size_t i = 0; i < rounds; ++i)
+        {
+            handlers.InvokeAll(i);
+        }
+        sink += threadSink;
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < numThreads; ++i)
+    {
+        threads.emplace_back(invokeAll);
+    }
+    invokeAll();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>{duration}.count() / (rounds * numThreads * numHandlers);
+}
+
+template <typename Handlers>
+void AddHandlers(Handlers& handlers, size_t numHandlers)
+{
+    for (size_t i = 0; i < numHandlers; ++i)
+    {
+        handlers.Add([](size_t value) { threadSink += value & 1; });
+    }
+}
+
+void RunBenchmark(size_t rounds, size_t numThreads, size_t numHandlers)
+{
+    RecursiveMutexReference reference;
+    AddHandlers(reference, numHandlers);
+
+    SilKit::Util::SynchronizedHandlers<Handler> handlers;
+    AddHandlers(handlers, numHandlers);
+
+    std::cout << std::setw(10) << numHandlers << std::fixed << std::setprecision(1);
+    for (const auto threads : {size_t{1}, numThreads})
+    {
+        std::cout << std::setw(20) << MeasureNanosecondsPerInvocation(rounds, threads, numHandlers, reference)
+                  << std::setw(20) << MeasureNanosecondsPerInvocation(rounds, threads, numHandlers, handlers);
+    }
+    std::cout << "\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    size_t rounds = 1000000;
+    if (argc > 1)
+    {
+        rounds = std::stoul(argv[1]);
+    }
+    size_t numThreads = 4;
+    if (argc > 2)
+    {
+        numThreads = std::stoul(argv[2]);
+    }
+
+    const auto suffix = " x" + std::to_string(numThreads) + " [ns]";
+    std::cout << std::setw(10) << "handlers" << std::setw(20) << "mutex [ns]" << std::setw(20) << "snapshot [ns]"
+              << std::setw(20) << "mutex" + suffix << std::setw(20) << "snapshot" + suffix << "\n";
+
+    for (const size_t numHandlers : {1, 4, 16, 64})
+    {
+        RunBenchmark(rounds, numThreads, numHandlers);
+    }
+
+    return sink.load() == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "BoundedQueue.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using SilKit::Util::BoundedQueue;
+
+TEST(BoundedQueueTest, push_fails_when_full_and_pop_when_empty)
+{
+    BoundedQueue<int> queue{3};
+    ASSERT_EQ(queue.Capacity(), 4u);
+
+    int value = 0;
+    EXPECT_FALSE(queue.TryPop(value));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.TryPush(int{i}));
+    }
+    EXPECT_FALSE(queue.TryPush(4));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+
+    // the slots are reused in the next lap
+    EXPECT_TRUE(queue.TryPush(5));
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 5);
+}
+
+TEST(BoundedQueueTest, moves_values)
+{
+    BoundedQueue<std::unique_ptr<int>> queue{2};
+
+    auto value = std::make_unique<int>(42);
+    ASSERT_TRUE(queue.TryPush(std::move(value)));
+    EXPECT_EQ(value, nullptr);
+
+    std::unique_ptr<int> out;
+    ASSERT_TRUE(queue.TryPop(out));
+    ASSERT_NE(out, nullptr);
+    EXPECT_EQ(*out, 42);
+}
+
+TEST(BoundedQueueTest, concurrent_producers_and_consumer)
+{
+    constexpr int numProducers = 4;
+    constexpr int numValuesPerProducer = 10000;
+
+    BoundedQueue<int> queue{64};
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < numProducers; ++producer)
+    {
+        producers.emplace_back([&queue, producer] {
+            for (int i = 0; i < numValuesPerProducer; ++i)
+            {
+                auto value = producer * numValuesPerProducer + i;
+                while (!queue.TryPush(std::move(value)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // every value is received exactly once, the values of each producer in order
+    std::vector<int> received(numProducers * numValuesPerProducer, 0);
+    std::vector<int> lastValue(numProducers, -1);
+    for (int count = 0; count < numProducers * numValuesPerProducer;)
+    {
+        int value = 0;
+        if (!queue.TryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        ++received[value];
+        EXPECT_GT(value, lastValue[value / numValuesPerProducer]);
+        lastValue[value / numValuesPerProducer] = value;
+        ++count;
+    }
+
+    for (auto&& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(std::accumulate(received.begin(), received.end(), 0), numProducers * numValuesPerProducer);
+    EXPECT_TRUE(std::all_of(received.begin(), received.end(), [](int n) { return n == 1; }));
+}
+
+} // namespace
@@ -0,0 +1,131 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "FlatHashMap.hpp"
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "Uuid.hpp"
+
+namespace {
+
+using SilKit::Util::FlatHashMap;
+
+TEST(FlatHashMapTest, insert_find_erase)
+{
+    FlatHashMap<int, std::string> map;
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(map.Find(1), nullptr);
+    EXPECT_FALSE(map.Erase(1));
+
+    EXPECT_TRUE(map.Insert(1, "one"));
+    EXPECT_TRUE(map.Insert(2, "two"));
+    EXPECT_FALSE(map.Insert(1, "uno"));
+    EXPECT_EQ(map.Size(), 2u);
+
+    ASSERT_NE(map.Find(1), nullptr);
+    EXPECT_EQ(*map.Find(1), "one");
+    *map.Find(2) = "zwei";
+    EXPECT_EQ(*map.Find(2), "zwei");
+
+    EXPECT_TRUE(map.Erase(1));
+    EXPECT_FALSE(map.Erase(1));
+    EXPECT_EQ(map.Find(1), nullptr);
+    EXPECT_EQ(*map.Find(2), "zwei");
+    EXPECT_EQ(map.Size(), 1u);
+
+    map.Clear();
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(map.Find(2), nullptr);
+}
+
+TEST(FlatHashMapTest, matches_std_map_under_random_operations)
+{
+    // a small key range forces long probe sequences, erasures have to keep them intact
+    FlatHashMap<uint32_t, uint32_t> map;
+    std::map<uint32_t, uint32_t> reference;
+
+    std::mt19937 random{42};
+    std::uniform_int_distribution<uint32_t> keys{0, 999};
+    for (uint32_t i = 0; i < 100000; ++i)
+    {
+        const auto key = keys(random);
+        if (random() % 3 == 0)
+        {
+            EXPECT_EQ(map.Erase(key), reference.erase(key) == 1);
+        }
+        else
+        {
+            EXPECT_EQ(map.Insert(key, i), reference.emplace(key, i).second);
+        }
+    }
+
+    ASSERT_EQ(map.Size(), reference.size());
+    for (uint32_t key = 0; key < 1000; ++key)
+    {
+        const auto it = reference.find(key);
+        const auto* value = map.Find(key);
+        if (it == reference.end())
+        {
+            EXPECT_EQ(value, nullptr);
+        }
+        else
+        {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(*value, it->second);
+        }
+    }
+}
+
+TEST(FlatHashMapTest, uuid_keys)
+{
+    FlatHashMap<SilKit::Util::Uuid, int, SilKit::Util::UuidHash> map;
+    std::vector<SilKit::Util::Uuid> uuids;
+    for (int i = 0; i < 1000; ++i)
+    {
+        uuids.push_back(SilKit::Util::Uuid::GenerateRandom());
+        ASSERT_TRUE(map.Insert(uuids.back(), i));
+    }
+    for (int i = 0; i < 1000; i += 2)
+    {
+        ASSERT_TRUE(map.Erase(uuids[i]));
+    }
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto* value = map.Find(uuids[i]);
+        if (i % 2 == 0)
+        {
+            EXPECT_EQ(value, nullptr);
+        }
+        else
+        {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(*value, i);
+        }
+    }
+}
+
+} // namespace
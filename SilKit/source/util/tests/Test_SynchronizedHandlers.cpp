@@ -29,6 +29,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <set>
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
+#include <memory>
 
 namespace {
 
@@ -217,6 +219,115 @@ TEST(SynchronizedHandlersTest, add_remove_call_concurrently)
     EXPECT_EQ(handlerIds.size(), 0);
 }
 
+TEST(SynchronizedHandlersTest, remove_handlers_and_invoke_nested_during_calling)
+{
+    SilKit::Util::SynchronizedHandlers<TestFunction> callables;
+
+    Callbacks callbacks;
+
+    SilKit::Util::HandlerId hA{}, hB{}, hC{};
+
+    hA = callables.Add([&callables, &callbacks, &hA, &hB] {
+        callbacks.TestA();
+        callables.Remove(hA);
+        callables.Remove(hB);
+    });
+
+    hB = callables.Add([&callbacks] {
+        callbacks.TestB();
+    });
+
+    hC = callables.Add([&callables, &callbacks, &hC] {
+        callbacks.TestC();
+        callables.Remove(hC);
+        callables.InvokeAll();
+    });
+
+    callables.Add([&callbacks] {
+        callbacks.TestD();
+    });
+
+    EXPECT_CALL(callbacks, TestA).Times(1);
+    EXPECT_CALL(callbacks, TestB).Times(0);
+    EXPECT_CALL(callbacks, TestC).Times(1);
+    EXPECT_CALL(callbacks, TestD).Times(2);
+
+    EXPECT_TRUE(callables.InvokeAll());
+    EXPECT_EQ(callables.Size(), 1u);
+}
+
+TEST(SynchronizedHandlersTest, remove_waits_for_handler_running_on_other_thread)
+{
+    SilKit::Util::SynchronizedHandlers<TestFunction> callables;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool entered{false};
+    bool release{false};
+    std::atomic<bool> handlerReturned{false};
+    std::atomic<bool> removeReturned{false};
+    std::atomic<bool> returnedBeforeRemove{false};
+
+    const auto handlerId = callables.Add([&] {
+        std::unique_lock<std::mutex> lock{mutex};
+        entered = true;
+        cv.notify_all();
+        cv.wait(lock, [&release] { return release; });
+        handlerReturned = true;
+        returnedBeforeRemove = !removeReturned.load();
+    });
+
+    auto invoker = std::thread{[&callables] { callables.InvokeAll(); }};
+
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        cv.wait(lock, [&entered] { return entered; });
+    }
+
+    auto remover = std::thread{[&callables, &removeReturned, handlerId] {
+        EXPECT_TRUE(callables.Remove(handlerId));
+        removeReturned = true;
+    }};
+
+    // the handler is still blocked, so Remove must not return
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_FALSE(removeReturned.load());
+
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        release = true;
+        cv.notify_all();
+    }
+
+    remover.join();
+    invoker.join();
+
+    EXPECT_TRUE(handlerReturned.load());
+    EXPECT_TRUE(removeReturned.load());
+    EXPECT_TRUE(returnedBeforeRemove.load());
+    EXPECT_EQ(callables.Size(), 0u);
+}
+
+TEST(SynchronizedHandlersTest, remove_releases_the_captured_state)
+{
+    SilKit::Util::SynchronizedHandlers<TestFunction> callables;
+
+    auto state = std::make_shared<int>(0);
+
+    const auto handlerId = callables.Add([state] { ++*state; });
+    callables.Add([&callables] { callables.Add([] {}); });
+
+    EXPECT_TRUE(callables.InvokeAll());
+    EXPECT_TRUE(callables.InvokeAll());
+    EXPECT_EQ(*state, 2);
+
+    EXPECT_TRUE(callables.Remove(handlerId));
+    EXPECT_EQ(state.use_count(), 1);
+
+    EXPECT_TRUE(callables.InvokeAll());
+    EXPECT_EQ(*state, 2);
+}
+
 TEST(SynchronizedHandlersTest, swap_transfers_handlers)
 {
     using TestHandlers = SilKit::Util::SynchronizedHandlers<TestFunction>;
@@ -0,0 +1,127 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "TimerWheel.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using SilKit::Util::TimerWheel;
+
+auto PopAllExpired(TimerWheel& wheel) -> std::vector<TimerWheel::Entry*>
+{
+    std::vector<TimerWheel::Entry*> expired;
+    while (auto* entry = wheel.PopExpired())
+    {
+        expired.push_back(entry);
+    }
+    return expired;
+}
+
+TEST(TimerWheelTest, entries_expire_at_their_deadline)
+{
+    TimerWheel wheel;
+    TimerWheel::Entry first, second;
+    wheel.Schedule(second, 20);
+    wheel.Schedule(first, 10);
+    EXPECT_EQ(wheel.NextDeadline(), 10u);
+
+    wheel.Advance(9);
+    EXPECT_TRUE(PopAllExpired(wheel).empty());
+
+    wheel.Advance(10);
+    EXPECT_EQ(PopAllExpired(wheel), std::vector<TimerWheel::Entry*>{&first});
+    EXPECT_FALSE(first.IsLinked());
+    EXPECT_EQ(wheel.NextDeadline(), 20u);
+
+    wheel.Advance(100);
+    EXPECT_EQ(PopAllExpired(wheel), std::vector<TimerWheel::Entry*>{&second});
+    EXPECT_TRUE(wheel.Empty());
+    EXPECT_EQ(wheel.NextDeadline(), TimerWheel::NoDeadline());
+}
+
+TEST(TimerWheelTest, cancelled_and_rescheduled_entries)
+{
+    TimerWheel wheel;
+    TimerWheel::Entry cancelled, rescheduled;
+    wheel.Schedule(cancelled, 5);
+    wheel.Schedule(rescheduled, 5);
+
+    wheel.Cancel(cancelled);
+    wheel.Schedule(rescheduled, 7);
+
+    wheel.Advance(6);
+    EXPECT_TRUE(PopAllExpired(wheel).empty());
+    wheel.Advance(7);
+    EXPECT_EQ(PopAllExpired(wheel), std::vector<TimerWheel::Entry*>{&rescheduled});
+
+    // cancelling an expired entry removes it from the expired entries
+    wheel.Schedule(cancelled, 8);
+    wheel.Advance(8);
+    wheel.Cancel(cancelled);
+    EXPECT_EQ(wheel.PopExpired(), nullptr);
+}
+
+TEST(TimerWheelTest, entries_cascade_from_higher_levels)
+{
+    TimerWheel wheel{1};
+    // one deadline per level, one beyond the range of the wheel, and one in the past
+    const std::vector<TimerWheel::Tick> deadlines{3, 100, 5000, 300000, 20000000, 0};
+    std::vector<TimerWheel::Entry> entries(deadlines.size());
+    for (std::size_t i = 0; i < deadlines.size(); ++i)
+    {
+        wheel.Schedule(entries[i], deadlines[i]);
+    }
+
+    wheel.Advance(1);
+    EXPECT_EQ(PopAllExpired(wheel), std::vector<TimerWheel::Entry*>{&entries[5]});
+
+    for (std::size_t i = 0; i + 1 < deadlines.size(); ++i)
+    {
+        // NextDeadline never skips over a deadline
+        EXPECT_LE(wheel.NextDeadline(), deadlines[i]);
+
+        wheel.Advance(deadlines[i] - 1);
+        EXPECT_TRUE(PopAllExpired(wheel).empty()) << "deadline " << deadlines[i];
+
+        wheel.Advance(deadlines[i]);
+        EXPECT_EQ(PopAllExpired(wheel), std::vector<TimerWheel::Entry*>{&entries[i]}) << "deadline " << deadlines[i];
+    }
+    EXPECT_TRUE(wheel.Empty());
+}
+
+TEST(TimerWheelTest, advancing_an_empty_wheel_skips_ahead)
+{
+    TimerWheel wheel;
+    wheel.Advance(1000000);
+    EXPECT_EQ(wheel.Now(), 1000001u);
+
+    TimerWheel::Entry entry;
+    wheel.Schedule(entry, 1000010);
+    EXPECT_EQ(wheel.NextDeadline(), 1000010u);
+    wheel.Advance(1000010);
+    EXPECT_EQ(wheel.PopExpired(), &entry);
+}
+
+} // anonymous namespace
@@ -27,6 +27,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SharedVector.hpp"
 
 #include <chrono>
+#include <sstream>
 #include <vector>
 
 namespace SilKit {
@@ -39,12 +40,21 @@ struct WireDataMessageEvent
     Util::SharedVector<uint8_t> data;
 };
 
+//! Several messages of one publisher, sent together when aggregation is enabled
+struct WireDataMessageBatchEvent
+{
+    std::vector<WireDataMessageEvent> messages;
+};
+
 inline auto ToDataMessageEvent(const WireDataMessageEvent& wireDataMessageEvent) -> DataMessageEvent;
 inline auto MakeWireDataMessageEvent(const DataMessageEvent& dataMessageEvent) -> WireDataMessageEvent;
 
 inline std::string to_string(const WireDataMessageEvent& msg);
 inline std::ostream& operator<<(std::ostream& out, const WireDataMessageEvent& msg);
 
+inline std::string to_string(const WireDataMessageBatchEvent& msg);
+inline std::ostream& operator<<(std::ostream& out, const WireDataMessageBatchEvent& msg);
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
@@ -69,6 +79,24 @@ std::ostream& operator<<(std::ostream& out, const WireDataMessageEvent& msg)
     return out << ToDataMessageEvent(msg);
 }
 
+std::string to_string(const WireDataMessageBatchEvent& msg)
+{
+    std::stringstream out;
+    out << msg;
+    return out.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const WireDataMessageBatchEvent& msg)
+{
+    out << "pubsub::DataMessageBatchEvent{messages=" << msg.messages.size();
+    if (!msg.messages.empty())
+    {
+        out << ", first=" << msg.messages.front().timestamp.count() << "ns"
+            << ", last=" << msg.messages.back().timestamp.count() << "ns";
+    }
+    return out << "}";
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
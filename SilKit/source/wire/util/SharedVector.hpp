@@ -26,6 +26,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <memory>
 #include <algorithm>
+#include <vector>
 
 namespace SilKit {
 namespace Util {
@@ -45,10 +46,18 @@ public:
 
     SharedVector(const Span<const T> span, size_t minimumSize = 0, T padValue = T{});
 
+    //! Refers to the first size elements of data without copying them, e.g., a slice of a received network buffer.
+    SharedVector(std::shared_ptr<const T> data, size_t size);
+
     auto AsSpan() const& -> Span<const T>;
 
+    //! The first element, whose ownership is shared with the underlying storage.
+    auto GetSharedData() const -> std::shared_ptr<const T>;
+
 private:
-    std::shared_ptr<std::vector<T>> _data;
+    // Points either into a vector owned by the shared state, or into foreign storage whose ownership is shared
+    std::shared_ptr<const T> _data;
+    size_t _size{0};
 };
 
 template <typename T>
@@ -66,15 +75,26 @@ SharedVector<T>::SharedVector(std::initializer_list<T> initializerList)
 
 template <typename T>
 SharedVector<T>::SharedVector(std::vector<T> vector)
-    : _data{std::make_shared<std::vector<T>>(std::move(vector))}
 {
+    auto data = std::make_shared<std::vector<T>>(std::move(vector));
+    _size = data->size();
+    _data = std::shared_ptr<const T>{data, data->data()};
 }
 
 template <typename T>
 SharedVector<T>::SharedVector(const Span<const T> span, const size_t minimumSize, const T padValue)
-    : _data{std::make_shared<std::vector<T>>(span.begin(), span.end())}
 {
-    _data->resize((std::max)(_data->size(), minimumSize), padValue);
+    auto data = std::make_shared<std::vector<T>>(span.begin(), span.end());
+    data->resize((std::max)(data->size(), minimumSize), padValue);
+    _size = data->size();
+    _data = std::shared_ptr<const T>{data, data->data()};
+}
+
+template <typename T>
+SharedVector<T>::SharedVector(std::shared_ptr<const T> data, size_t size)
+    : _data{std::move(data)}
+    , _size{size}
+{
 }
 
 template <typename T>
@@ -82,7 +102,7 @@ auto SharedVector<T>::AsSpan() const& -> Span<const T>
 {
     if (_data)
     {
-        return {_data->data(), _data->size()};
+        return {_data.get(), _size};
     }
     else
     {
@@ -90,6 +110,12 @@ auto SharedVector<T>::AsSpan() const& -> Span<const T>
     }
 }
 
+template <typename T>
+auto SharedVector<T>::GetSharedData() const -> std::shared_ptr<const T>
+{
+    return _data;
+}
+
 template <typename T>
 bool ItemsAreEqual(const SharedVector<T>& lhs, const SharedVector<T>& rhs)
 {